@@ -0,0 +1,302 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "AsteroidFieldSubsystem.h"
+#include "SpaceActor.h"
+#include "SpatialPartitionSubsystem.h"
+#include "VoxelComponent.h"
+#include "VoxelMaterial.h"
+#include "Components/HierarchicalInstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAsteroidField, Log, All);
+
+namespace
+{
+	/** Smallest and largest archetype blob radius, in voxels */
+	constexpr int32 MinArchetypeRadius = 4;
+	constexpr int32 MaxArchetypeRadius = 9;
+
+	/** Instance scale range; variety comes from scale, not unique meshes */
+	constexpr float MinInstanceScale = 0.5f;
+	constexpr float MaxInstanceScale = 3.0f;
+}
+
+int32 UAsteroidFieldSubsystem::GenerateField(const FVector& Center, float Radius, int32 Count, int32 Seed)
+{
+	EnsureArchetypes(Seed);
+	if (Archetypes.Num() == 0)
+	{
+		return 0;
+	}
+
+	// Every draw comes from this stream, so a (center, seed) pair always
+	// reproduces the same field - sectors can regenerate on revisit
+	// without storing per-asteroid data
+	FRandomStream Stream(Seed);
+	int32 NumScattered = 0;
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		FAsteroidArchetype& Archetype = Archetypes[Stream.RandRange(0, Archetypes.Num() - 1)];
+		if (!Archetype.Instances)
+		{
+			continue;
+		}
+
+		const FVector Location = Center + Stream.VRand() * Stream.FRandRange(0.0f, Radius);
+		const FRotator Rotation(Stream.FRandRange(-180.0f, 180.0f),
+			Stream.FRandRange(-180.0f, 180.0f), Stream.FRandRange(-180.0f, 180.0f));
+		const float Scale = Stream.FRandRange(MinInstanceScale, MaxInstanceScale);
+
+		const FTransform Transform(Rotation, Location, FVector(Scale));
+		Archetype.Instances->AddInstance(Transform, /*bWorldSpace*/ true);
+		Archetype.InstanceTransforms.Add(Transform);
+		++NumScattered;
+	}
+
+	UE_LOG(LogAsteroidField, Log, TEXT("AsteroidField: Scattered %d instances across %d archetypes (seed %d)"),
+		NumScattered, Archetypes.Num(), Seed);
+	return NumScattered;
+}
+
+AActor* UAsteroidFieldSubsystem::PromoteNearestInstance(const FVector& WorldLocation, float SearchRadius)
+{
+	int32 BestArchetype = INDEX_NONE;
+	int32 BestInstance = INDEX_NONE;
+	float BestDistSquared = SearchRadius * SearchRadius;
+	for (int32 ArchetypeIndex = 0; ArchetypeIndex < Archetypes.Num(); ++ArchetypeIndex)
+	{
+		const TArray<FTransform>& Transforms = Archetypes[ArchetypeIndex].InstanceTransforms;
+		for (int32 InstanceIndex = 0; InstanceIndex < Transforms.Num(); ++InstanceIndex)
+		{
+			const float DistSquared = FVector::DistSquared(WorldLocation, Transforms[InstanceIndex].GetLocation());
+			if (DistSquared < BestDistSquared)
+			{
+				BestDistSquared = DistSquared;
+				BestArchetype = ArchetypeIndex;
+				BestInstance = InstanceIndex;
+			}
+		}
+	}
+
+	if (BestArchetype == INDEX_NONE)
+	{
+		return nullptr;
+	}
+
+	FAsteroidArchetype& Archetype = Archetypes[BestArchetype];
+	const FTransform Transform = Archetype.InstanceTransforms[BestInstance];
+
+	// The HISM swaps its last instance into the removed slot; the mirror
+	// array does the same so indices stay paired
+	Archetype.Instances->RemoveInstance(BestInstance);
+	Archetype.InstanceTransforms.RemoveAtSwap(BestInstance, EAllowShrinking::No);
+
+	return SpawnPromotedAsteroid(Archetype, Transform);
+}
+
+int32 UAsteroidFieldSubsystem::GetInstanceCount() const
+{
+	int32 Count = 0;
+	for (const FAsteroidArchetype& Archetype : Archetypes)
+	{
+		Count += Archetype.InstanceTransforms.Num();
+	}
+	return Count;
+}
+
+void UAsteroidFieldSubsystem::EnsureArchetypes(int32 Seed)
+{
+	if (Archetypes.Num() > 0 && ArchetypeSeed == Seed)
+	{
+		return;
+	}
+	ArchetypeSeed = Seed;
+	Archetypes.Reset();
+
+	// One hidden holder actor carries the per-archetype instance renderers
+	if (!FieldHolder)
+	{
+		FieldHolder = GetWorld()->SpawnActor<AActor>();
+		if (!FieldHolder)
+		{
+			return;
+		}
+	}
+
+	Archetypes.SetNum(NumArchetypes);
+	for (int32 Index = 0; Index < NumArchetypes; ++Index)
+	{
+		FAsteroidArchetype& Archetype = Archetypes[Index];
+		Archetype.Voxels = GenerateArchetypeVoxels(Seed, Index);
+		Archetype.Mesh = BakeArchetypeMesh(Archetype.Voxels, Index);
+		if (!Archetype.Mesh)
+		{
+			continue;
+		}
+
+		UHierarchicalInstancedStaticMeshComponent* Instances = NewObject<UHierarchicalInstancedStaticMeshComponent>(
+			FieldHolder, *FString::Printf(TEXT("AsteroidArchetype%d"), Index));
+		Instances->SetStaticMesh(Archetype.Mesh);
+		Instances->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+		Instances->SetCastShadow(false);
+		Instances->RegisterComponent();
+		if (!FieldHolder->GetRootComponent())
+		{
+			FieldHolder->SetRootComponent(Instances);
+		}
+		else
+		{
+			Instances->AttachToComponent(FieldHolder->GetRootComponent(), FAttachmentTransformRules::KeepWorldTransform);
+		}
+		Archetype.Instances = Instances;
+	}
+}
+
+TArray<FPackedVoxel> UAsteroidFieldSubsystem::GenerateArchetypeVoxels(int32 Seed, int32 ArchetypeIndex)
+{
+	// Each archetype draws from its own stream derived from the field
+	// seed, so the library is stable across sessions and machines
+	FRandomStream Stream(Seed * 7919 + ArchetypeIndex);
+	const int32 Radius = Stream.RandRange(MinArchetypeRadius, MaxArchetypeRadius);
+	const FColor BaseColor = UVoxelMaterialLibrary::GetMaterialColor(EMaterialTier::Iron);
+
+	// Lumpy ball: a sphere whose surface radius wobbles per voxel. Solid
+	// interiors cost the greedy mesher nothing - interior faces cull.
+	TArray<FPackedVoxel> Voxels;
+	for (int32 Z = -Radius; Z <= Radius; ++Z)
+	{
+		for (int32 Y = -Radius; Y <= Radius; ++Y)
+		{
+			for (int32 X = -Radius; X <= Radius; ++X)
+			{
+				const float Dist = FMath::Sqrt(static_cast<float>(X * X + Y * Y + Z * Z));
+				if (Dist <= Radius * Stream.FRandRange(0.75f, 1.0f))
+				{
+					FPackedVoxel Voxel;
+					Voxel.Coord = FIntVector(X, Y, Z);
+					Voxel.Material = static_cast<uint8>(EMaterialTier::Iron);
+
+					// Slight per-voxel shade variation sells the rock
+					const uint8 Shade = static_cast<uint8>(Stream.RandRange(-20, 20));
+					Voxel.Color = FColor(BaseColor.R + Shade, BaseColor.G + Shade, BaseColor.B + Shade);
+					Voxels.Add(Voxel);
+				}
+			}
+		}
+	}
+	return Voxels;
+}
+
+UStaticMesh* UAsteroidFieldSubsystem::BakeArchetypeMesh(const TArray<FPackedVoxel>& Voxels, int32 ArchetypeIndex)
+{
+	if (Voxels.Num() == 0 || !FieldHolder)
+	{
+		return nullptr;
+	}
+
+	// Mesh the archetype exactly once through the shared greedy mesher;
+	// every scattered instance renders these buffers
+	FVoxelMeshBuildResult Build;
+	UVoxelComponent::BuildGreedyMesh(Voxels, TArray<FPackedVoxel>(), Build);
+	if (Build.Vertices.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	// Convert the buffers into a static mesh the HISM can render
+	FMeshDescription MeshDesc;
+	FStaticMeshAttributes Attributes(MeshDesc);
+	Attributes.Register();
+
+	const FPolygonGroupID PolygonGroup = MeshDesc.CreatePolygonGroup();
+	TVertexAttributesRef<FVector3f> VertexPositions = Attributes.GetVertexPositions();
+	TVertexInstanceAttributesRef<FVector3f> InstanceNormals = Attributes.GetVertexInstanceNormals();
+	TVertexInstanceAttributesRef<FVector4f> InstanceColors = Attributes.GetVertexInstanceColors();
+	TVertexInstanceAttributesRef<FVector2f> InstanceUVs = Attributes.GetVertexInstanceUVs();
+
+	MeshDesc.ReserveNewVertices(Build.Vertices.Num());
+	TArray<FVertexID> VertexIDs;
+	VertexIDs.Reserve(Build.Vertices.Num());
+	for (const FVector& Position : Build.Vertices)
+	{
+		const FVertexID VertexID = MeshDesc.CreateVertex();
+		VertexPositions[VertexID] = FVector3f(Position);
+		VertexIDs.Add(VertexID);
+	}
+
+	MeshDesc.ReserveNewVertexInstances(Build.Triangles.Num());
+	MeshDesc.ReserveNewTriangles(Build.Triangles.Num() / 3);
+	for (int32 Corner = 0; Corner + 2 < Build.Triangles.Num(); Corner += 3)
+	{
+		TArray<FVertexInstanceID> Instances;
+		Instances.Reserve(3);
+		for (int32 Offset = 0; Offset < 3; ++Offset)
+		{
+			const int32 VertexIndex = Build.Triangles[Corner + Offset];
+			const FVertexInstanceID Instance = MeshDesc.CreateVertexInstance(VertexIDs[VertexIndex]);
+			InstanceNormals[Instance] = FVector3f(Build.Normals[VertexIndex]);
+			InstanceColors[Instance] = FVector4f(FLinearColor(Build.VertexColors[VertexIndex]));
+			InstanceUVs[Instance] = FVector2f::ZeroVector;
+			Instances.Add(Instance);
+		}
+		MeshDesc.CreateTriangle(PolygonGroup, Instances);
+	}
+
+	UStaticMesh* Mesh = NewObject<UStaticMesh>(FieldHolder,
+		*FString::Printf(TEXT("AsteroidArchetypeMesh%d"), ArchetypeIndex));
+	Mesh->GetStaticMaterials().Add(FStaticMaterial());
+
+	UStaticMesh::FBuildMeshDescriptionsParams Params;
+	Params.bFastBuild = true;
+	Params.bBuildSimpleCollision = true;
+	Mesh->BuildFromMeshDescriptions({ &MeshDesc }, Params);
+
+	UE_LOG(LogAsteroidField, Log, TEXT("AsteroidField: Archetype %d baked (%d voxels, %d verts, %d tris)"),
+		ArchetypeIndex, Voxels.Num(), Build.Vertices.Num(), Build.Triangles.Num() / 3);
+	return Mesh;
+}
+
+AActor* UAsteroidFieldSubsystem::SpawnPromotedAsteroid(const FAsteroidArchetype& Archetype, const FTransform& Transform)
+{
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	AActor* Asteroid = GetWorld()->SpawnActor<ASpaceActor>(ASpaceActor::StaticClass(),
+		Transform.GetLocation(), Transform.GetRotation().Rotator(), SpawnParams);
+	if (!Asteroid)
+	{
+		return nullptr;
+	}
+	Asteroid->SetActorScale3D(Transform.GetScale3D());
+
+	// Rebuild the archetype's voxels as a live, damageable structure.
+	// The instance rendered the shared mesh; the promoted actor owns its
+	// own blocks from here on.
+	UVoxelComponent* Voxels = NewObject<UVoxelComponent>(Asteroid, TEXT("AsteroidVoxels"));
+	Voxels->bDetectSplits = true;
+	Voxels->RegisterComponent();
+	const FString MaterialName = UVoxelMaterialLibrary::GetMaterialDisplayName(EMaterialTier::Iron);
+	for (const FPackedVoxel& Voxel : Archetype.Voxels)
+	{
+		FVoxelBlock Block;
+		Block.Position = FVector(Voxel.Coord);
+		Block.Size = FVector::OneVector;
+		Block.MaterialType = MaterialName;
+		Block.CalculateProperties();
+		Block.Color = Voxel.Color;
+		Voxels->AddBlock(Block);
+	}
+
+	// Registered with the partition, the promoted asteroid is a normal
+	// target for projectiles and mining from here on
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->RegisterActor(Asteroid);
+	}
+
+	UE_LOG(LogAsteroidField, Log, TEXT("AsteroidField: Promoted instance at %s (%d blocks)"),
+		*Transform.GetLocation().ToString(), Archetype.Voxels.Num());
+	return Asteroid;
+}
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "AutoInitGameActor.h"
+#include "InitSchedulerSubsystem.h"
 #include "Engine/World.h"
 #include "GameFramework/WorldSettings.h"
 #include "GameFramework/GameModeBase.h"
@@ -19,10 +20,28 @@ void AAutoInitGameActor::BeginPlay()
 	Super::BeginPlay();
 	
 	UE_LOG(LogTemp, Warning, TEXT("AutoInitGameActor: Initializing game world..."));
-	
+
+	// World settings must be in place before anything gameplay-visible
+	// spawns, so this stage runs ahead of the game mode's stages
+	if (UInitSchedulerSubsystem* Init = GetWorld() ? GetWorld()->GetSubsystem<UInitSchedulerSubsystem>() : nullptr)
+	{
+		Init->EnqueueStage(TEXT("World Settings"), 0,
+			[WeakThis = TWeakObjectPtr<AAutoInitGameActor>(this)]()
+			{
+				if (AAutoInitGameActor* Actor = WeakThis.Get())
+				{
+					Actor->SetupWorldSettings();
+					Actor->EnsureGameMode();
+					UE_LOG(LogTemp, Warning, TEXT("AutoInitGameActor: Initialization complete!"));
+				}
+				return true;
+			});
+		return;
+	}
+
 	SetupWorldSettings();
 	EnsureGameMode();
-	
+
 	UE_LOG(LogTemp, Warning, TEXT("AutoInitGameActor: Initialization complete!"));
 }
 
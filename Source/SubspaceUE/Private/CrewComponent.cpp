@@ -1,6 +1,10 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "CrewComponent.h"
+#include "ShipInteriorComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "UObject/ConstructorHelpers.h"
+#include "Engine/StaticMesh.h"
 #include "Engine/World.h"
 #include "Math/UnrealMathUtility.h"
 
@@ -9,51 +13,229 @@ DEFINE_LOG_CATEGORY_STATIC(LogCrew, Log, All);
 UCrewComponent::UCrewComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
-	PrimaryComponentTick.TickInterval = 1.0f;  // Update once per second
+	PrimaryComponentTick.TickInterval = 0.25f;  // Walking sim cadence; morale and salaries batch on timers
+
+	// Cache the cube mesh for walker visuals
+	static ConstructorHelpers::FObjectFinder<UStaticMesh> CubeMeshFinder(TEXT("/Engine/BasicShapes/Cube"));
+	if (CubeMeshFinder.Succeeded())
+	{
+		CachedCrewMesh = CubeMeshFinder.Object;
+	}
 }
 
 void UCrewComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Pick up crew configured in the editor or spawned with the actor
+	RebuildCrewAggregates();
+
+	// Walkers need the interior's baked nav graph; not every crewed actor
+	// has one (stations without interiors just skip the sim)
+	ShipInterior = GetOwner() ? GetOwner()->FindComponentByClass<UShipInteriorComponent>() : nullptr;
 }
 
 void UCrewComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	// Update morale
-	UpdateMorale(DeltaTime);
-	
-	// Pay salaries (every hour)
+
+	// Normalize morale in one batched pass per minute
+	MoraleTimer += DeltaTime;
+	if (MoraleTimer >= 60.0f)
+	{
+		UpdateMorale(MoraleTimer);
+		MoraleTimer = 0.0f;
+	}
+
+	// Pay salaries (every hour) from the cached total
 	SalaryTimer += DeltaTime;
 	if (SalaryTimer >= 3600.0f)
 	{
 		SalaryTimer = 0.0f;
-		
-		// Deduct salaries
-		for (const FCrewMember& Crew : CrewMembers)
+		Credits -= TotalSalaryPerHour;
+		UE_LOG(LogCrew, Verbose, TEXT("Paid crew salaries (%d credits)"), TotalSalaryPerHour);
+	}
+
+	UpdateCrewWalking(DeltaTime);
+}
+
+TArray<FVector> UCrewComponent::GetCrewLocalPositions() const
+{
+	TArray<FVector> Positions;
+	Positions.Reserve(Walkers.Num());
+	for (const FCrewWalker& Walker : Walkers)
+	{
+		Positions.Add(Walker.Position);
+	}
+	return Positions;
+}
+
+void UCrewComponent::UpdateCrewWalking(float DeltaTime)
+{
+	UShipInteriorComponent* Interior = ShipInterior.Get();
+	if (!bSimulateCrewWalking || !Interior || !Interior->bInteriorAccessible ||
+	    Interior->GetNavNodeCount() == 0)
+	{
+		return;
+	}
+
+	// One walker per crew member; new hires appear in a random room and
+	// idle briefly before their first walk
+	while (Walkers.Num() < CrewMembers.Num())
+	{
+		const FInteriorCell& Cell = Interior->Cells[FMath::RandRange(0, Interior->Cells.Num() - 1)];
+		FCrewWalker Walker;
+		Walker.Position = (Cell.MinBounds + Cell.MaxBounds) * 0.5f;
+		Walker.IdleTimer = FMath::FRandRange(0.0f, 4.0f);
+		Walkers.Add(Walker);
+	}
+	if (Walkers.Num() > CrewMembers.Num())
+	{
+		Walkers.SetNum(CrewMembers.Num());
+	}
+
+	// Movement is pure segment following - the baked graph already solved
+	// the routing, so there is no search anywhere in the per-frame path
+	for (FCrewWalker& Walker : Walkers)
+	{
+		if (Walker.NextPoint < Walker.PathPoints.Num())
 		{
-			Credits -= Crew.SalaryPerHour;
+			float Budget = CrewWalkSpeed * DeltaTime;
+			while (Budget > 0.0f && Walker.NextPoint < Walker.PathPoints.Num())
+			{
+				const FVector& Target = Walker.PathPoints[Walker.NextPoint];
+				const float Remaining = FVector::Dist(Walker.Position, Target);
+				if (Remaining <= Budget)
+				{
+					Walker.Position = Target;
+					Budget -= Remaining;
+					Walker.NextPoint++;
+				}
+				else
+				{
+					Walker.Position += (Target - Walker.Position) * (Budget / Remaining);
+					Budget = 0.0f;
+				}
+			}
+			if (Walker.NextPoint >= Walker.PathPoints.Num())
+			{
+				Walker.PathPoints.Reset();
+				Walker.NextPoint = 0;
+				Walker.IdleTimer = FMath::FRandRange(3.0f, 10.0f);
+			}
 		}
-		
-		UE_LOG(LogCrew, Verbose, TEXT("Paid crew salaries"));
+		else
+		{
+			Walker.IdleTimer -= DeltaTime;
+			if (Walker.IdleTimer <= 0.0f)
+			{
+				StartNewWalk(Walker, Interior);
+			}
+		}
+	}
+
+	EnsureWalkerVisuals();
+	if (!WalkerInstances)
+	{
+		return;
+	}
+
+	// Match the instance count to the walker count, then batch-write every
+	// transform; walkers in culled cells collapse to zero scale so an
+	// empty (or unentered) interior renders nothing
+	while (WalkerInstances->GetInstanceCount() < Walkers.Num())
+	{
+		WalkerInstances->AddInstance(FTransform::Identity, /*bWorldSpace*/ false);
 	}
+	while (WalkerInstances->GetInstanceCount() > Walkers.Num())
+	{
+		WalkerInstances->RemoveInstance(WalkerInstances->GetInstanceCount() - 1);
+	}
+	if (Walkers.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(Walkers.Num());
+	for (const FCrewWalker& Walker : Walkers)
+	{
+		const int32 Cell = Interior->FindCellContaining(Walker.Position);
+		const bool bVisible = Cell != INDEX_NONE && Interior->IsCellActive(Cell);
+
+		// Face the walk direction (yaw only)
+		FQuat Facing = FQuat::Identity;
+		if (Walker.NextPoint < Walker.PathPoints.Num())
+		{
+			FVector Heading = Walker.PathPoints[Walker.NextPoint] - Walker.Position;
+			Heading.Z = 0.0f;
+			if (!Heading.IsNearlyZero())
+			{
+				Facing = FRotator(0.0f, Heading.Rotation().Yaw, 0.0f).Quaternion();
+			}
+		}
+		Transforms.Emplace(Facing, Walker.Position,
+			bVisible ? FVector(0.4f, 0.4f, 1.8f) : FVector::ZeroVector);
+	}
+	WalkerInstances->BatchUpdateInstancesTransforms(0, Transforms, /*bWorldSpace*/ false, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
 }
 
-float UCrewComponent::GetAverageMorale() const
+void UCrewComponent::StartNewWalk(FCrewWalker& Walker, UShipInteriorComponent* Interior)
 {
-	if (CrewMembers.Num() == 0)
+	// Random destination inside a random room, clear of the walls, at
+	// standing height
+	const int32 CellIndex = FMath::RandRange(0, Interior->Cells.Num() - 1);
+	const FInteriorCell& Cell = Interior->Cells[CellIndex];
+	const FVector Destination(
+		FMath::FRandRange(Cell.MinBounds.X + 100.0f, FMath::Max(Cell.MinBounds.X + 100.0f, Cell.MaxBounds.X - 100.0f)),
+		FMath::FRandRange(Cell.MinBounds.Y + 100.0f, FMath::Max(Cell.MinBounds.Y + 100.0f, Cell.MaxBounds.Y - 100.0f)),
+		Cell.MinBounds.Z + 90.0f);
+
+	Walker.NextPoint = 0;
+	if (!Interior->BuildCrewPath(Walker.Position, Destination, Walker.PathPoints))
 	{
-		return 0.0f;
+		// Walker is outside every room (the layout changed under it):
+		// snap into the destination room and resume from there
+		Walker.Position = (Cell.MinBounds + Cell.MaxBounds) * 0.5f;
+		Walker.PathPoints.Reset();
+		Walker.IdleTimer = FMath::FRandRange(1.0f, 3.0f);
 	}
-	
-	float TotalMorale = 0.0f;
+}
+
+void UCrewComponent::EnsureWalkerVisuals()
+{
+	AActor* Owner = GetOwner();
+	if (WalkerInstances || !CachedCrewMesh || !Owner || !Owner->GetRootComponent())
+	{
+		return;
+	}
+
+	// One instanced pool carries every walker, mirroring the interior's
+	// object pools
+	WalkerInstances = NewObject<UInstancedStaticMeshComponent>(Owner, TEXT("CrewWalkerInstances"));
+	WalkerInstances->RegisterComponent();
+	WalkerInstances->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	WalkerInstances->SetStaticMesh(CachedCrewMesh);
+	WalkerInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	WalkerInstances->SetCastShadow(false);
+}
+
+float UCrewComponent::GetAverageMorale() const
+{
+	return CrewMembers.Num() > 0 ? TotalMorale / CrewMembers.Num() : 0.0f;
+}
+
+void UCrewComponent::RebuildCrewAggregates()
+{
+	FMemory::Memzero(RoleCounts);
+	FMemory::Memzero(RoleSkillTotals);
+	TotalMorale = 0.0f;
+	TotalSalaryPerHour = 0;
+
 	for (const FCrewMember& Crew : CrewMembers)
 	{
-		TotalMorale += Crew.Morale;
+		AddCrewToAggregates(Crew);
 	}
-	
-	return TotalMorale / CrewMembers.Num();
 }
 
 TArray<FCrewMember> UCrewComponent::GetCrewByRole(ECrewRole Role) const
@@ -100,6 +282,7 @@ bool UCrewComponent::HireCrewMember(const FCrewMember& NewCrew)
 	
 	Credits -= NewCrew.HiringCost;
 	CrewMembers.Add(NewCrew);
+	AddCrewToAggregates(NewCrew);
 	
 	UE_LOG(LogCrew, Log, TEXT("Hired crew: %s (%s) for %d credits"), 
 		*NewCrew.Name, 
@@ -118,7 +301,8 @@ bool UCrewComponent::FireCrewMember(int32 Index)
 	
 	FCrewMember& Crew = CrewMembers[Index];
 	UE_LOG(LogCrew, Log, TEXT("Fired crew: %s"), *Crew.Name);
-	
+
+	RemoveCrewFromAggregates(Crew);
 	CrewMembers.RemoveAt(Index);
 	return true;
 }
@@ -148,6 +332,8 @@ bool UCrewComponent::TransferCrewMember(int32 Index, AActor* TargetShip)
 	
 	if (TargetCrew->CrewMembers.Add(TransferredCrew) >= 0)
 	{
+		TargetCrew->AddCrewToAggregates(TransferredCrew);
+		RemoveCrewFromAggregates(CrewMembers[Index]);
 		CrewMembers.RemoveAt(Index);
 		UE_LOG(LogCrew, Log, TEXT("Transferred crew: %s to %s"), *TransferredCrew.Name, *TargetShip->GetName());
 		return true;
@@ -165,7 +351,9 @@ bool UCrewComponent::PromoteCrewMember(int32 Index, ECrewRole NewRole)
 	
 	FCrewMember& Crew = CrewMembers[Index];
 	ECrewRole OldRole = Crew.Role;
+	RemoveCrewFromAggregates(Crew);
 	Crew.Role = NewRole;
+	AddCrewToAggregates(Crew);
 	
 	UE_LOG(LogCrew, Log, TEXT("Promoted %s from %s to %s"), 
 		*Crew.Name,
@@ -203,7 +391,8 @@ bool UCrewComponent::TrainCrewMember(int32 Index, ESeminarType Type)
 	
 	FCrewMember& Crew = CrewMembers[Index];
 	Credits -= Cost;
-	
+	RemoveCrewFromAggregates(Crew);
+
 	// Increase skill based on seminar type
 	switch (Type)
 	{
@@ -223,7 +412,8 @@ bool UCrewComponent::TrainCrewMember(int32 Index, ESeminarType Type)
 		Crew.MoraleSkill = FMath::Min(5, Crew.MoraleSkill + 1);
 		break;
 	}
-	
+	AddCrewToAggregates(Crew);
+
 	UE_LOG(LogCrew, Log, TEXT("Trained %s in %s"), *Crew.Name, *UEnum::GetValueAsString(Type));
 	return true;
 }
@@ -242,7 +432,8 @@ void UCrewComponent::AutoLevelSkills(int32 Index)
 	}
 	
 	FCrewMember& Crew = CrewMembers[Index];
-	
+	RemoveCrewFromAggregates(Crew);
+
 	// Auto-level skills based on experience
 	// Every 1000 XP grants skill improvements
 	int32 SkillPoints = Crew.Experience / 1000;
@@ -267,6 +458,7 @@ void UCrewComponent::AutoLevelSkills(int32 Index)
 		Crew.ManagementSkill = FMath::Min(5, SkillPoints);
 		break;
 	}
+	AddCrewToAggregates(Crew);
 }
 
 // ===== Experience & Skills =====
@@ -295,36 +487,14 @@ void UCrewComponent::AwardExperienceToAll(int32 XP)
 
 float UCrewComponent::GetSkillBonus(ECrewRole Role) const
 {
-	TArray<FCrewMember> RoleCrew = GetCrewByRole(Role);
-	if (RoleCrew.Num() == 0)
+	const int32 RoleIndex = (int32)Role;
+	if (RoleIndex < 0 || RoleIndex >= NumCrewRoles || RoleCounts[RoleIndex] == 0)
 	{
 		return 0.0f;
 	}
-	
-	int32 TotalSkill = 0;
-	for (const FCrewMember& Crew : RoleCrew)
-	{
-		switch (Role)
-		{
-		case ECrewRole::Pilot:
-			TotalSkill += Crew.PilotingSkill;
-			break;
-		case ECrewRole::Manager:
-			TotalSkill += Crew.ManagementSkill;
-			break;
-		case ECrewRole::ServiceCrew:
-			TotalSkill += Crew.EngineeringSkill;
-			break;
-		case ECrewRole::Marine:
-			TotalSkill += Crew.BoardingSkill;
-			break;
-		default:
-			break;
-		}
-	}
-	
+
 	// Average skill converted to 0-1 bonus (5 stars = 1.0 bonus)
-	return (float)TotalSkill / (RoleCrew.Num() * 5);
+	return (float)RoleSkillTotals[RoleIndex] / (RoleCounts[RoleIndex] * 5);
 }
 
 float UCrewComponent::GetPilotingEffectiveness() const
@@ -352,10 +522,12 @@ float UCrewComponent::GetEngineeringEffectiveness() const
 
 void UCrewComponent::UpdateMorale(float DeltaTime)
 {
-	// Morale gradually normalizes to 70
+	// Morale gradually normalizes to 70; runs as one batched pass per
+	// minute from TickComponent, with DeltaTime covering the whole batch
 	float TargetMorale = 70.0f;
 	float ChangeRate = 1.0f * DeltaTime;  // 1 point per second
-	
+
+	TotalMorale = 0.0f;
 	for (FCrewMember& Crew : CrewMembers)
 	{
 		if (Crew.Morale < TargetMorale)
@@ -366,26 +538,31 @@ void UCrewComponent::UpdateMorale(float DeltaTime)
 		{
 			Crew.Morale = FMath::Max(TargetMorale, Crew.Morale - ChangeRate);
 		}
+		TotalMorale += Crew.Morale;
 	}
 }
 
 void UCrewComponent::BoostMorale(float Amount)
 {
+	TotalMorale = 0.0f;
 	for (FCrewMember& Crew : CrewMembers)
 	{
 		Crew.Morale = FMath::Clamp(Crew.Morale + Amount, 0.0f, 100.0f);
+		TotalMorale += Crew.Morale;
 	}
-	
+
 	UE_LOG(LogCrew, Log, TEXT("Boosted morale by %.1f"), Amount);
 }
 
 void UCrewComponent::ReduceMorale(float Amount)
 {
+	TotalMorale = 0.0f;
 	for (FCrewMember& Crew : CrewMembers)
 	{
 		Crew.Morale = FMath::Clamp(Crew.Morale - Amount, 0.0f, 100.0f);
+		TotalMorale += Crew.Morale;
 	}
-	
+
 	UE_LOG(LogCrew, Log, TEXT("Reduced morale by %.1f"), Amount);
 }
 
@@ -435,6 +612,7 @@ bool UCrewComponent::BoardShip(AActor* TargetShip)
 			int32 Casualties = FMath::Min(3, TargetCrew->CrewMembers.Num());
 			for (int32 i = 0; i < Casualties; ++i)
 			{
+				TargetCrew->RemoveCrewFromAggregates(TargetCrew->CrewMembers[0]);
 				TargetCrew->CrewMembers.RemoveAt(0);
 			}
 		}
@@ -453,6 +631,7 @@ bool UCrewComponent::BoardShip(AActor* TargetShip)
 			int32 Casualties = FMath::Min(2, CrewMembers.Num());
 			for (int32 i = 0; i < Casualties; ++i)
 			{
+				RemoveCrewFromAggregates(CrewMembers[0]);
 				CrewMembers.RemoveAt(0);
 			}
 		}
@@ -528,3 +707,45 @@ int32 UCrewComponent::CalculateSkillLevel(int32 Experience) const
 	// 1000 XP per skill level, max 5 stars
 	return FMath::Min(5, Experience / 1000);
 }
+
+void UCrewComponent::AddCrewToAggregates(const FCrewMember& Crew)
+{
+	const int32 RoleIndex = (int32)Crew.Role;
+	if (RoleIndex >= 0 && RoleIndex < NumCrewRoles)
+	{
+		RoleCounts[RoleIndex]++;
+		RoleSkillTotals[RoleIndex] += GetRoleSkill(Crew);
+	}
+	TotalMorale += Crew.Morale;
+	TotalSalaryPerHour += Crew.SalaryPerHour;
+}
+
+void UCrewComponent::RemoveCrewFromAggregates(const FCrewMember& Crew)
+{
+	const int32 RoleIndex = (int32)Crew.Role;
+	if (RoleIndex >= 0 && RoleIndex < NumCrewRoles)
+	{
+		RoleCounts[RoleIndex]--;
+		RoleSkillTotals[RoleIndex] -= GetRoleSkill(Crew);
+	}
+	TotalMorale = FMath::Max(0.0f, TotalMorale - Crew.Morale);
+	TotalSalaryPerHour -= Crew.SalaryPerHour;
+}
+
+int32 UCrewComponent::GetRoleSkill(const FCrewMember& Crew)
+{
+	switch (Crew.Role)
+	{
+	case ECrewRole::Captain:
+		return Crew.ManagementSkill;
+	case ECrewRole::Pilot:
+		return Crew.PilotingSkill;
+	case ECrewRole::ServiceCrew:
+		return Crew.EngineeringSkill;
+	case ECrewRole::Marine:
+		return Crew.BoardingSkill;
+	case ECrewRole::Manager:
+		return Crew.ManagementSkill;
+	}
+	return 0;
+}
@@ -0,0 +1,163 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "DockingCorridorComponent.h"
+#include "CollisionQueryParams.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogDockingCorridor, Log, All);
+
+UDockingCorridorComponent::UDockingCorridorComponent()
+{
+	// Corridors are baked once; the component never ticks
+	PrimaryComponentTick.bCanEverTick = false;
+}
+
+void UDockingCorridorComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	BuildCorridors();
+}
+
+void UDockingCorridorComponent::BuildCorridors()
+{
+	Corridors.Reset();
+
+	const FTransform& StationTransform = GetOwner()->GetActorTransform();
+	const FVector Berth = StationTransform.TransformPosition(BerthLocalOffset);
+	const FVector ApproachDir = StationTransform.TransformVectorNoScale(BerthApproachLocalDirection).GetSafeNormal();
+	if (ApproachDir.IsNearlyZero())
+	{
+		UE_LOG(LogDockingCorridor, Warning, TEXT("DockingCorridor: %s has a degenerate approach direction"),
+			*GetOwner()->GetName());
+		return;
+	}
+
+	// Entry points fan out around the approach axis; each corridor funnels
+	// through a shared final-approach gate so the last leg into the berth
+	// is always straight and aligned
+	const FVector FinalGate = Berth - ApproachDir * FinalApproachDistance;
+	FVector FanRight, FanUp;
+	ApproachDir.FindBestAxisVectors(FanRight, FanUp);
+
+	int32 ValidCount = 0;
+	for (int32 Index = 0; Index < NumCorridors; ++Index)
+	{
+		// Spread entries evenly around the axis, tilted out by the fan angle
+		const float Azimuth = (2.0f * PI * Index) / FMath::Max(NumCorridors, 1);
+		const float Tilt = FMath::DegreesToRadians(FanHalfAngle);
+		const FVector EntryDir = (-ApproachDir * FMath::Cos(Tilt) +
+			(FanRight * FMath::Cos(Azimuth) + FanUp * FMath::Sin(Azimuth)) * FMath::Sin(Tilt)).GetSafeNormal();
+
+		FDockingCorridor Corridor;
+		Corridor.ControlPoints = { Berth + EntryDir * EntryDistance, FinalGate, Berth };
+
+		// Validate against station geometry exactly once, at bake time -
+		// ships flying the corridor never trace again
+		Corridor.bBlocked = !ValidateCorridor(Corridor);
+		if (Corridor.bBlocked)
+		{
+			UE_LOG(LogDockingCorridor, Warning, TEXT("DockingCorridor: %s corridor %d blocked by station geometry"),
+				*GetOwner()->GetName(), Index);
+		}
+		else
+		{
+			++ValidCount;
+		}
+		Corridors.Add(MoveTemp(Corridor));
+	}
+
+	UE_LOG(LogDockingCorridor, Log, TEXT("DockingCorridor: %s baked %d corridors (%d valid)"),
+		*GetOwner()->GetName(), Corridors.Num(), ValidCount);
+}
+
+bool UDockingCorridorComponent::ValidateCorridor(const FDockingCorridor& Corridor) const
+{
+	UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	// The final approach leg intentionally ends inside the berth volume;
+	// only the entry-to-gate legs must be clear
+	FCollisionQueryParams Params(SCENE_QUERY_STAT(DockingCorridorBake));
+	for (int32 Segment = 0; Segment + 2 < Corridor.ControlPoints.Num(); ++Segment)
+	{
+		if (World->LineTraceTestByChannel(Corridor.ControlPoints[Segment],
+			Corridor.ControlPoints[Segment + 1], ECC_WorldDynamic, Params) ||
+		    World->LineTraceTestByChannel(Corridor.ControlPoints[Segment],
+			Corridor.ControlPoints[Segment + 1], ECC_WorldStatic, Params))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool UDockingCorridorComponent::AcquireCorridor(AActor* Ship, const FVector& ShipLocation, TArray<FVector>& OutControlPoints, float& OutApproachSpeed)
+{
+	if (!Ship)
+	{
+		return false;
+	}
+
+	int32 BestIndex = INDEX_NONE;
+	float BestDistSquared = TNumericLimits<float>::Max();
+	for (int32 Index = 0; Index < Corridors.Num(); ++Index)
+	{
+		FDockingCorridor& Corridor = Corridors[Index];
+		if (Corridor.bBlocked)
+		{
+			continue;
+		}
+
+		// A stale claim (ship destroyed mid-approach) frees the corridor
+		if (Corridor.ClaimedBy.IsValid() && Corridor.ClaimedBy.Get() != Ship)
+		{
+			continue;
+		}
+
+		const float DistSquared = FVector::DistSquared(ShipLocation, Corridor.ControlPoints[0]);
+		if (DistSquared < BestDistSquared)
+		{
+			BestDistSquared = DistSquared;
+			BestIndex = Index;
+		}
+	}
+
+	if (BestIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	Corridors[BestIndex].ClaimedBy = Ship;
+	OutControlPoints = Corridors[BestIndex].ControlPoints;
+	OutApproachSpeed = ApproachSpeed;
+	return true;
+}
+
+void UDockingCorridorComponent::ReleaseCorridor(AActor* Ship)
+{
+	for (FDockingCorridor& Corridor : Corridors)
+	{
+		if (Corridor.ClaimedBy.Get() == Ship)
+		{
+			Corridor.ClaimedBy = nullptr;
+		}
+	}
+}
+
+int32 UDockingCorridorComponent::GetFreeCorridorCount() const
+{
+	int32 Count = 0;
+	for (const FDockingCorridor& Corridor : Corridors)
+	{
+		if (!Corridor.bBlocked && !Corridor.ClaimedBy.IsValid())
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
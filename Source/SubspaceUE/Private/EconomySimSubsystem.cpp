@@ -0,0 +1,243 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "EconomySimSubsystem.h"
+#include "TradingComponent.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEconomySim, Log, All);
+
+namespace
+{
+	/** Most production cycles one order may complete in a single catch-up
+	    visit, so a sector detached for hours doesn't stall the frame */
+	constexpr int32 MaxCyclesPerVisit = 64;
+}
+
+void UEconomySimSubsystem::Tick(float DeltaTime)
+{
+	CurrentTime += DeltaTime;
+
+	// Round-robin: advance a few sectors per tick by however much real
+	// time has passed since their last visit
+	const int32 Visits = FMath::Min(SectorsPerTick, SectorVisitOrder.Num());
+	for (int32 i = 0; i < Visits; i++)
+	{
+		if (NextSectorVisit >= SectorVisitOrder.Num())
+		{
+			NextSectorVisit = 0;
+		}
+		FSimSector* Sector = Sectors.Find(SectorVisitOrder[NextSectorVisit]);
+		NextSectorVisit++;
+		if (!Sector)
+		{
+			continue;
+		}
+
+		const double CatchUp = CurrentTime - Sector->LastVisitTime;
+		Sector->LastVisitTime = CurrentTime;
+		SimulateSector(*Sector, CatchUp);
+	}
+}
+
+TStatId UEconomySimSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEconomySimSubsystem, STATGROUP_Tickables);
+}
+
+void UEconomySimSubsystem::DetachStation(FName SectorId, UTradingComponent* Station)
+{
+	if (!Station || !Station->GetOwner())
+	{
+		return;
+	}
+
+	bool bNewSector = !Sectors.Contains(SectorId);
+	FSimSector& Sector = Sectors.FindOrAdd(SectorId);
+	if (bNewSector)
+	{
+		Sector.LastVisitTime = CurrentTime;
+		SectorVisitOrder.Add(SectorId);
+	}
+
+	const FName StationId = Station->GetOwner()->GetFName();
+	Sector.Stations.RemoveAll([StationId](const FSimStation& Existing) { return Existing.StationId == StationId; });
+
+	FSimStation Sim;
+	Sim.StationId = StationId;
+	Sim.WareIds = Station->WareIds;
+	Sim.Stock = Station->Storage.StockByIndex;
+	Sim.MaxCapacity = Station->Storage.MaxCapacity;
+	Sim.CurrentUsed = Station->Storage.CurrentUsed;
+
+	for (const TPair<FName, FWare>& WarePair : Station->WareLibrary)
+	{
+		FSimWare SimWare;
+		SimWare.Volume = WarePair.Value.Volume;
+		SimWare.ProductionTime = WarePair.Value.ProductionTime;
+		SimWare.InputWares = WarePair.Value.InputWares;
+		Sim.Wares.Add(WarePair.Key, SimWare);
+	}
+
+	for (const FTradeOrder& Order : Station->TradeOrders)
+	{
+		FSimTradeOrder SimOrder;
+		SimOrder.WareId = Order.WareId;
+		SimOrder.bIsBuyOrder = Order.bIsBuyOrder;
+		SimOrder.MinQuantity = Order.MinQuantity;
+		SimOrder.MaxQuantity = Order.MaxQuantity;
+		SimOrder.bIsActive = Order.bIsActive;
+		if (!Order.bIsBuyOrder)
+		{
+			const FSimWare* Ware = Sim.Wares.Find(Order.WareId);
+			SimOrder.ProductionDue = Sector.SimTime + (Ware ? Ware->ProductionTime : 60.0f);
+		}
+		Sim.Orders.Add(SimOrder);
+	}
+
+	Sector.Stations.Add(MoveTemp(Sim));
+	UE_LOG(LogEconomySim, Log, TEXT("EconomySim: Detached station %s into sector %s (%d stations)"),
+		*StationId.ToString(), *SectorId.ToString(), Sector.Stations.Num());
+}
+
+bool UEconomySimSubsystem::ReattachStation(FName SectorId, UTradingComponent* Station)
+{
+	FSimSector* Sector = Sectors.Find(SectorId);
+	if (!Sector || !Station || !Station->GetOwner())
+	{
+		return false;
+	}
+
+	const FName StationId = Station->GetOwner()->GetFName();
+	const int32 SimIndex = Sector->Stations.IndexOfByPredicate(
+		[StationId](const FSimStation& Sim) { return Sim.StationId == StationId; });
+	if (SimIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Apply simulated stock as deltas through the component's own storage
+	// API so the trade index and production scheduler hooks fire
+	const FSimStation& Sim = Sector->Stations[SimIndex];
+	for (int32 WareIndex = 0; WareIndex < Sim.WareIds.Num(); WareIndex++)
+	{
+		const int32 Delta = Sim.Stock[WareIndex] - Station->GetWareStock(Sim.WareIds[WareIndex]);
+		if (Delta > 0)
+		{
+			Station->AddWareToStorage(Sim.WareIds[WareIndex], Delta);
+		}
+		else if (Delta < 0)
+		{
+			Station->RemoveWareFromStorage(Sim.WareIds[WareIndex], -Delta);
+		}
+	}
+
+	Sector->Stations.RemoveAtSwap(SimIndex);
+	if (Sector->Stations.Num() == 0)
+	{
+		Sectors.Remove(SectorId);
+		SectorVisitOrder.Remove(SectorId);
+	}
+	UE_LOG(LogEconomySim, Log, TEXT("EconomySim: Reattached station %s from sector %s"),
+		*StationId.ToString(), *SectorId.ToString());
+	return true;
+}
+
+void UEconomySimSubsystem::DiscardSector(FName SectorId)
+{
+	Sectors.Remove(SectorId);
+	SectorVisitOrder.Remove(SectorId);
+}
+
+int32 UEconomySimSubsystem::GetSimulatedStock(FName SectorId, FName StationId, FName WareId) const
+{
+	const FSimSector* Sector = Sectors.Find(SectorId);
+	if (!Sector)
+	{
+		return 0;
+	}
+	const FSimStation* Sim = Sector->Stations.FindByPredicate(
+		[StationId](const FSimStation& Station) { return Station.StationId == StationId; });
+	return Sim ? GetStock(*Sim, WareId) : 0;
+}
+
+void UEconomySimSubsystem::SimulateSector(FSimSector& Sector, double DeltaSeconds)
+{
+	Sector.SimTime += DeltaSeconds;
+
+	for (FSimStation& Station : Sector.Stations)
+	{
+		for (FSimTradeOrder& Order : Station.Orders)
+		{
+			if (Order.bIsBuyOrder || !Order.bIsActive)
+			{
+				continue;
+			}
+			const FSimWare* Ware = Station.Wares.Find(Order.WareId);
+			if (!Ware)
+			{
+				continue;
+			}
+
+			// Complete every cycle that came due since the last visit
+			int32 Cycles = 0;
+			while (Order.ProductionDue <= Sector.SimTime && Cycles < MaxCyclesPerVisit)
+			{
+				if (!CanProduce(Station, Order))
+				{
+					// Blocked (inputs/capacity/cap); retry a cycle from now
+					Order.ProductionDue = Sector.SimTime + Ware->ProductionTime;
+					break;
+				}
+				for (const TPair<FName, int32>& Input : Ware->InputWares)
+				{
+					AdjustStock(Station, Input.Key, -Input.Value);
+				}
+				AdjustStock(Station, Order.WareId, 1);
+				Order.ProductionDue += Ware->ProductionTime;
+				Cycles++;
+			}
+		}
+	}
+}
+
+bool UEconomySimSubsystem::CanProduce(const FSimStation& Station, const FSimTradeOrder& Order) const
+{
+	const FSimWare* Ware = Station.Wares.Find(Order.WareId);
+	if (!Ware || GetStock(Station, Order.WareId) >= Order.MaxQuantity)
+	{
+		return false;
+	}
+	if (Station.CurrentUsed + FMath::CeilToInt(Ware->Volume) > Station.MaxCapacity)
+	{
+		return false;
+	}
+	for (const TPair<FName, int32>& Input : Ware->InputWares)
+	{
+		if (GetStock(Station, Input.Key) < Input.Value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+int32 UEconomySimSubsystem::GetStock(const FSimStation& Station, FName WareId)
+{
+	const int32 WareIndex = Station.WareIds.IndexOfByKey(WareId);
+	return Station.Stock.IsValidIndex(WareIndex) ? Station.Stock[WareIndex] : 0;
+}
+
+void UEconomySimSubsystem::AdjustStock(FSimStation& Station, FName WareId, int32 Delta)
+{
+	const int32 WareIndex = Station.WareIds.IndexOfByKey(WareId);
+	if (!Station.Stock.IsValidIndex(WareIndex))
+	{
+		return;
+	}
+	Station.Stock[WareIndex] = FMath::Max(0, Station.Stock[WareIndex] + Delta);
+
+	if (const FSimWare* Ware = Station.Wares.Find(WareId))
+	{
+		Station.CurrentUsed = FMath::Max(0, Station.CurrentUsed + FMath::CeilToInt(Ware->Volume * Delta));
+	}
+}
@@ -0,0 +1,184 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "FlightDynamicsSubsystem.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFlightDynamics, Log, All);
+
+void UFlightDynamicsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (Ships.Num() == 0)
+	{
+		return;
+	}
+
+	// Cap the catch-up after a hitch so we never spiral into doing more
+	// steps per frame than the frame has time for
+	Accumulator += FMath::Min(DeltaTime, 0.25f);
+
+	while (Accumulator >= FixedTimestep)
+	{
+		Accumulator -= FixedTimestep;
+		StepSimulation(FixedTimestep);
+	}
+
+	// Forces are "held for this frame": clear after all substeps consumed them
+	for (FVector& Accel : PendingAccelerations)
+	{
+		Accel = FVector::ZeroVector;
+	}
+
+	// Render at a position interpolated between the last two fixed steps
+	// so motion stays smooth when frame rate and timestep do not divide
+	const float Alpha = Accumulator / FixedTimestep;
+	bool bAnyStale = false;
+
+	for (int32 i = 0; i < Ships.Num(); ++i)
+	{
+		AActor* Ship = Ships[i].Get();
+		if (!Ship)
+		{
+			bAnyStale = true;
+			continue;
+		}
+
+		Ship->SetActorLocation(FMath::Lerp(PrevPositions[i], Positions[i], Alpha));
+	}
+
+	if (bAnyStale)
+	{
+		CompactRegistry();
+	}
+}
+
+TStatId UFlightDynamicsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UFlightDynamicsSubsystem, STATGROUP_Tickables);
+}
+
+void UFlightDynamicsSubsystem::RegisterShip(AActor* Ship, float Mass, float DragCoefficient)
+{
+	if (!Ship || ShipIndexLookup.Contains(Ship))
+	{
+		return;
+	}
+
+	const int32 Index = Ships.Add(Ship);
+	const FVector Location = Ship->GetActorLocation();
+	Positions.Add(Location);
+	PrevPositions.Add(Location);
+	Velocities.Add(FVector::ZeroVector);
+	PendingAccelerations.Add(FVector::ZeroVector);
+	Masses.Add(FMath::Max(Mass, 1.0f));
+	DragCoefficients.Add(DragCoefficient);
+	ShipIndexLookup.Add(Ship, Index);
+
+	UE_LOG(LogFlightDynamics, Verbose, TEXT("FlightDynamics: Registered %s (%d ships)"),
+		*Ship->GetName(), Ships.Num());
+}
+
+void UFlightDynamicsSubsystem::UnregisterShip(AActor* Ship)
+{
+	int32 Index;
+	if (!Ship || !ShipIndexLookup.RemoveAndCopyValue(Ship, Index))
+	{
+		return;
+	}
+
+	// Swap-remove keeps the arrays packed; fix up the moved ship's index
+	Ships.RemoveAtSwap(Index, EAllowShrinking::No);
+	Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+	PrevPositions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	PendingAccelerations.RemoveAtSwap(Index, EAllowShrinking::No);
+	Masses.RemoveAtSwap(Index, EAllowShrinking::No);
+	DragCoefficients.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Ships.IsValidIndex(Index))
+	{
+		ShipIndexLookup.Add(Ships[Index], Index);
+	}
+}
+
+void UFlightDynamicsSubsystem::AddForce(AActor* Ship, const FVector& WorldForce)
+{
+	if (const int32* Index = ShipIndexLookup.Find(Ship))
+	{
+		PendingAccelerations[*Index] += WorldForce / Masses[*Index];
+	}
+}
+
+FVector UFlightDynamicsSubsystem::GetShipVelocity(AActor* Ship) const
+{
+	if (const int32* Index = ShipIndexLookup.Find(Ship))
+	{
+		return Velocities[*Index];
+	}
+	return FVector::ZeroVector;
+}
+
+void UFlightDynamicsSubsystem::SetShipVelocity(AActor* Ship, const FVector& NewVelocity)
+{
+	if (const int32* Index = ShipIndexLookup.Find(Ship))
+	{
+		Velocities[*Index] = NewVelocity;
+	}
+}
+
+void UFlightDynamicsSubsystem::SyncShipTransform(AActor* Ship)
+{
+	const int32* Index = ShipIndexLookup.Find(Ship);
+	if (Index && Ships[*Index].IsValid())
+	{
+		const FVector Location = Ships[*Index]->GetActorLocation();
+		Positions[*Index] = Location;
+		PrevPositions[*Index] = Location;
+	}
+}
+
+void UFlightDynamicsSubsystem::StepSimulation(float StepSeconds)
+{
+	// One pass over parallel arrays: thrust, quadratic drag, integrate.
+	// Same model UpdatePhysics used per-pawn, now batched and fixed-step.
+	const int32 Count = Ships.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		FVector Velocity = Velocities[i] + PendingAccelerations[i] * StepSeconds;
+
+		const float Speed = Velocity.Size();
+		if (Speed > 1.0f)
+		{
+			const FVector DragAccel = -Velocity.GetSafeNormal() * DragCoefficients[i] * Speed * Speed / Masses[i];
+			Velocity += DragAccel * StepSeconds;
+		}
+
+		Velocities[i] = Velocity;
+		PrevPositions[i] = Positions[i];
+		Positions[i] += Velocity * StepSeconds;
+	}
+}
+
+void UFlightDynamicsSubsystem::CompactRegistry()
+{
+	for (int32 i = Ships.Num() - 1; i >= 0; --i)
+	{
+		if (!Ships[i].IsValid())
+		{
+			ShipIndexLookup.Remove(Ships[i]);
+			Ships.RemoveAtSwap(i, EAllowShrinking::No);
+			Positions.RemoveAtSwap(i, EAllowShrinking::No);
+			PrevPositions.RemoveAtSwap(i, EAllowShrinking::No);
+			Velocities.RemoveAtSwap(i, EAllowShrinking::No);
+			PendingAccelerations.RemoveAtSwap(i, EAllowShrinking::No);
+			Masses.RemoveAtSwap(i, EAllowShrinking::No);
+			DragCoefficients.RemoveAtSwap(i, EAllowShrinking::No);
+
+			if (Ships.IsValidIndex(i))
+			{
+				ShipIndexLookup.Add(Ships[i], i);
+			}
+		}
+	}
+}
@@ -0,0 +1,143 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "InitSchedulerSubsystem.h"
+#include "HAL/PlatformTime.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogInitScheduler, Log, All);
+
+TStatId UInitSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UInitSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+void UInitSchedulerSubsystem::EnqueueStage(const FString& Name, int32 Priority, TFunction<bool()> Step)
+{
+	EnqueueStage(Name, Priority, TArray<FString>(), MoveTemp(Step));
+}
+
+void UInitSchedulerSubsystem::EnqueueStage(const FString& Name, int32 Priority, const TArray<FString>& Dependencies, TFunction<bool()> Step)
+{
+	if (!Step)
+	{
+		return;
+	}
+
+	FInitStage Stage;
+	Stage.Name = Name;
+	Stage.Priority = Priority;
+	Stage.Dependencies = Dependencies;
+	Stage.Step = MoveTemp(Step);
+
+	// Steps may enqueue follow-up stages while running; buffer those so
+	// the array never reallocates under the executing step
+	(bTicking ? PendingStages : Stages).Add(MoveTemp(Stage));
+}
+
+float UInitSchedulerSubsystem::GetProgress() const
+{
+	return Stages.Num() > 0 ? (float)CompletedStages / Stages.Num() : 1.0f;
+}
+
+FInitStage* UInitSchedulerSubsystem::PickRunnableStage()
+{
+	FInitStage* Best = nullptr;
+	FInitStage* BestIgnoringDeps = nullptr;
+	for (FInitStage& Stage : Stages)
+	{
+		if (Stage.bComplete)
+		{
+			continue;
+		}
+		if (!BestIgnoringDeps || Stage.Priority < BestIgnoringDeps->Priority)
+		{
+			BestIgnoringDeps = &Stage;
+		}
+
+		// An unregistered dependency name counts as satisfied - stages
+		// should not deadlock on a stage that was never enqueued
+		bool bBlocked = false;
+		for (const FString& Dependency : Stage.Dependencies)
+		{
+			for (const FInitStage& Other : Stages)
+			{
+				if (!Other.bComplete && Other.Name == Dependency && &Other != &Stage)
+				{
+					bBlocked = true;
+					break;
+				}
+			}
+			if (bBlocked)
+			{
+				break;
+			}
+		}
+		if (!bBlocked && (!Best || Stage.Priority < Best->Priority))
+		{
+			Best = &Stage;
+		}
+	}
+
+	// Incomplete stages with no runnable candidate means a dependency
+	// cycle; run in plain priority order rather than hanging the load
+	if (!Best && BestIgnoringDeps)
+	{
+		if (!bWarnedCycle)
+		{
+			bWarnedCycle = true;
+			UE_LOG(LogInitScheduler, Warning, TEXT("Dependency cycle among init stages; falling back to priority order at '%s'"),
+				*BestIgnoringDeps->Name);
+		}
+		Best = BestIgnoringDeps;
+	}
+	return Best;
+}
+
+void UInitSchedulerSubsystem::Tick(float DeltaTime)
+{
+	if (Stages.Num() == 0)
+	{
+		return;
+	}
+
+	// Run steps until the budget is spent. The first step always runs,
+	// so even a budget-blowing step only costs its own frame and the
+	// schedule keeps moving.
+	const double EndTime = FPlatformTime::Seconds() + FrameBudgetMs / 1000.0;
+	bTicking = true;
+	do
+	{
+		FInitStage* Stage = PickRunnableStage();
+		if (!Stage)
+		{
+			break;
+		}
+		CurrentStageName = Stage->Name;
+		if (Stage->Step())
+		{
+			Stage->bComplete = true;
+			CompletedStages++;
+			UE_LOG(LogInitScheduler, Log, TEXT("Init stage complete: %s (%d/%d)"),
+				*Stage->Name, CompletedStages, Stages.Num() + PendingStages.Num());
+			OnStageProgress.Broadcast(Stage->Name, GetProgress());
+		}
+	}
+	while (FPlatformTime::Seconds() < EndTime);
+	bTicking = false;
+
+	if (PendingStages.Num() > 0)
+	{
+		Stages.Append(MoveTemp(PendingStages));
+		PendingStages.Reset();
+	}
+
+	// Batch done: reset so a later batch (sector transition) reports
+	// progress from zero again
+	if (CompletedStages == Stages.Num())
+	{
+		UE_LOG(LogInitScheduler, Log, TEXT("World initialization complete (%d stages)"), CompletedStages);
+		Stages.Empty();
+		CompletedStages = 0;
+		bWarnedCycle = false;
+		OnInitComplete.Broadcast();
+	}
+}
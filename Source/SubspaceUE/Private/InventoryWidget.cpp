@@ -4,10 +4,78 @@
 
 void UInventoryWidget::UpdateInventory(const TArray<FResourceEntry>& Resources)
 {
+	// Diff against the current entries rather than rebuilding: wares not
+	// in the new snapshot are removed, the rest route through the
+	// per-ware delta path so unchanged rows are never touched
+	TSet<FString> SeenNames;
+	SeenNames.Reserve(Resources.Num());
+	for (const FResourceEntry& Resource : Resources)
+	{
+		SeenNames.Add(Resource.ResourceName);
+	}
+
+	for (int32 Index = EntryItems.Num() - 1; Index >= 0; --Index)
+	{
+		if (!SeenNames.Contains(EntryItems[Index]->Entry.ResourceName))
+		{
+			SetResourceQuantity(EntryItems[Index]->Entry.ResourceName, 0, FColor::White);
+		}
+	}
+
+	for (const FResourceEntry& Resource : Resources)
+	{
+		SetResourceQuantity(Resource.ResourceName, Resource.Quantity, Resource.ResourceColor);
+	}
+
 	CachedResources = Resources;
 	OnInventoryUpdated(Resources);
 }
 
+void UInventoryWidget::SetResourceQuantity(const FString& ResourceName, int32 Quantity, FColor ResourceColor)
+{
+	const int32* ExistingIndex = EntryIndexLookup.Find(ResourceName);
+
+	if (Quantity <= 0)
+	{
+		if (!ExistingIndex)
+		{
+			return;
+		}
+
+		// Ware ran out: swap-remove its item and fix up the moved index
+		const int32 Index = *ExistingIndex;
+		UInventoryEntryItem* Removed = EntryItems[Index];
+		EntryItems.RemoveAtSwap(Index, EAllowShrinking::No);
+		EntryIndexLookup.Remove(ResourceName);
+		if (EntryItems.IsValidIndex(Index))
+		{
+			EntryIndexLookup.Add(EntryItems[Index]->Entry.ResourceName, Index);
+		}
+		OnEntryRemoved(Removed);
+		return;
+	}
+
+	if (ExistingIndex)
+	{
+		// One stock update touches one row: mutate the item in place and
+		// let its bound row widget react
+		UInventoryEntryItem* Item = EntryItems[*ExistingIndex];
+		if (Item->Entry.Quantity == Quantity && Item->Entry.ResourceColor == ResourceColor)
+		{
+			return;
+		}
+		Item->Entry.Quantity = Quantity;
+		Item->Entry.ResourceColor = ResourceColor;
+		Item->OnChanged.Broadcast(Item);
+		return;
+	}
+
+	UInventoryEntryItem* Item = NewObject<UInventoryEntryItem>(this);
+	Item->Entry = FResourceEntry(ResourceName, Quantity, ResourceColor);
+	EntryIndexLookup.Add(ResourceName, EntryItems.Add(Item));
+	OnEntryAdded(Item);
+}
+
 void UInventoryWidget::UpdateCargoCapacity(int32 CurrentCargo, int32 MaxCargo)
 {
 	CachedCurrentCargo = CurrentCargo;
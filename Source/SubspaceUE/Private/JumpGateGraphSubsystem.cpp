@@ -0,0 +1,187 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "JumpGateGraphSubsystem.h"
+#include "Algo/Reverse.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogJumpGateGraph, Log, All);
+
+namespace
+{
+	/** Dijkstra frontier entry */
+	struct FFrontierNode
+	{
+		float Time = 0.0f;
+		FName Sector;
+	};
+
+	/** Smallest time first */
+	struct FFrontierOrder
+	{
+		bool operator()(const FFrontierNode& A, const FFrontierNode& B) const
+		{
+			return A.Time < B.Time;
+		}
+	};
+}
+
+void UJumpGateGraphSubsystem::RegisterSectorGates(FName SectorId, const TArray<FJumpGateData>& Gates)
+{
+	TArray<FGateEdge>& Edges = Adjacency.FindOrAdd(SectorId);
+	for (const FJumpGateData& Gate : Gates)
+	{
+		FGateEdge Edge;
+		Edge.ToSector = FName(*Gate.ConnectedSectorId);
+		Edge.GateName = Gate.GateName;
+		Edge.GateLocation = Gate.Location;
+		Edge.bLocked = Gate.bIsLocked;
+		Edges.Add(Edge);
+
+		// Make sure the far sector exists as a node even if its own
+		// gates register later
+		Adjacency.FindOrAdd(Edge.ToSector);
+	}
+
+	RouteTables.Empty();
+	UE_LOG(LogJumpGateGraph, Log, TEXT("JumpGateGraph: Registered %d gates for sector %s (%d sectors total)"),
+		Gates.Num(), *SectorId.ToString(), Adjacency.Num());
+}
+
+void UJumpGateGraphSubsystem::SetGateLocked(FName SectorId, const FString& GateName, bool bLocked)
+{
+	TArray<FGateEdge>* Edges = Adjacency.Find(SectorId);
+	if (!Edges)
+	{
+		return;
+	}
+
+	for (FGateEdge& Edge : *Edges)
+	{
+		if (Edge.GateName == GateName && Edge.bLocked != bLocked)
+		{
+			Edge.bLocked = bLocked;
+			// Cached tables are stale; rebuild lazily on next query
+			RouteTables.Empty();
+			UE_LOG(LogJumpGateGraph, Log, TEXT("JumpGateGraph: Gate %s in %s now %s"),
+				*GateName, *SectorId.ToString(), bLocked ? TEXT("locked") : TEXT("unlocked"));
+		}
+	}
+}
+
+TArray<FRouteHop> UJumpGateGraphSubsystem::PlanRoute(FName FromSector, FName ToSector)
+{
+	TArray<FRouteHop> Route;
+	if (FromSector == ToSector || !Adjacency.Contains(FromSector) || !Adjacency.Contains(ToSector))
+	{
+		return Route;
+	}
+
+	const FRouteTable& Table = GetRouteTable(FromSector);
+	if (!Table.Time.Contains(ToSector))
+	{
+		return Route;
+	}
+
+	// Walk predecessors back to the source, then reverse into hop order
+	TArray<FName> Chain;
+	for (FName Sector = ToSector; Sector != FromSector; Sector = Table.PrevSector[Sector])
+	{
+		Chain.Add(Sector);
+	}
+	Chain.Add(FromSector);
+	Algo::Reverse(Chain);
+
+	for (int32 i = 0; i < Chain.Num() - 1; i++)
+	{
+		const FGateEdge* Edge = FindEdge(Chain[i], Chain[i + 1]);
+		if (!Edge)
+		{
+			// Graph changed between table build and reconstruction
+			Route.Reset();
+			return Route;
+		}
+		FRouteHop Hop;
+		Hop.FromSector = Chain[i];
+		Hop.ToSector = Chain[i + 1];
+		Hop.GateName = Edge->GateName;
+		Hop.GateLocation = Edge->GateLocation;
+		Route.Add(Hop);
+	}
+	return Route;
+}
+
+float UJumpGateGraphSubsystem::GetRouteTime(FName FromSector, FName ToSector)
+{
+	if (FromSector == ToSector)
+	{
+		return 0.0f;
+	}
+	if (!Adjacency.Contains(FromSector))
+	{
+		return -1.0f;
+	}
+	const float* Time = GetRouteTable(FromSector).Time.Find(ToSector);
+	return Time ? *Time : -1.0f;
+}
+
+const UJumpGateGraphSubsystem::FRouteTable& UJumpGateGraphSubsystem::GetRouteTable(FName FromSector)
+{
+	if (FRouteTable* Cached = RouteTables.Find(FromSector))
+	{
+		return *Cached;
+	}
+
+	// Dijkstra over unlocked edges; one run serves every route request
+	// from this source until a gate changes
+	FRouteTable& Table = RouteTables.Add(FromSector);
+	Table.Time.Add(FromSector, 0.0f);
+
+	TArray<FFrontierNode> Frontier;
+	Frontier.HeapPush(FFrontierNode{ 0.0f, FromSector }, FFrontierOrder());
+
+	while (Frontier.Num() > 0)
+	{
+		FFrontierNode Node;
+		Frontier.HeapPop(Node, FFrontierOrder(), EAllowShrinking::No);
+
+		// Stale entry: a shorter path already settled this sector
+		if (Node.Time > Table.Time[Node.Sector])
+		{
+			continue;
+		}
+
+		const TArray<FGateEdge>* Edges = Adjacency.Find(Node.Sector);
+		if (!Edges)
+		{
+			continue;
+		}
+		for (const FGateEdge& Edge : *Edges)
+		{
+			if (Edge.bLocked)
+			{
+				continue;
+			}
+			const float NewTime = Node.Time + Edge.TraversalTime;
+			const float* KnownTime = Table.Time.Find(Edge.ToSector);
+			if (!KnownTime || NewTime < *KnownTime)
+			{
+				Table.Time.Add(Edge.ToSector, NewTime);
+				Table.PrevSector.Add(Edge.ToSector, Node.Sector);
+				Frontier.HeapPush(FFrontierNode{ NewTime, Edge.ToSector }, FFrontierOrder());
+			}
+		}
+	}
+	return Table;
+}
+
+const FGateEdge* UJumpGateGraphSubsystem::FindEdge(FName FromSector, FName ToSector) const
+{
+	const TArray<FGateEdge>* Edges = Adjacency.Find(FromSector);
+	if (!Edges)
+	{
+		return nullptr;
+	}
+	return Edges->FindByPredicate([ToSector](const FGateEdge& Edge)
+	{
+		return !Edge.bLocked && Edge.ToSector == ToSector;
+	});
+}
@@ -0,0 +1,192 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "LightRelevanceSubsystem.h"
+#include "SpaceLightingActor.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/LightComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogLightRelevance, Log, All);
+
+TStatId ULightRelevanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(ULightRelevanceSubsystem, STATGROUP_Tickables);
+}
+
+void ULightRelevanceSubsystem::RegisterLight(ASpaceLightingActor* Light)
+{
+	if (!Light)
+	{
+		return;
+	}
+
+	for (const FManagedLight& Managed : ManagedLights)
+	{
+		if (Managed.Actor == Light)
+		{
+			return;
+		}
+	}
+
+	FManagedLight Managed;
+	Managed.Actor = Light;
+
+	// Capture the authored intensities once; fades scale against these
+	TArray<ULightComponent*> Components;
+	Light->GetComponents<ULightComponent>(Components);
+	for (ULightComponent* Component : Components)
+	{
+		Managed.LightComponents.Add(Component);
+		Managed.BaseIntensities.Add(Component->Intensity);
+		Managed.TotalBaseIntensity += Component->Intensity;
+	}
+
+	ManagedLights.Add(MoveTemp(Managed));
+}
+
+void ULightRelevanceSubsystem::UnregisterLight(ASpaceLightingActor* Light)
+{
+	for (int32 Index = 0; Index < ManagedLights.Num(); ++Index)
+	{
+		if (ManagedLights[Index].Actor == Light)
+		{
+			ManagedLights.RemoveAtSwap(Index, EAllowShrinking::No);
+			return;
+		}
+	}
+}
+
+int32 ULightRelevanceSubsystem::GetRelevantLightCount() const
+{
+	int32 Count = 0;
+	for (const FManagedLight& Managed : ManagedLights)
+	{
+		if (Managed.bRelevant)
+		{
+			++Count;
+		}
+	}
+	return Count;
+}
+
+void ULightRelevanceSubsystem::Tick(float DeltaTime)
+{
+	if (ManagedLights.Num() == 0)
+	{
+		return;
+	}
+
+	RankTimer -= DeltaTime;
+	if (RankTimer <= 0.0f)
+	{
+		RankTimer = RankInterval;
+		RankLights();
+	}
+
+	UpdateFades(DeltaTime);
+}
+
+void ULightRelevanceSubsystem::RankLights()
+{
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController || !PlayerController->PlayerCameraManager)
+	{
+		return;
+	}
+	const FVector CameraLocation = PlayerController->PlayerCameraManager->GetCameraLocation();
+
+	// Score every live managed light, compacting stale entries in place.
+	// Always-relevant lights (suns) bypass scoring entirely.
+	struct FScoredLight
+	{
+		int32 ManagedIndex = INDEX_NONE;
+		float Score = 0.0f;
+	};
+	TArray<FScoredLight> Scored;
+	Scored.Reserve(ManagedLights.Num());
+
+	for (int32 Index = 0; Index < ManagedLights.Num(); ++Index)
+	{
+		FManagedLight& Managed = ManagedLights[Index];
+		ASpaceLightingActor* Light = Managed.Actor.Get();
+		if (!Light)
+		{
+			ManagedLights.RemoveAtSwap(Index, EAllowShrinking::No);
+			--Index;
+			continue;
+		}
+
+		if (Light->bAlwaysRelevant)
+		{
+			Managed.bRelevant = true;
+			Managed.TargetScale = 1.0f;
+			continue;
+		}
+
+		const float Distance = FVector::Dist(CameraLocation, Light->GetActorLocation());
+		if (Distance > Light->RelevanceRange)
+		{
+			Managed.bRelevant = false;
+			Managed.TargetScale = 0.0f;
+			continue;
+		}
+
+		// Nearest and brightest rank first; incumbents get the
+		// hysteresis bonus so boundary lights do not pop
+		float Score = Managed.TotalBaseIntensity / FMath::Max(Distance, 1.0f);
+		if (Managed.bRelevant)
+		{
+			Score *= HysteresisBonus;
+		}
+		Scored.Add({ Index, Score });
+	}
+
+	Scored.Sort([](const FScoredLight& A, const FScoredLight& B) { return A.Score > B.Score; });
+
+	for (int32 Rank = 0; Rank < Scored.Num(); ++Rank)
+	{
+		FManagedLight& Managed = ManagedLights[Scored[Rank].ManagedIndex];
+		const bool bKeep = Rank < MaxRelevantLights;
+		Managed.bRelevant = bKeep;
+		Managed.TargetScale = bKeep ? 1.0f : 0.0f;
+	}
+}
+
+void ULightRelevanceSubsystem::UpdateFades(float DeltaTime)
+{
+	for (FManagedLight& Managed : ManagedLights)
+	{
+		if (Managed.CurrentScale == Managed.TargetScale)
+		{
+			continue;
+		}
+
+		const float PreviousScale = Managed.CurrentScale;
+		Managed.CurrentScale = FMath::FInterpConstantTo(Managed.CurrentScale, Managed.TargetScale, DeltaTime, FadeSpeed);
+
+		for (int32 ComponentIndex = 0; ComponentIndex < Managed.LightComponents.Num(); ++ComponentIndex)
+		{
+			ULightComponent* Component = Managed.LightComponents[ComponentIndex].Get();
+			if (!Component)
+			{
+				continue;
+			}
+
+			// Coming up from dark, make the component visible before the
+			// first scaled intensity lands; at zero, hide it so the GPU
+			// never sees the light again
+			if (PreviousScale <= 0.0f && Managed.CurrentScale > 0.0f)
+			{
+				Component->SetVisibility(true);
+			}
+
+			Component->SetIntensity(Managed.BaseIntensities[ComponentIndex] * Managed.CurrentScale);
+
+			if (Managed.CurrentScale <= 0.0f)
+			{
+				Component->SetVisibility(false);
+			}
+		}
+	}
+}
@@ -2,17 +2,60 @@
 
 #include "MainHUDWidget.h"
 
+namespace
+{
+	// Preparsed format patterns, shared by every widget instance; parsing
+	// the pattern string on each update was most of the formatting cost
+	const FTextFormat& CurrentOverMaxFormat()
+	{
+		static const FTextFormat Format = FText::FromString(TEXT("{0} / {1}"));
+		return Format;
+	}
+
+	const FTextFormat& SpeedFormat()
+	{
+		static const FTextFormat Format = FText::FromString(TEXT("Speed: {0} / {1} m/s"));
+		return Format;
+	}
+
+	const FTextFormat& VelocityFormat()
+	{
+		static const FTextFormat Format = FText::FromString(TEXT("Velocity: {0}, {1}, {2}"));
+		return Format;
+	}
+
+	const FTextFormat& PositionFormat()
+	{
+		static const FTextFormat Format = FText::FromString(TEXT("Pos: {0}, {1}, {2}"));
+		return Format;
+	}
+
+	const FTextFormat& TargetFormat()
+	{
+		static const FTextFormat Format = FText::FromString(TEXT("Target: {0} ({1}m)"));
+		return Format;
+	}
+}
+
 void UMainHUDWidget::UpdateHealth(float CurrentHealth, float MaxHealth)
 {
 	CachedHealth = CurrentHealth;
 	CachedMaxHealth = MaxHealth;
 
+	// Only re-format and fire the Blueprint event when the displayed
+	// (rounded) numbers actually change
+	const int32 Health = FMath::RoundToInt(CurrentHealth);
+	const int32 Max = FMath::RoundToInt(MaxHealth);
+	if (Health == DisplayedHealth && Max == DisplayedMaxHealth)
+	{
+		return;
+	}
+	DisplayedHealth = Health;
+	DisplayedMaxHealth = Max;
+
 	float HealthPercent = MaxHealth > 0.0f ? (CurrentHealth / MaxHealth) : 0.0f;
-	FText HealthText = FText::Format(
-		FText::FromString(TEXT("{0} / {1}")),
-		FText::AsNumber(FMath::RoundToInt(CurrentHealth)),
-		FText::AsNumber(FMath::RoundToInt(MaxHealth))
-	);
+	FText HealthText = FText::Format(CurrentOverMaxFormat(),
+		FText::AsNumber(Health), FText::AsNumber(Max));
 
 	OnHealthUpdated(HealthPercent, HealthText);
 }
@@ -22,12 +65,18 @@ void UMainHUDWidget::UpdateShield(float CurrentShield, float MaxShield)
 	CachedShield = CurrentShield;
 	CachedMaxShield = MaxShield;
 
+	const int32 Shield = FMath::RoundToInt(CurrentShield);
+	const int32 Max = FMath::RoundToInt(MaxShield);
+	if (Shield == DisplayedShield && Max == DisplayedMaxShield)
+	{
+		return;
+	}
+	DisplayedShield = Shield;
+	DisplayedMaxShield = Max;
+
 	float ShieldPercent = MaxShield > 0.0f ? (CurrentShield / MaxShield) : 0.0f;
-	FText ShieldText = FText::Format(
-		FText::FromString(TEXT("{0} / {1}")),
-		FText::AsNumber(FMath::RoundToInt(CurrentShield)),
-		FText::AsNumber(FMath::RoundToInt(MaxShield))
-	);
+	FText ShieldText = FText::Format(CurrentOverMaxFormat(),
+		FText::AsNumber(Shield), FText::AsNumber(Max));
 
 	OnShieldUpdated(ShieldPercent, ShieldText);
 }
@@ -37,23 +86,35 @@ void UMainHUDWidget::UpdateEnergy(float CurrentEnergy, float MaxEnergy)
 	CachedEnergy = CurrentEnergy;
 	CachedMaxEnergy = MaxEnergy;
 
+	const int32 Energy = FMath::RoundToInt(CurrentEnergy);
+	const int32 Max = FMath::RoundToInt(MaxEnergy);
+	if (Energy == DisplayedEnergy && Max == DisplayedMaxEnergy)
+	{
+		return;
+	}
+	DisplayedEnergy = Energy;
+	DisplayedMaxEnergy = Max;
+
 	float EnergyPercent = MaxEnergy > 0.0f ? (CurrentEnergy / MaxEnergy) : 0.0f;
-	FText EnergyText = FText::Format(
-		FText::FromString(TEXT("{0} / {1}")),
-		FText::AsNumber(FMath::RoundToInt(CurrentEnergy)),
-		FText::AsNumber(FMath::RoundToInt(MaxEnergy))
-	);
+	FText EnergyText = FText::Format(CurrentOverMaxFormat(),
+		FText::AsNumber(Energy), FText::AsNumber(Max));
 
 	OnEnergyUpdated(EnergyPercent, EnergyText);
 }
 
 void UMainHUDWidget::UpdateSpeed(float CurrentSpeed, float MaxSpeed)
 {
-	FText SpeedText = FText::Format(
-		FText::FromString(TEXT("Speed: {0} / {1} m/s")),
-		FText::AsNumber(FMath::RoundToInt(CurrentSpeed)),
-		FText::AsNumber(FMath::RoundToInt(MaxSpeed))
-	);
+	const int32 Speed = FMath::RoundToInt(CurrentSpeed);
+	const int32 Max = FMath::RoundToInt(MaxSpeed);
+	if (Speed == DisplayedSpeed && Max == DisplayedMaxSpeed)
+	{
+		return;
+	}
+	DisplayedSpeed = Speed;
+	DisplayedMaxSpeed = Max;
+
+	FText SpeedText = FText::Format(SpeedFormat(),
+		FText::AsNumber(Speed), FText::AsNumber(Max));
 
 	OnSpeedUpdated(SpeedText);
 }
@@ -62,12 +123,18 @@ void UMainHUDWidget::UpdateVelocity(const FVector& Velocity)
 {
 	CachedVelocity = Velocity;
 
-	FText VelocityText = FText::Format(
-		FText::FromString(TEXT("Velocity: {0}, {1}, {2}")),
-		FText::AsNumber(FMath::RoundToInt(Velocity.X)),
-		FText::AsNumber(FMath::RoundToInt(Velocity.Y)),
-		FText::AsNumber(FMath::RoundToInt(Velocity.Z))
-	);
+	const FIntVector Rounded(
+		FMath::RoundToInt(Velocity.X),
+		FMath::RoundToInt(Velocity.Y),
+		FMath::RoundToInt(Velocity.Z));
+	if (Rounded == DisplayedVelocity)
+	{
+		return;
+	}
+	DisplayedVelocity = Rounded;
+
+	FText VelocityText = FText::Format(VelocityFormat(),
+		FText::AsNumber(Rounded.X), FText::AsNumber(Rounded.Y), FText::AsNumber(Rounded.Z));
 
 	OnVelocityUpdated(VelocityText);
 }
@@ -76,28 +143,42 @@ void UMainHUDWidget::UpdatePosition(const FVector& Position)
 {
 	CachedPosition = Position;
 
-	FText PositionText = FText::Format(
-		FText::FromString(TEXT("Pos: {0}, {1}, {2}")),
-		FText::AsNumber(FMath::RoundToInt(Position.X)),
-		FText::AsNumber(FMath::RoundToInt(Position.Y)),
-		FText::AsNumber(FMath::RoundToInt(Position.Z))
-	);
+	const FIntVector Rounded(
+		FMath::RoundToInt(Position.X),
+		FMath::RoundToInt(Position.Y),
+		FMath::RoundToInt(Position.Z));
+	if (Rounded == DisplayedPosition)
+	{
+		return;
+	}
+	DisplayedPosition = Rounded;
+
+	FText PositionText = FText::Format(PositionFormat(),
+		FText::AsNumber(Rounded.X), FText::AsNumber(Rounded.Y), FText::AsNumber(Rounded.Z));
 
 	OnPositionUpdated(PositionText);
 }
 
 void UMainHUDWidget::UpdateTarget(const FString& TargetName, float Distance)
 {
-	FText TargetText = FText::Format(
-		FText::FromString(TEXT("Target: {0} ({1}m)")),
+	const int32 RoundedDistance = FMath::RoundToInt(Distance);
+	if (TargetName == DisplayedTargetName && RoundedDistance == DisplayedTargetDistance)
+	{
+		return;
+	}
+	DisplayedTargetName = TargetName;
+	DisplayedTargetDistance = RoundedDistance;
+
+	FText TargetText = FText::Format(TargetFormat(),
 		FText::FromString(TargetName),
-		FText::AsNumber(FMath::RoundToInt(Distance))
-	);
+		FText::AsNumber(RoundedDistance));
 
 	OnTargetUpdated(TargetText);
 }
 
 void UMainHUDWidget::ClearTarget()
 {
+	DisplayedTargetName.Reset();
+	DisplayedTargetDistance = MIN_int32;
 	OnTargetCleared();
 }
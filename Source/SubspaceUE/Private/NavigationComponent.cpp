@@ -1,12 +1,144 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "NavigationComponent.h"
+#include "SubspaceStats.h"
+#include "DockingCorridorComponent.h"
+#include "SpatialPartitionSubsystem.h"
 #include "GameFramework/Actor.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogNavigation, Log, All);
 
+namespace
+{
+	/** Sector-wide cap on avoidance queries per frame; ships over budget
+	    keep flying their cached solution and retry next frame */
+	constexpr int32 MaxAvoidanceQueriesPerFrame = 8;
+
+	bool ClaimAvoidanceQueryBudget()
+	{
+		static uint64 BudgetFrame = 0;
+		static int32 QueriesThisFrame = 0;
+		if (GFrameCounter != BudgetFrame)
+		{
+			BudgetFrame = GFrameCounter;
+			QueriesThisFrame = 0;
+		}
+		return QueriesThisFrame++ < MaxAvoidanceQueriesPerFrame;
+	}
+
+	/** Catmull-Rom interpolation between P1 and P2 */
+	FVector CatmullRom(const FVector& P0, const FVector& P1, const FVector& P2, const FVector& P3, float T)
+	{
+		const float T2 = T * T;
+		const float T3 = T2 * T;
+		return 0.5f * ((2.0f * P1) +
+			(-P0 + P2) * T +
+			(2.0f * P0 - 5.0f * P1 + 4.0f * P2 - P3) * T2 +
+			(-P0 + 3.0f * P1 - 3.0f * P2 + P3) * T3);
+	}
+
+	/** Spline samples per control-point segment */
+	constexpr int32 SamplesPerSegment = 8;
+}
+
+// ===== FNavTrajectory =====
+
+void FNavTrajectory::BuildFromSpline(const TArray<FVector>& ControlPoints, float InSpeed)
+{
+	SamplePoints.Reset();
+	CumulativeLength.Reset();
+	TotalLength = 0.0f;
+	Speed = InSpeed;
+	DistanceAlong = 0.0f;
+	bActive = false;
+
+	if (ControlPoints.Num() < 2)
+	{
+		return;
+	}
+
+	// Sample each segment of the Catmull-Rom spline, clamping end tangents
+	SamplePoints.Reserve((ControlPoints.Num() - 1) * SamplesPerSegment + 1);
+	SamplePoints.Add(ControlPoints[0]);
+	for (int32 Segment = 0; Segment < ControlPoints.Num() - 1; Segment++)
+	{
+		const FVector& P0 = ControlPoints[FMath::Max(Segment - 1, 0)];
+		const FVector& P1 = ControlPoints[Segment];
+		const FVector& P2 = ControlPoints[Segment + 1];
+		const FVector& P3 = ControlPoints[FMath::Min(Segment + 2, ControlPoints.Num() - 1)];
+
+		for (int32 Sample = 1; Sample <= SamplesPerSegment; Sample++)
+		{
+			SamplePoints.Add(CatmullRom(P0, P1, P2, P3, (float)Sample / SamplesPerSegment));
+		}
+	}
+
+	CumulativeLength.Reserve(SamplePoints.Num());
+	CumulativeLength.Add(0.0f);
+	for (int32 i = 1; i < SamplePoints.Num(); i++)
+	{
+		TotalLength += FVector::Dist(SamplePoints[i - 1], SamplePoints[i]);
+		CumulativeLength.Add(TotalLength);
+	}
+	bActive = TotalLength > 0.0f;
+}
+
+void FNavTrajectory::BuildStraightLine(const FVector& Start, const FVector& End, float InSpeed)
+{
+	SamplePoints = { Start, End };
+	TotalLength = FVector::Dist(Start, End);
+	CumulativeLength = { 0.0f, TotalLength };
+	Speed = InSpeed;
+	DistanceAlong = 0.0f;
+	bActive = TotalLength > 0.0f;
+}
+
+FVector FNavTrajectory::Evaluate(float Distance) const
+{
+	if (SamplePoints.Num() == 0)
+	{
+		return FVector::ZeroVector;
+	}
+	if (Distance <= 0.0f)
+	{
+		return SamplePoints[0];
+	}
+	if (Distance >= TotalLength)
+	{
+		return SamplePoints.Last();
+	}
+
+	// Binary search the arc-length table, then lerp within the segment
+	int32 Low = 0;
+	int32 High = CumulativeLength.Num() - 1;
+	while (High - Low > 1)
+	{
+		const int32 Mid = (Low + High) / 2;
+		if (CumulativeLength[Mid] <= Distance)
+		{
+			Low = Mid;
+		}
+		else
+		{
+			High = Mid;
+		}
+	}
+
+	const float SegmentLength = CumulativeLength[High] - CumulativeLength[Low];
+	const float Alpha = SegmentLength > 0.0f ? (Distance - CumulativeLength[Low]) / SegmentLength : 0.0f;
+	return FMath::Lerp(SamplePoints[Low], SamplePoints[High], Alpha);
+}
+
+FVector FNavTrajectory::TangentAt(float Distance) const
+{
+	const float Step = FMath::Max(TotalLength * 0.001f, 1.0f);
+	const FVector Ahead = Evaluate(FMath::Min(Distance + Step, TotalLength));
+	const FVector Behind = Evaluate(FMath::Max(Distance - Step, 0.0f));
+	return (Ahead - Behind).GetSafeNormal();
+}
+
 UNavigationComponent::UNavigationComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
@@ -16,40 +148,70 @@ UNavigationComponent::UNavigationComponent()
 void UNavigationComponent::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
 	// Initialize boost fuel to full
 	BoostFuel = MaxBoostFuel;
+
+	if (UWorld* World = GetWorld())
+	{
+		SpatialPartition = World->GetSubsystem<USpatialPartitionSubsystem>();
+	}
+
+	// Stagger decision updates so ships don't all decide on the same frame
+	SteeringDecisionTimer = FMath::FRandRange(0.0f, SteeringDecisionInterval);
 }
 
 void UNavigationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	// Update autopilot
+
+	SCOPE_CYCLE_COUNTER(STAT_SubspaceNavigationTick);
+	CSV_SCOPED_TIMING_STAT(Subspace, NavigationTick);
+
+	// Cheap per-frame step: state machine, arrival checks, cached steering
 	if (AutopilotState != EAutopilotState::Inactive)
 	{
 		UpdateAutopilot(DeltaTime);
 	}
-	
+
 	// Update travel drive
 	if (CurrentTravelMode == ETravelMode::TravelDrive || AutopilotState == EAutopilotState::TravelDriveCharging)
 	{
 		UpdateTravelDrive(DeltaTime);
 	}
-	
+
+	// Ships on a precomputed trajectory just evaluate it at t; docking
+	// corridors ride the same machinery as travel drive and highways
+	if (ActiveTrajectory.bActive &&
+	    (CurrentTravelMode == ETravelMode::TravelDrive || CurrentTravelMode == ETravelMode::Highway ||
+	     AutopilotState == EAutopilotState::ApproachingDock))
+	{
+		UpdateTrajectory(DeltaTime);
+	}
+
 	// Update boost fuel
 	UpdateBoostFuel(DeltaTime);
-	
+
 	// Apply flight assist
 	if (FlightAssist.bFlightAssistEnabled || FlightAssist.bAutoRollEnabled || FlightAssist.bCollisionAvoidanceEnabled)
 	{
 		ApplyFlightAssist(DeltaTime);
 	}
-	
-	// Check collision avoidance
-	if (FlightAssist.bCollisionAvoidanceEnabled)
+
+	// Expensive decision step: runs on its own interval and a sector-wide
+	// query budget; between decisions we fly the cached solution
+	// Corridor-locked ships skip steering decisions entirely: the path
+	// was validated against station geometry once at bake time
+	const bool bOnDockingCorridor = ActiveTrajectory.bActive &&
+		AutopilotState == EAutopilotState::ApproachingDock;
+
+	SteeringDecisionTimer -= DeltaTime;
+	if (SteeringDecisionTimer <= 0.0f && AutopilotState != EAutopilotState::Inactive && !bOnDockingCorridor)
 	{
-		UpdateCollisionAvoidance(DeltaTime);
+		if (UpdateSteeringDecision())
+		{
+			SteeringDecisionTimer = SteeringDecisionInterval;
+		}
 	}
 }
 
@@ -136,7 +298,8 @@ void UNavigationComponent::CancelTravelDrive()
 	
 	TravelDriveTimer = 0.0f;
 	TravelDriveCharge = 0.0f;
-	
+	ActiveTrajectory.bActive = false;
+
 	UE_LOG(LogNavigation, Log, TEXT("Travel drive cancelled"));
 }
 
@@ -189,6 +352,11 @@ void UNavigationComponent::StartAutopilotToActor(AActor* TargetActor, bool bUseT
 	Waypoint.bUseTravelDrive = bUseTravelDrive;
 	Waypoint.bDockOnArrival = bDockOnArrival;
 	Waypoint.ArrivalRadius = 200.0f;
+
+	// Seed the tracking state so the first dead-reckoned frames hold
+	// position until the second sample estimates a velocity
+	Waypoint.SampledTargetLocation = Waypoint.Location;
+	Waypoint.bHasTargetSample = true;
 	
 	WaypointQueue.Empty();
 	WaypointQueue.Add(Waypoint);
@@ -235,15 +403,10 @@ float UNavigationComponent::GetDistanceToWaypoint() const
 		return 0.0f;
 	}
 	
+	// Location is kept fresh by UpdateTargetTracking for follow
+	// waypoints, so no actor dereference is needed here
 	const FNavigationWaypoint& Waypoint = WaypointQueue[0];
-	FVector CurrentLocation = GetOwner()->GetActorLocation();
-	
-	if (Waypoint.TargetActor)
-	{
-		return FVector::Dist(CurrentLocation, Waypoint.TargetActor->GetActorLocation());
-	}
-	
-	return FVector::Dist(CurrentLocation, Waypoint.Location);
+	return FVector::Dist(GetOwner()->GetActorLocation(), Waypoint.Location);
 }
 
 // ===== Flight Assist =====
@@ -308,15 +471,58 @@ bool UNavigationComponent::EnterHighway()
 	return true;
 }
 
+bool UNavigationComponent::EnterHighwayRoute(const FHighwayData& Highway)
+{
+	if (Highway.PathPoints.Num() < 2 || CurrentTravelMode == ETravelMode::Docked)
+	{
+		return false;
+	}
+
+	// Bake the highway path once; riding it is then constant-time per tick
+	ActiveTrajectory.BuildFromSpline(Highway.PathPoints, Highway.Speed);
+	if (!ActiveTrajectory.bActive)
+	{
+		return false;
+	}
+
+	SetTravelMode(ETravelMode::Highway);
+	UE_LOG(LogNavigation, Log, TEXT("Entered highway (%.0f units, %d samples)"),
+		ActiveTrajectory.TotalLength, ActiveTrajectory.SamplePoints.Num());
+	return true;
+}
+
 void UNavigationComponent::ExitHighway()
 {
 	if (CurrentTravelMode == ETravelMode::Highway)
 	{
+		ActiveTrajectory.bActive = false;
 		SetTravelMode(ETravelMode::StandardFlight);
 		UE_LOG(LogNavigation, Log, TEXT("Exited highway"));
 	}
 }
 
+void UNavigationComponent::FastForwardTravel(float Seconds)
+{
+	if (!ActiveTrajectory.bActive || Seconds <= 0.0f)
+	{
+		return;
+	}
+
+	// Analytic advance - no per-tick stepping needed for off-screen ships
+	ActiveTrajectory.DistanceAlong = FMath::Min(
+		ActiveTrajectory.DistanceAlong + ActiveTrajectory.Speed * Seconds, ActiveTrajectory.TotalLength);
+	if (AActor* Owner = GetOwner())
+	{
+		Owner->SetActorLocation(ActiveTrajectory.Evaluate(ActiveTrajectory.DistanceAlong));
+	}
+}
+
+float UNavigationComponent::GetTrajectoryProgress() const
+{
+	return (ActiveTrajectory.bActive && ActiveTrajectory.TotalLength > 0.0f)
+		? ActiveTrajectory.DistanceAlong / ActiveTrajectory.TotalLength : 0.0f;
+}
+
 bool UNavigationComponent::IsNearJumpGate(float MaxDistance) const
 {
 	// TODO: Query for nearby jump gates
@@ -338,12 +544,25 @@ bool UNavigationComponent::RequestDocking(AActor* Station)
 		return false;
 	}
 	
-	// TODO: Check if station has available docking port
-	// TODO: Request docking permission
-	
 	CurrentTarget = Station;
 	AutopilotState = EAutopilotState::ApproachingDock;
-	
+
+	// Stations that publish precomputed corridors hand us a validated
+	// spline from entry point to berth; we lock onto it and evaluate it
+	// instead of steering reactively through the densest geometry in the
+	// game. Stations without the component fall back to the old approach.
+	if (UDockingCorridorComponent* Corridors = Station->FindComponentByClass<UDockingCorridorComponent>())
+	{
+		TArray<FVector> ControlPoints;
+		float ApproachSpeed = 0.0f;
+		if (Corridors->AcquireCorridor(GetOwner(), GetOwner()->GetActorLocation(), ControlPoints, ApproachSpeed))
+		{
+			ActiveTrajectory.BuildFromSpline(ControlPoints, ApproachSpeed);
+			ActiveCorridorSource = Corridors;
+			UE_LOG(LogNavigation, Log, TEXT("Docking corridor acquired at: %s"), *Station->GetName());
+		}
+	}
+
 	UE_LOG(LogNavigation, Log, TEXT("Docking requested at: %s"), *Station->GetName());
 	return true;
 }
@@ -352,6 +571,12 @@ void UNavigationComponent::CancelDocking()
 {
 	if (AutopilotState == EAutopilotState::ApproachingDock || AutopilotState == EAutopilotState::Docking)
 	{
+		if (UDockingCorridorComponent* Corridors = ActiveCorridorSource.Get())
+		{
+			Corridors->ReleaseCorridor(GetOwner());
+		}
+		ActiveCorridorSource = nullptr;
+		ActiveTrajectory.bActive = false;
 		AutopilotState = EAutopilotState::Inactive;
 		CurrentTarget = nullptr;
 		UE_LOG(LogNavigation, Log, TEXT("Docking cancelled"));
@@ -362,10 +587,16 @@ void UNavigationComponent::CompleteDocking()
 {
 	if (AutopilotState == EAutopilotState::Docking)
 	{
+		if (UDockingCorridorComponent* Corridors = ActiveCorridorSource.Get())
+		{
+			Corridors->ReleaseCorridor(GetOwner());
+		}
+		ActiveCorridorSource = nullptr;
+		ActiveTrajectory.bActive = false;
 		SetTravelMode(ETravelMode::Docked);
 		AutopilotState = EAutopilotState::Inactive;
 		DockedStation = CurrentTarget;
-		
+
 		UE_LOG(LogNavigation, Log, TEXT("Docking complete"));
 	}
 }
@@ -391,26 +622,35 @@ void UNavigationComponent::UpdateAutopilot(float DeltaTime)
 	FNavigationWaypoint* CurrentWaypoint = GetCurrentWaypoint();
 	if (!CurrentWaypoint)
 	{
-		AutopilotState = EAutopilotState::Inactive;
+		// Corridor docking flies a trajectory, not a waypoint; the docking
+		// states outlive the queue until the corridor completes
+		if (AutopilotState != EAutopilotState::ApproachingDock && AutopilotState != EAutopilotState::Docking)
+		{
+			AutopilotState = EAutopilotState::Inactive;
+		}
 		return;
 	}
 	
-	// Update target location if following actor
-	if (CurrentWaypoint->TargetActor)
+	// Keep the follow target sampled; a dead target invalidates the
+	// waypoint and notifies listeners
+	if (!UpdateTargetTracking(*CurrentWaypoint, DeltaTime))
 	{
-		CurrentWaypoint->Location = CurrentWaypoint->TargetActor->GetActorLocation();
+		UE_LOG(LogNavigation, Log, TEXT("Waypoint target destroyed, dropping waypoint: %s"), *CurrentWaypoint->WaypointName);
+		OnWaypointInvalidated.Broadcast(CurrentWaypoint->WaypointName);
+		AdvanceToNextWaypoint();
+		return;
 	}
-	
+
 	float Distance = GetDistanceToWaypoint();
-	
+
 	// Check if arrived
 	if (Distance <= CurrentWaypoint->ArrivalRadius)
 	{
 		UE_LOG(LogNavigation, Log, TEXT("Arrived at waypoint: %s"), *CurrentWaypoint->WaypointName);
-		
-		if (CurrentWaypoint->bDockOnArrival && CurrentWaypoint->TargetActor)
+
+		if (CurrentWaypoint->bDockOnArrival && CurrentWaypoint->TargetActor.IsValid())
 		{
-			RequestDocking(CurrentWaypoint->TargetActor);
+			RequestDocking(CurrentWaypoint->TargetActor.Get());
 		}
 		
 		AdvanceToNextWaypoint();
@@ -421,14 +661,9 @@ void UNavigationComponent::UpdateAutopilot(float DeltaTime)
 	switch (AutopilotState)
 	{
 	case EAutopilotState::NavigatingToTarget:
-		// TODO: Calculate steering input toward target
-		// TODO: Manage speed based on distance
-		
-		// Check if should use travel drive
-		if (CurrentWaypoint->bUseTravelDrive && Distance > 5000.0f && CanActivateTravelDrive())
-		{
-			StartTravelDrive();
-		}
+		// Steering direction and travel drive use are decided in
+		// UpdateSteeringDecision on its own interval; movement code
+		// flies CachedSteeringDirection every frame
 		break;
 		
 	case EAutopilotState::TravelDriveCharging:
@@ -445,8 +680,10 @@ void UNavigationComponent::UpdateAutopilot(float DeltaTime)
 		break;
 		
 	case EAutopilotState::ApproachingDock:
-		// TODO: Careful approach to station
-		if (Distance < 50.0f)
+		// On a corridor the trajectory owns the approach and hands off to
+		// Docking on completion; the distance check is the reactive
+		// fallback for stations without published corridors
+		if (!ActiveTrajectory.bActive && Distance < 50.0f)
 		{
 			AutopilotState = EAutopilotState::Docking;
 		}
@@ -462,6 +699,42 @@ void UNavigationComponent::UpdateAutopilot(float DeltaTime)
 	}
 }
 
+bool UNavigationComponent::UpdateTargetTracking(FNavigationWaypoint& Waypoint, float DeltaTime)
+{
+	// Plain location waypoints have nothing to track
+	if (Waypoint.TargetActor.IsExplicitlyNull())
+	{
+		return true;
+	}
+
+	AActor* Target = Waypoint.TargetActor.Get();
+	if (!Target)
+	{
+		return false;
+	}
+
+	Waypoint.TimeSinceTargetSample += DeltaTime;
+
+	if (Waypoint.TimeSinceTargetSample >= TargetSampleInterval || !Waypoint.bHasTargetSample)
+	{
+		// Resample: the velocity estimate comes from the distance covered
+		// since the previous sample
+		const FVector NewLocation = Target->GetActorLocation();
+		if (Waypoint.bHasTargetSample && Waypoint.TimeSinceTargetSample > KINDA_SMALL_NUMBER)
+		{
+			Waypoint.SampledTargetVelocity = (NewLocation - Waypoint.SampledTargetLocation) / Waypoint.TimeSinceTargetSample;
+		}
+		Waypoint.SampledTargetLocation = NewLocation;
+		Waypoint.TimeSinceTargetSample = 0.0f;
+		Waypoint.bHasTargetSample = true;
+	}
+
+	// Dead-reckon between samples instead of reading the actor transform
+	// every frame
+	Waypoint.Location = Waypoint.SampledTargetLocation + Waypoint.SampledTargetVelocity * Waypoint.TimeSinceTargetSample;
+	return true;
+}
+
 void UNavigationComponent::UpdateTravelDrive(float DeltaTime)
 {
 	if (AutopilotState == EAutopilotState::TravelDriveCharging)
@@ -473,6 +746,13 @@ void UNavigationComponent::UpdateTravelDrive(float DeltaTime)
 		{
 			SetTravelMode(ETravelMode::TravelDrive);
 			AutopilotState = EAutopilotState::TravelDriveActive;
+
+			// Commit the run: bake a straight trajectory to the waypoint
+			if (FNavigationWaypoint* Waypoint = GetCurrentWaypoint())
+			{
+				ActiveTrajectory.BuildStraightLine(
+					GetOwner()->GetActorLocation(), Waypoint->Location, TravelDriveCruiseSpeed);
+			}
 			UE_LOG(LogNavigation, Log, TEXT("Travel drive activated"));
 		}
 	}
@@ -505,11 +785,123 @@ void UNavigationComponent::ApplyFlightAssist(float DeltaTime)
 	// - Collision avoidance adjustments
 }
 
-void UNavigationComponent::UpdateCollisionAvoidance(float DeltaTime)
+bool UNavigationComponent::UpdateSteeringDecision()
+{
+	FNavigationWaypoint* CurrentWaypoint = GetCurrentWaypoint();
+	if (!CurrentWaypoint || !GetOwner())
+	{
+		return true;
+	}
+
+	const FVector OwnerLocation = GetOwner()->GetActorLocation();
+	const FVector ToWaypoint = CurrentWaypoint->Location - OwnerLocation;
+	const FVector DesiredDirection = ToWaypoint.GetSafeNormal();
+
+	// Decide travel drive use for long legs
+	if (AutopilotState == EAutopilotState::NavigatingToTarget &&
+	    CurrentWaypoint->bUseTravelDrive && ToWaypoint.Size() > 5000.0f && CanActivateTravelDrive())
+	{
+		StartTravelDrive();
+	}
+
+	// Avoidance query, subject to the sector-wide per-frame budget
+	if (FlightAssist.bCollisionAvoidanceEnabled && SpatialPartition.IsValid())
+	{
+		if (!ClaimAvoidanceQueryBudget())
+		{
+			return false;
+		}
+		UpdateCollisionAvoidance(DesiredDirection);
+	}
+
+	CachedSteeringDirection = (DesiredDirection + CachedAvoidanceCorrection).GetSafeNormal();
+	if (CachedSteeringDirection.IsNearlyZero())
+	{
+		CachedSteeringDirection = DesiredDirection;
+	}
+	return true;
+}
+
+void UNavigationComponent::UpdateCollisionAvoidance(const FVector& DesiredDirection)
+{
+	USpatialPartitionSubsystem* Partition = SpatialPartition.Get();
+	if (!Partition)
+	{
+		return;
+	}
+
+	// Look for obstacles in a sphere centred ahead of the ship
+	const FVector OwnerLocation = GetOwner()->GetActorLocation();
+	const float LookAhead = FlightAssist.CollisionAvoidanceDistance;
+	const FVector ProbeCenter = OwnerLocation + DesiredDirection * (LookAhead * 0.5f);
+	TArray<AActor*> Obstacles = Partition->QueryRadius(ProbeCenter, LookAhead * 0.5f);
+
+	CachedAvoidanceCorrection = FVector::ZeroVector;
+	float NearestDistSquared = LookAhead * LookAhead;
+	const AActor* NearestObstacle = nullptr;
+
+	for (const AActor* Obstacle : Obstacles)
+	{
+		if (Obstacle == GetOwner())
+		{
+			continue;
+		}
+		const float DistSquared = FVector::DistSquared(OwnerLocation, Obstacle->GetActorLocation());
+		if (DistSquared < NearestDistSquared)
+		{
+			NearestDistSquared = DistSquared;
+			NearestObstacle = Obstacle;
+		}
+	}
+
+	if (NearestObstacle)
+	{
+		// Steer away from the obstacle, harder the closer it is
+		const FVector Away = (OwnerLocation - NearestObstacle->GetActorLocation()).GetSafeNormal();
+		const float Proximity = 1.0f - FMath::Sqrt(NearestDistSquared) / LookAhead;
+		CachedAvoidanceCorrection = Away * Proximity * 2.0f;
+	}
+}
+
+void UNavigationComponent::UpdateTrajectory(float DeltaTime)
 {
-	// TODO: Raycast ahead for obstacles
-	// TODO: Calculate avoidance vector
-	// TODO: Apply corrective forces
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	ActiveTrajectory.DistanceAlong += ActiveTrajectory.Speed * DeltaTime;
+	Owner->SetActorLocation(ActiveTrajectory.Evaluate(ActiveTrajectory.DistanceAlong));
+
+	const FVector Tangent = ActiveTrajectory.TangentAt(ActiveTrajectory.DistanceAlong);
+	if (!Tangent.IsNearlyZero())
+	{
+		Owner->SetActorRotation(Tangent.Rotation());
+	}
+
+	if (ActiveTrajectory.IsComplete())
+	{
+		if (AutopilotState == EAutopilotState::ApproachingDock)
+		{
+			// The corridor ends at the berth; finish the dock directly
+			ActiveTrajectory.bActive = false;
+			AutopilotState = EAutopilotState::Docking;
+			CompleteDocking();
+		}
+		else if (CurrentTravelMode == ETravelMode::Highway)
+		{
+			ExitHighway();
+		}
+		else
+		{
+			CancelTravelDrive();
+			if (AutopilotState == EAutopilotState::TravelDriveActive)
+			{
+				AutopilotState = WaypointQueue.Num() > 0 ? EAutopilotState::NavigatingToTarget : EAutopilotState::Inactive;
+			}
+		}
+	}
 }
 
 FNavigationWaypoint* UNavigationComponent::GetCurrentWaypoint()
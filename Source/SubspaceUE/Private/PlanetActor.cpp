@@ -1,12 +1,16 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "PlanetActor.h"
-#include "DrawDebugHelpers.h"
+#include "PlanetSurfaceComponent.h"
+#include "Components/LineBatchComponent.h"
 
 APlanetActor::APlanetActor()
 {
 	PrimaryActorTick.bCanEverTick = true;
 
+	// Surface detail streams in when the camera closes in; inert otherwise
+	Surface = CreateDefaultSubobject<UPlanetSurfaceComponent>(TEXT("Surface"));
+
 	// Default values
 	PlanetName = TEXT("Unknown Planet");
 	SemiMajorAxis = 100000.0;  // 1km default
@@ -19,12 +23,22 @@ APlanetActor::APlanetActor()
 	TimeMultiplier = 1000.0;  // Speed up orbits by default for testing
 	OrbitCenter = FVector::ZeroVector;
 	bShowOrbitPath = true;
+	bOrbitDrivenBySolver = false;
 	DiameterKm = 12742.0;  // Earth size default
 	MassEarthMasses = 1.0;
 	bHasMoons = false;
 	RotationPeriodDays = 1.0;
 	bEnableRotation = true;
 	ElapsedTime = 0.0;
+	OrbitLineBatch = nullptr;
+	bOrbitPathDirty = true;
+	bOrbitPathSubmitted = false;
+	CachedSemiMajorAxis = 0.0;
+	CachedEccentricity = 0.0;
+	CachedInclination = 0.0;
+	CachedLongitudeOfAscendingNode = 0.0;
+	CachedArgumentOfPeriapsis = 0.0;
+	CachedOrbitCenter = FVector::ZeroVector;
 }
 
 void APlanetActor::BeginPlay()
@@ -40,40 +54,42 @@ void APlanetActor::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Update elapsed time with multiplier
-	ElapsedTime += DeltaTime * TimeMultiplier;
+	// Standalone orbit solve - skipped when the solar system manager's
+	// batched solver owns this planet's position
+	if (!bOrbitDrivenBySolver)
+	{
+		// Update elapsed time with multiplier
+		ElapsedTime += DeltaTime * TimeMultiplier;
+
+		// Calculate mean anomaly (angle traveled in orbit)
+		// Mean motion (radians per second) = 2π / period
+		double OrbitalPeriodSeconds = OrbitalPeriodDays * 86400.0;  // Convert days to seconds
+		double MeanMotion = (2.0 * PI) / OrbitalPeriodSeconds;
+		double CurrentMeanAnomaly = FMath::DegreesToRadians(MeanAnomalyAtEpoch) + (MeanMotion * ElapsedTime);
+
+		// Keep mean anomaly in [0, 2π] range
+		CurrentMeanAnomaly = FMath::Fmod(CurrentMeanAnomaly, 2.0 * PI);
+		if (CurrentMeanAnomaly < 0.0)
+		{
+			CurrentMeanAnomaly += 2.0 * PI;
+		}
 
-	// Calculate mean anomaly (angle traveled in orbit)
-	// Mean motion (radians per second) = 2π / period
-	double OrbitalPeriodSeconds = OrbitalPeriodDays * 86400.0;  // Convert days to seconds
-	double MeanMotion = (2.0 * PI) / OrbitalPeriodSeconds;
-	double CurrentMeanAnomaly = FMath::DegreesToRadians(MeanAnomalyAtEpoch) + (MeanMotion * ElapsedTime);
+		// Calculate new position
+		FVector NewPosition = CalculateOrbitPosition(CurrentMeanAnomaly);
+		SetActorLocation(NewPosition);
 
-	// Keep mean anomaly in [0, 2π] range
-	CurrentMeanAnomaly = FMath::Fmod(CurrentMeanAnomaly, 2.0 * PI);
-	if (CurrentMeanAnomaly < 0.0)
-	{
-		CurrentMeanAnomaly += 2.0 * PI;
+		// Trigger blueprint event
+		OnOrbitPositionUpdated(NewPosition);
 	}
 
-	// Calculate new position
-	FVector NewPosition = CalculateOrbitPosition(CurrentMeanAnomaly);
-	SetActorLocation(NewPosition);
-
 	// Update rotation if enabled
 	if (bEnableRotation)
 	{
 		UpdateRotation(DeltaTime);
 	}
 
-	// Draw orbit path if enabled
-	if (bShowOrbitPath)
-	{
-		DrawOrbitPath();
-	}
-
-	// Trigger blueprint event
-	OnOrbitPositionUpdated(NewPosition);
+	// Keep the cached orbit path in sync with the orbital elements
+	UpdateOrbitPath();
 }
 
 FVector APlanetActor::CalculateOrbitPosition(double MeanAnomaly) const
@@ -142,62 +158,87 @@ double APlanetActor::SolveKeplersEquation(double MeanAnomaly) const
 	return EccentricAnomaly;
 }
 
-void APlanetActor::DrawOrbitPath() const
+void APlanetActor::UpdateOrbitPath()
 {
 	if (GetWorld() == nullptr)
 	{
 		return;
 	}
 
-	// Draw orbit as a series of line segments
-	const int NumSegments = 100;
-	FVector PreviousPoint;
-
-	for (int i = 0; i <= NumSegments; ++i)
+	// Path hidden: clear any submitted lines once and stop
+	if (!bShowOrbitPath)
 	{
-		double Angle = (2.0 * PI * i) / NumSegments;
-		FVector Point = CalculateOrbitPosition(Angle);
-
-		if (i > 0)
+		if (bOrbitPathSubmitted && OrbitLineBatch)
 		{
-			DrawDebugLine(
-				GetWorld(),
-				PreviousPoint,
-				Point,
-				FColor::Cyan,
-				false,  // bPersistentLines (false = drawn each frame)
-				-1.0f,  // Lifetime (-1 = infinite, redrawn each frame)
-				0,      // Depth priority
-				50.0f   // Thickness
-			);
+			OrbitLineBatch->Flush();
+			bOrbitPathSubmitted = false;
 		}
+		return;
+	}
 
+	// The path only changes when an orbital element does; the line batch
+	// keeps rendering the submitted lines until we flush it
+	const bool bElementsChanged =
+		CachedSemiMajorAxis != SemiMajorAxis ||
+		CachedEccentricity != Eccentricity ||
+		CachedInclination != Inclination ||
+		CachedLongitudeOfAscendingNode != LongitudeOfAscendingNode ||
+		CachedArgumentOfPeriapsis != ArgumentOfPeriapsis ||
+		CachedOrbitCenter != OrbitCenter;
+	if (bOrbitPathSubmitted && !bOrbitPathDirty && !bElementsChanged)
+	{
+		return;
+	}
+
+	// The batch lives in world space, detached from the moving planet
+	if (!OrbitLineBatch)
+	{
+		OrbitLineBatch = NewObject<ULineBatchComponent>(this, TEXT("OrbitPathBatch"));
+		OrbitLineBatch->SetAbsolute(true, true, true);
+		OrbitLineBatch->RegisterComponent();
+	}
+	OrbitLineBatch->Flush();
+
+	// Orbit polyline; lifetime 0 keeps the lines until the next flush
+	const int NumSegments = 100;
+	TArray<FBatchedLine> Lines;
+	Lines.Reserve(NumSegments + 24);
+	FVector PreviousPoint = CalculateOrbitPosition(0.0);
+	for (int i = 1; i <= NumSegments; ++i)
+	{
+		const double Angle = (2.0 * PI * i) / NumSegments;
+		const FVector Point = CalculateOrbitPosition(Angle);
+		Lines.Add(FBatchedLine(PreviousPoint, Point, FColor::Cyan, 0.0f, 50.0f, 0));
 		PreviousPoint = Point;
 	}
 
-	// Draw a marker at perihelion (closest point)
-	FVector Perihelion = CalculateOrbitPosition(0.0);
-	DrawDebugSphere(
-		GetWorld(),
-		Perihelion,
-		5000.0f,
-		12,
-		FColor::Yellow,
-		false,
-		-1.0f
-	);
-
-	// Draw a marker at aphelion (farthest point)
-	FVector Aphelion = CalculateOrbitPosition(PI);
-	DrawDebugSphere(
-		GetWorld(),
-		Aphelion,
-		5000.0f,
-		12,
-		FColor::Red,
-		false,
-		-1.0f
-	);
+	// Circle markers at perihelion (yellow) and aphelion (red)
+	auto AddMarker = [&Lines](const FVector& Center, const FColor& Color)
+	{
+		const int MarkerSegments = 12;
+		const double MarkerRadius = 5000.0;
+		FVector Previous = Center + FVector(MarkerRadius, 0.0, 0.0);
+		for (int i = 1; i <= MarkerSegments; ++i)
+		{
+			const double Angle = (2.0 * PI * i) / MarkerSegments;
+			const FVector Point = Center + FVector(MarkerRadius * FMath::Cos(Angle), MarkerRadius * FMath::Sin(Angle), 0.0);
+			Lines.Add(FBatchedLine(Previous, Point, Color, 0.0f, 50.0f, 0));
+			Previous = Point;
+		}
+	};
+	AddMarker(CalculateOrbitPosition(0.0), FColor::Yellow);
+	AddMarker(CalculateOrbitPosition(PI), FColor::Red);
+
+	OrbitLineBatch->DrawLines(Lines);
+
+	CachedSemiMajorAxis = SemiMajorAxis;
+	CachedEccentricity = Eccentricity;
+	CachedInclination = Inclination;
+	CachedLongitudeOfAscendingNode = LongitudeOfAscendingNode;
+	CachedArgumentOfPeriapsis = ArgumentOfPeriapsis;
+	CachedOrbitCenter = OrbitCenter;
+	bOrbitPathDirty = false;
+	bOrbitPathSubmitted = true;
 }
 
 void APlanetActor::UpdateRotation(float DeltaTime)
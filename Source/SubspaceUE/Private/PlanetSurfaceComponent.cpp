@@ -0,0 +1,360 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "PlanetSurfaceComponent.h"
+#include "SpaceActor.h"
+#include "Async/Async.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Components/StaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "ProceduralMeshComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPlanetSurface, Log, All);
+
+namespace
+{
+	/** Cube face bases; U cross V equals the outward face normal */
+	struct FFaceBasis
+	{
+		FVector Normal;
+		FVector U;
+		FVector V;
+	};
+
+	const FFaceBasis FaceBases[6] = {
+		{ FVector( 1,  0, 0), FVector( 0,  1, 0), FVector(0, 0, 1) }, // +X
+		{ FVector(-1,  0, 0), FVector( 0, -1, 0), FVector(0, 0, 1) }, // -X
+		{ FVector( 0,  1, 0), FVector(-1,  0, 0), FVector(0, 0, 1) }, // +Y
+		{ FVector( 0, -1, 0), FVector( 1,  0, 0), FVector(0, 0, 1) }, // -Y
+		{ FVector( 0,  0, 1), FVector( 1,  0, 0), FVector(0, 1, 0) }, // +Z
+		{ FVector( 0,  0,-1), FVector(-1,  0, 0), FVector(0, 1, 0) }, // -Z
+	};
+
+	/** Point on the unit sphere for face-local coordinates in [-1,1] */
+	FVector CubeToSphere(int32 Face, float U, float V)
+	{
+		const FFaceBasis& Basis = FaceBases[Face];
+		return (Basis.Normal + Basis.U * U + Basis.V * V).GetSafeNormal();
+	}
+}
+
+UPlanetSurfaceComponent::UPlanetSurfaceComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+}
+
+void UPlanetSurfaceComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	SelectionTimer -= DeltaTime;
+	if (SelectionTimer > 0.0f)
+	{
+		return;
+	}
+	SelectionTimer = SelectionInterval;
+
+	APlayerController* PlayerController = GetWorld()->GetFirstPlayerController();
+	if (!PlayerController || !PlayerController->PlayerCameraManager)
+	{
+		return;
+	}
+
+	// LOD decisions happen in local space so actor scale (planet size)
+	// is accounted for by the transform
+	const FVector LocalCamera = GetOwner()->GetActorTransform().InverseTransformPosition(
+		PlayerController->PlayerCameraManager->GetCameraLocation());
+	const float LocalCameraDistance = LocalCamera.Size();
+
+	if (LocalCameraDistance > FixedLocalRadius * ActivationDistance)
+	{
+		if (bSurfaceActive)
+		{
+			ReleaseAllPatches();
+		}
+		return;
+	}
+
+	if (!bSurfaceActive)
+	{
+		bSurfaceActive = true;
+		// The quadtree surface replaces the fixed-resolution sphere
+		if (ASpaceActor* SpaceOwner = Cast<ASpaceActor>(GetOwner()))
+		{
+			if (SpaceOwner->Mesh)
+			{
+				SpaceOwner->Mesh->SetVisibility(false);
+			}
+		}
+		UE_LOG(LogPlanetSurface, Log, TEXT("PlanetSurface: Engaging quadtree surface on %s"), *GetOwner()->GetName());
+	}
+
+	UpdatePatchSelection(LocalCamera);
+}
+
+void UPlanetSurfaceComponent::UpdatePatchSelection(const FVector& LocalCameraPosition)
+{
+	DesiredPatches.Reset();
+	for (uint8 Face = 0; Face < 6; ++Face)
+	{
+		FPlanetPatchKey Root;
+		Root.Face = Face;
+		SelectPatches(Root, LocalCameraPosition, DesiredPatches);
+	}
+
+	// Release patches that fell out of the desired set
+	for (auto It = ActivePatches.CreateIterator(); It; ++It)
+	{
+		if (!DesiredPatches.Contains(It.Key()))
+		{
+			FreeSections.Add(It.Value());
+			if (SurfaceMesh)
+			{
+				SurfaceMesh->ClearMeshSection(It.Value());
+			}
+			It.RemoveCurrent();
+		}
+	}
+
+	// Kick builds for newly desired patches, nearest level first is not
+	// needed - the throttle keeps the game thread smooth and selection
+	// re-runs every interval until the set is satisfied
+	for (const FPlanetPatchKey& Key : DesiredPatches)
+	{
+		if (PendingPatches.Num() >= MaxPendingPatches)
+		{
+			break;
+		}
+		if (!ActivePatches.Contains(Key) && !PendingPatches.Contains(Key))
+		{
+			RequestPatch(Key);
+		}
+	}
+}
+
+void UPlanetSurfaceComponent::SelectPatches(const FPlanetPatchKey& Node, const FVector& LocalCameraPosition, TSet<FPlanetPatchKey>& OutDesired) const
+{
+	// Patch angular size halves per level; local linear size follows
+	const float PatchSize = 2.0f * FixedLocalRadius / static_cast<float>(1 << Node.Level);
+	const float Distance = FVector::Dist(LocalCameraPosition, PatchCenter(Node) * FixedLocalRadius);
+
+	if (Node.Level < MaxDepth && Distance < PatchSize * SplitFactor)
+	{
+		for (uint16 ChildY = 0; ChildY < 2; ++ChildY)
+		{
+			for (uint16 ChildX = 0; ChildX < 2; ++ChildX)
+			{
+				FPlanetPatchKey Child;
+				Child.Face = Node.Face;
+				Child.Level = Node.Level + 1;
+				Child.X = Node.X * 2 + ChildX;
+				Child.Y = Node.Y * 2 + ChildY;
+				SelectPatches(Child, LocalCameraPosition, OutDesired);
+			}
+		}
+		return;
+	}
+
+	OutDesired.Add(Node);
+}
+
+FVector UPlanetSurfaceComponent::PatchCenter(const FPlanetPatchKey& Key)
+{
+	const float CellSize = 2.0f / static_cast<float>(1 << Key.Level);
+	const float U = -1.0f + (Key.X + 0.5f) * CellSize;
+	const float V = -1.0f + (Key.Y + 0.5f) * CellSize;
+	return CubeToSphere(Key.Face, U, V);
+}
+
+void UPlanetSurfaceComponent::RequestPatch(const FPlanetPatchKey& Key)
+{
+	PendingPatches.Add(Key);
+
+	// Geometry builds on the thread pool; the result hops back to the
+	// game thread, which owns all mesh sections
+	TWeakObjectPtr<UPlanetSurfaceComponent> WeakThis(this);
+	const int32 Resolution = PatchResolution;
+	Async(EAsyncExecution::ThreadPool, [WeakThis, Key, Resolution]()
+	{
+		FPlanetPatchMesh Mesh;
+		BuildPatchMesh(Key, Resolution, Mesh);
+
+		AsyncTask(ENamedThreads::GameThread, [WeakThis, Key, Mesh = MoveTemp(Mesh)]() mutable
+		{
+			if (UPlanetSurfaceComponent* Surface = WeakThis.Get())
+			{
+				Surface->ApplyPatch(Key, MoveTemp(Mesh));
+			}
+		});
+	});
+}
+
+void UPlanetSurfaceComponent::ApplyPatch(const FPlanetPatchKey& Key, FPlanetPatchMesh&& Mesh)
+{
+	PendingPatches.Remove(Key);
+
+	// Selection may have moved on while the build was in flight
+	if (!bSurfaceActive || !DesiredPatches.Contains(Key) || ActivePatches.Contains(Key))
+	{
+		return;
+	}
+
+	UProceduralMeshComponent* Target = GetOrCreateSurfaceMesh();
+	if (!Target)
+	{
+		return;
+	}
+
+	// Pooled sections: released patches hand their index back rather
+	// than growing the section list forever
+	int32 Section;
+	if (FreeSections.Num() > 0)
+	{
+		Section = FreeSections.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Section = NextSectionIndex++;
+	}
+
+	TArray<FVector2D> UV0;
+	TArray<FProcMeshTangent> Tangents;
+	TArray<FColor> VertexColors;
+	Target->CreateMeshSection(Section, Mesh.Vertices, Mesh.Triangles, Mesh.Normals, UV0, VertexColors, Tangents, /*bCreateCollision*/ false);
+
+	ActivePatches.Add(Key, Section);
+}
+
+void UPlanetSurfaceComponent::ReleasePatch(const FPlanetPatchKey& Key)
+{
+	int32 Section;
+	if (ActivePatches.RemoveAndCopyValue(Key, Section))
+	{
+		FreeSections.Add(Section);
+		if (SurfaceMesh)
+		{
+			SurfaceMesh->ClearMeshSection(Section);
+		}
+	}
+}
+
+void UPlanetSurfaceComponent::ReleaseAllPatches()
+{
+	bSurfaceActive = false;
+	DesiredPatches.Reset();
+	PendingPatches.Reset();
+
+	for (const TPair<FPlanetPatchKey, int32>& Patch : ActivePatches)
+	{
+		FreeSections.Add(Patch.Value);
+		if (SurfaceMesh)
+		{
+			SurfaceMesh->ClearMeshSection(Patch.Value);
+		}
+	}
+	ActivePatches.Reset();
+
+	if (ASpaceActor* SpaceOwner = Cast<ASpaceActor>(GetOwner()))
+	{
+		if (SpaceOwner->Mesh)
+		{
+			SpaceOwner->Mesh->SetVisibility(true);
+		}
+	}
+	UE_LOG(LogPlanetSurface, Log, TEXT("PlanetSurface: Releasing quadtree surface on %s"), *GetOwner()->GetName());
+}
+
+void UPlanetSurfaceComponent::BuildPatchMesh(const FPlanetPatchKey& Key, int32 Resolution, FPlanetPatchMesh& OutMesh)
+{
+	const int32 Res = FMath::Max(Resolution, 2);
+	const float CellSize = 2.0f / static_cast<float>(1 << Key.Level);
+	const float U0 = -1.0f + Key.X * CellSize;
+	const float V0 = -1.0f + Key.Y * CellSize;
+	const float Step = CellSize / Res;
+
+	// Grid vertices on the sphere
+	const int32 VertsPerEdge = Res + 1;
+	OutMesh.Vertices.Reserve(VertsPerEdge * VertsPerEdge * 2);
+	OutMesh.Normals.Reserve(VertsPerEdge * VertsPerEdge * 2);
+	for (int32 J = 0; J < VertsPerEdge; ++J)
+	{
+		for (int32 I = 0; I < VertsPerEdge; ++I)
+		{
+			const FVector OnSphere = CubeToSphere(Key.Face, U0 + I * Step, V0 + J * Step);
+			OutMesh.Vertices.Add(OnSphere * FixedLocalRadius);
+			OutMesh.Normals.Add(OnSphere);
+		}
+	}
+
+	OutMesh.Triangles.Reserve(Res * Res * 6 + Res * 4 * 6);
+	auto VertexAt = [VertsPerEdge](int32 I, int32 J) { return I + J * VertsPerEdge; };
+	for (int32 J = 0; J < Res; ++J)
+	{
+		for (int32 I = 0; I < Res; ++I)
+		{
+			const int32 A = VertexAt(I, J);
+			const int32 B = VertexAt(I + 1, J);
+			const int32 C = VertexAt(I, J + 1);
+			const int32 D = VertexAt(I + 1, J + 1);
+			OutMesh.Triangles.Add(A); OutMesh.Triangles.Add(C); OutMesh.Triangles.Add(B);
+			OutMesh.Triangles.Add(B); OutMesh.Triangles.Add(C); OutMesh.Triangles.Add(D);
+		}
+	}
+
+	// Skirt: duplicate the border ring pulled toward the planet center
+	// so neighboring patches at different levels cannot show cracks.
+	// Depth scales with patch size - deep patches need shallow skirts.
+	const float SkirtDepth = FixedLocalRadius * CellSize * 0.05f;
+
+	auto AddSkirtEdge = [&OutMesh, &VertexAt, SkirtDepth](const TArray<int32>& EdgeVerts)
+	{
+		// EdgeVerts run along the border in quad-winding order
+		TArray<int32> Lowered;
+		Lowered.Reserve(EdgeVerts.Num());
+		for (int32 Vertex : EdgeVerts)
+		{
+			const FVector Position = OutMesh.Vertices[Vertex];
+			Lowered.Add(OutMesh.Vertices.Add(Position - Position.GetSafeNormal() * SkirtDepth));
+			OutMesh.Normals.Add(OutMesh.Normals[Vertex]);
+		}
+		for (int32 Segment = 0; Segment < EdgeVerts.Num() - 1; ++Segment)
+		{
+			const int32 A = EdgeVerts[Segment];
+			const int32 B = EdgeVerts[Segment + 1];
+			const int32 LA = Lowered[Segment];
+			const int32 LB = Lowered[Segment + 1];
+			OutMesh.Triangles.Add(A); OutMesh.Triangles.Add(LA); OutMesh.Triangles.Add(B);
+			OutMesh.Triangles.Add(B); OutMesh.Triangles.Add(LA); OutMesh.Triangles.Add(LB);
+		}
+	};
+
+	TArray<int32> Edge;
+	Edge.Reserve(VertsPerEdge);
+
+	// Bottom (J = 0), left to right
+	for (int32 I = 0; I < VertsPerEdge; ++I) { Edge.Add(VertexAt(I, 0)); }
+	AddSkirtEdge(Edge);
+	Edge.Reset();
+	// Top (J = Res), right to left
+	for (int32 I = VertsPerEdge - 1; I >= 0; --I) { Edge.Add(VertexAt(I, Res)); }
+	AddSkirtEdge(Edge);
+	Edge.Reset();
+	// Left (I = 0), top to bottom
+	for (int32 J = VertsPerEdge - 1; J >= 0; --J) { Edge.Add(VertexAt(0, J)); }
+	AddSkirtEdge(Edge);
+	Edge.Reset();
+	// Right (I = Res), bottom to top
+	for (int32 J = 0; J < VertsPerEdge; ++J) { Edge.Add(VertexAt(Res, J)); }
+	AddSkirtEdge(Edge);
+}
+
+UProceduralMeshComponent* UPlanetSurfaceComponent::GetOrCreateSurfaceMesh()
+{
+	if (!SurfaceMesh)
+	{
+		SurfaceMesh = NewObject<UProceduralMeshComponent>(GetOwner(), TEXT("PlanetSurfaceMesh"));
+		SurfaceMesh->RegisterComponent();
+		SurfaceMesh->AttachToComponent(GetOwner()->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	}
+	return SurfaceMesh;
+}
@@ -0,0 +1,126 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProductionSchedulerSubsystem.h"
+#include "TradingComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogProductionScheduler, Log, All);
+
+namespace
+{
+	/** Earliest due time first */
+	struct FProductionEventOrder
+	{
+		bool operator()(const FProductionEvent& A, const FProductionEvent& B) const
+		{
+			return A.DueTime < B.DueTime;
+		}
+	};
+}
+
+void UProductionSchedulerSubsystem::Tick(float DeltaTime)
+{
+	CurrentTime += DeltaTime;
+
+	// Pop every event that has come due; each pop is one heap operation
+	while (EventQueue.Num() > 0 && EventQueue.HeapTop().DueTime <= CurrentTime)
+	{
+		FProductionEvent Event;
+		EventQueue.HeapPop(Event, FProductionEventOrder(), EAllowShrinking::No);
+		CompleteProduction(Event);
+	}
+}
+
+TStatId UProductionSchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProductionSchedulerSubsystem, STATGROUP_Tickables);
+}
+
+bool UProductionSchedulerSubsystem::CanProduce(const UTradingComponent* Station, FName WareId) const
+{
+	const FWare* Ware = Station->WareLibrary.Find(WareId);
+	if (!Ware)
+	{
+		return false;
+	}
+
+	// Find the sell order for this ware; production stops at its cap
+	const FTradeOrder* SellOrder = Station->TradeOrders.FindByPredicate(
+		[WareId](const FTradeOrder& Order) { return !Order.bIsBuyOrder && Order.bIsActive && Order.WareId == WareId; });
+	if (!SellOrder || Station->GetWareStock(WareId) >= SellOrder->MaxQuantity)
+	{
+		return false;
+	}
+
+	for (const TPair<FName, int32>& Input : Ware->InputWares)
+	{
+		if (Station->GetWareStock(Input.Key) < Input.Value)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+void UProductionSchedulerSubsystem::ScheduleStationProduction(UTradingComponent* Station)
+{
+	if (!Station)
+	{
+		return;
+	}
+
+	TSet<FName>& Scheduled = ScheduledWares.FindOrAdd(Station);
+	for (const FTradeOrder& Order : Station->TradeOrders)
+	{
+		if (Order.bIsBuyOrder || !Order.bIsActive || Scheduled.Contains(Order.WareId))
+		{
+			continue;
+		}
+		if (!CanProduce(Station, Order.WareId))
+		{
+			continue;
+		}
+
+		const FWare* Ware = Station->WareLibrary.Find(Order.WareId);
+		FProductionEvent Event;
+		Event.DueTime = CurrentTime + Ware->ProductionTime;
+		Event.Station = Station;
+		Event.WareId = Order.WareId;
+		EventQueue.HeapPush(MoveTemp(Event), FProductionEventOrder());
+		Scheduled.Add(Order.WareId);
+	}
+}
+
+void UProductionSchedulerSubsystem::CancelStationProduction(UTradingComponent* Station)
+{
+	// Events stay in the heap and are discarded when they pop with no
+	// matching ScheduledWares entry - cheaper than re-heapifying now
+	ScheduledWares.Remove(Station);
+}
+
+void UProductionSchedulerSubsystem::CompleteProduction(const FProductionEvent& Event)
+{
+	UTradingComponent* Station = Event.Station.Get();
+	TSet<FName>* Scheduled = Station ? ScheduledWares.Find(Event.Station) : nullptr;
+	if (!Scheduled || !Scheduled->Remove(Event.WareId))
+	{
+		// Station gone or production was cancelled - stale event
+		return;
+	}
+
+	// Conditions may have changed while the event was queued
+	if (!CanProduce(Station, Event.WareId))
+	{
+		return;
+	}
+
+	const FWare* Ware = Station->WareLibrary.Find(Event.WareId);
+	for (const TPair<FName, int32>& Input : Ware->InputWares)
+	{
+		Station->RemoveWareFromStorage(Input.Key, Input.Value);
+	}
+	Station->AddWareToStorage(Event.WareId, 1);
+	UE_LOG(LogProductionScheduler, Verbose, TEXT("Produced 1x %s"), *Event.WareId.ToString());
+
+	// Next cycle (storage-change hooks may already have re-scheduled)
+	ScheduleStationProduction(Station);
+}
@@ -0,0 +1,237 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ProjectileSubsystem.h"
+#include "AsteroidFieldSubsystem.h"
+#include "SpatialPartitionSubsystem.h"
+#include "VoxelComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogProjectiles, Log, All);
+
+void UProjectileSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// One allocation per array for the whole session; the batched update
+	// never grows past this
+	Positions.Reserve(PoolCapacity);
+	Velocities.Reserve(PoolCapacity);
+	Damages.Reserve(PoolCapacity);
+	RemainingRanges.Reserve(PoolCapacity);
+	Instigators.Reserve(PoolCapacity);
+	FireSequences.Reserve(PoolCapacity);
+}
+
+TStatId UProjectileSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UProjectileSubsystem, STATGROUP_Tickables);
+}
+
+void UProjectileSubsystem::FireProjectile(AActor* InInstigator, const FVector& Location, const FVector& Direction,
+	float Speed, float Damage, float Range)
+{
+	if (Speed <= 0.0f || Range <= 0.0f)
+	{
+		return;
+	}
+
+	// At capacity the oldest live shot gives up its slot - under
+	// sustained fleet fire a shot near the end of its range disappearing
+	// a frame early is invisible, a dropped new shot is not. Swap-removal
+	// scrambles slot order, so the oldest is the lowest fire sequence,
+	// not index 0.
+	if (Positions.Num() >= PoolCapacity)
+	{
+		int32 OldestIndex = 0;
+		for (int32 Index = 1; Index < FireSequences.Num(); ++Index)
+		{
+			if (FireSequences[Index] < FireSequences[OldestIndex])
+			{
+				OldestIndex = Index;
+			}
+		}
+		RemoveProjectileAtIndex(OldestIndex);
+	}
+
+	Positions.Add(Location);
+	Velocities.Add(Direction.GetSafeNormal() * Speed);
+	Damages.Add(Damage);
+	RemainingRanges.Add(Range);
+	Instigators.Add(InInstigator);
+	FireSequences.Add(NextFireSequence++);
+}
+
+void UProjectileSubsystem::Tick(float DeltaTime)
+{
+	if (Positions.Num() == 0)
+	{
+		UpdateVisuals();
+		return;
+	}
+
+	// One batched pass: advance every live shot, resolve its step, and
+	// swap-remove expired or hitting shots in place
+	for (int32 Index = 0; Index < Positions.Num(); ++Index)
+	{
+		const FVector StepStart = Positions[Index];
+		const float StepLength = Velocities[Index].Size() * DeltaTime;
+		const FVector StepEnd = StepStart + Velocities[Index] * DeltaTime;
+
+		RemainingRanges[Index] -= StepLength;
+
+		if (ResolveHit(Index, StepStart, StepEnd) || RemainingRanges[Index] <= 0.0f)
+		{
+			RemoveProjectileAtIndex(Index);
+			--Index;
+			continue;
+		}
+
+		Positions[Index] = StepEnd;
+	}
+
+	UpdateVisuals();
+}
+
+bool UProjectileSubsystem::ResolveHit(int32 Index, const FVector& StepStart, const FVector& StepEnd)
+{
+	USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>();
+	if (!Partition)
+	{
+		return false;
+	}
+
+	// Candidates come from the sector partition around the step, not a
+	// world sweep; the query radius covers the whole step plus the hit
+	// tolerance
+	const FVector StepCenter = (StepStart + StepEnd) * 0.5f;
+	const float QueryRadius = (StepEnd - StepStart).Size() * 0.5f + HitRadius;
+	AActor* const InstigatorActor = Instigators[Index].Get();
+
+	TArray<AActor*> Candidates = Partition->QueryRadius(StepCenter, QueryRadius);
+	for (AActor* Candidate : Candidates)
+	{
+		if (!Candidate || Candidate == InstigatorActor)
+		{
+			continue;
+		}
+
+		const FVector Closest = FMath::ClosestPointOnSegment(Candidate->GetActorLocation(), StepStart, StepEnd);
+		if (FVector::DistSquared(Closest, Candidate->GetActorLocation()) > HitRadius * HitRadius)
+		{
+			continue;
+		}
+
+		// Refine against the hull when the target is a voxel structure:
+		// raycast the step in voxel space and damage the struck block
+		if (UVoxelComponent* Voxels = Candidate->FindComponentByClass<UVoxelComponent>())
+		{
+			const FTransform& VoxelTransform = Voxels->GetComponentTransform();
+			FVoxelBlock HitBlock;
+			if (!Voxels->RaycastBlock(
+					VoxelTransform.InverseTransformPosition(StepStart),
+					VoxelTransform.InverseTransformPosition(StepEnd),
+					HitBlock))
+			{
+				continue;
+			}
+			Voxels->DamageBlock(HitBlock.Id, Damages[Index]);
+		}
+
+		Candidate->TakeDamage(Damages[Index], FDamageEvent(), nullptr, InstigatorActor);
+		return true;
+	}
+
+	// Nothing live was hit; a field asteroid instance may be in the way.
+	// Promoting it makes it a normal partitioned voxel actor, and the
+	// shot damages it directly so the first hit is not lost.
+	if (UAsteroidFieldSubsystem* Field = GetWorld()->GetSubsystem<UAsteroidFieldSubsystem>())
+	{
+		if (AActor* Promoted = Field->PromoteNearestInstance(StepCenter, QueryRadius))
+		{
+			if (UVoxelComponent* Voxels = Promoted->FindComponentByClass<UVoxelComponent>())
+			{
+				const FTransform& VoxelTransform = Voxels->GetComponentTransform();
+				FVoxelBlock HitBlock;
+				if (Voxels->RaycastBlock(
+						VoxelTransform.InverseTransformPosition(StepStart),
+						VoxelTransform.InverseTransformPosition(StepEnd),
+						HitBlock))
+				{
+					Voxels->DamageBlock(HitBlock.Id, Damages[Index]);
+					Promoted->TakeDamage(Damages[Index], FDamageEvent(), nullptr, InstigatorActor);
+					return true;
+				}
+			}
+		}
+	}
+
+	return false;
+}
+
+void UProjectileSubsystem::RemoveProjectileAtIndex(int32 Index)
+{
+	Positions.RemoveAtSwap(Index, EAllowShrinking::No);
+	Velocities.RemoveAtSwap(Index, EAllowShrinking::No);
+	Damages.RemoveAtSwap(Index, EAllowShrinking::No);
+	RemainingRanges.RemoveAtSwap(Index, EAllowShrinking::No);
+	Instigators.RemoveAtSwap(Index, EAllowShrinking::No);
+	FireSequences.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+void UProjectileSubsystem::EnsureVisuals()
+{
+	if (ProjectileInstances || !ProjectileMesh)
+	{
+		return;
+	}
+
+	// One hidden holder actor carries the instanced mesh for every shot
+	// in the world
+	AActor* Holder = GetWorld()->SpawnActor<AActor>();
+	if (!Holder)
+	{
+		return;
+	}
+
+	ProjectileInstances = NewObject<UInstancedStaticMeshComponent>(Holder, TEXT("ProjectileInstances"));
+	ProjectileInstances->SetStaticMesh(ProjectileMesh);
+	ProjectileInstances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+	ProjectileInstances->SetCastShadow(false);
+	ProjectileInstances->RegisterComponent();
+	Holder->SetRootComponent(ProjectileInstances);
+}
+
+void UProjectileSubsystem::UpdateVisuals()
+{
+	EnsureVisuals();
+	if (!ProjectileInstances)
+	{
+		return;
+	}
+
+	// Match the instance count to the live count, then batch-write every
+	// transform - instances are anonymous, so index pairing is arbitrary
+	while (ProjectileInstances->GetInstanceCount() < Positions.Num())
+	{
+		ProjectileInstances->AddInstance(FTransform::Identity, /*bWorldSpace*/ true);
+	}
+	while (ProjectileInstances->GetInstanceCount() > Positions.Num())
+	{
+		ProjectileInstances->RemoveInstance(ProjectileInstances->GetInstanceCount() - 1);
+	}
+
+	if (Positions.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FTransform> Transforms;
+	Transforms.Reserve(Positions.Num());
+	for (int32 Index = 0; Index < Positions.Num(); ++Index)
+	{
+		Transforms.Emplace(Velocities[Index].ToOrientationQuat(), Positions[Index]);
+	}
+	ProjectileInstances->BatchUpdateInstancesTransforms(0, Transforms, /*bWorldSpace*/ true, /*bMarkRenderStateDirty*/ true, /*bTeleport*/ true);
+}
@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShipClassRegistry.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogShipClassRegistry, Log, All);
+
+const TCHAR* UShipClassRegistry::ShipClassTablePath = TEXT("/Game/Data/DT_ShipClasses.DT_ShipClasses");
+
+void UShipClassRegistry::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// Compile the designer table into the immutable baked registry
+	if (UDataTable* Table = Cast<UDataTable>(FSoftObjectPath(ShipClassTablePath).TryLoad()))
+	{
+		Table->ForeachRow<FShipClassRow>(TEXT("ShipClassRegistry"),
+			[this](const FName& RowName, const FShipClassRow& Row)
+			{
+				BakeClass(RowName, Row);
+			});
+		UE_LOG(LogShipClassRegistry, Log, TEXT("ShipClassRegistry: Baked %d ship classes from %s"),
+			BakedClasses.Num(), ShipClassTablePath);
+	}
+
+	// Without the table (or with an empty one), bake the built-in
+	// Ulysses corvette so ships always have a class to reference
+	if (BakedClasses.Num() == 0)
+	{
+		FShipClassRow Ulysses;
+		Ulysses.ShipClass = EX4ShipClass::Corvette;
+		Ulysses.DesignStyle = EX4DesignStyle::Balanced;
+		Ulysses.Variant = EX4ShipVariant::Standard;
+		Ulysses.Stats.MaxHull = 1500.0f;
+		Ulysses.Stats.MaxShield = 750.0f;
+		Ulysses.Stats.Mass = 500.0f;
+		Ulysses.Stats.MaxSpeed = 80.0f;
+		Ulysses.Stats.Thrust = 5000.0f;
+		Ulysses.Stats.TurnRate = 2.0f;
+		Ulysses.Stats.CargoCapacity = 50;
+		Ulysses.Stats.PowerGeneration = 500.0f;
+		Ulysses.Stats.PowerConsumption = 100.0f;
+		Ulysses.Stats.PrimaryWeaponSlots = 2;
+		Ulysses.Stats.TurretSlots = 0;
+		Ulysses.Stats.UtilitySlots = 2;
+		BakeClass(TEXT("Ulysses"), Ulysses);
+
+		UE_LOG(LogShipClassRegistry, Warning,
+			TEXT("ShipClassRegistry: No ship class table at %s, using built-in defaults"), ShipClassTablePath);
+	}
+}
+
+void UShipClassRegistry::BakeClass(FName ClassName, const FShipClassRow& Row)
+{
+	FBakedShipStats Baked;
+	Baked.ShipClass = Row.ShipClass;
+	Baked.DesignStyle = Row.DesignStyle;
+	Baked.Variant = Row.Variant;
+	Baked.Stats = Row.Stats;
+
+	// Normalize the mutable pools to their authored maxima; instances
+	// copy these out as their starting values
+	Baked.Stats.Hull = Baked.Stats.MaxHull;
+	Baked.Stats.Shield = Baked.Stats.MaxShield;
+
+	// Equipment-independent derived values, computed exactly once here
+	const float Mass = FMath::Max(Baked.Stats.Mass, 1.0f);
+	Baked.BaseAcceleration = Baked.Stats.Thrust / Mass;
+	Baked.ThrustToWeight = Baked.Stats.Thrust / (Mass * 9.81f);
+	Baked.TotalDefensePool = Baked.Stats.MaxHull + Baked.Stats.MaxShield;
+	Baked.PowerMargin = Baked.Stats.PowerGeneration - Baked.Stats.PowerConsumption;
+	Baked.TotalWeaponSlots = Baked.Stats.PrimaryWeaponSlots + Baked.Stats.TurretSlots;
+
+	ClassIndexLookup.Add(ClassName, BakedClasses.Add(MoveTemp(Baked)));
+}
+
+int32 UShipClassRegistry::FindShipClassIndex(FName ClassName) const
+{
+	if (const int32* Index = ClassIndexLookup.Find(ClassName))
+	{
+		return *Index;
+	}
+	return INDEX_NONE;
+}
+
+const FBakedShipStats& UShipClassRegistry::GetShipClass(int32 Index) const
+{
+	// The registry always holds at least the built-in default class
+	if (!BakedClasses.IsValidIndex(Index))
+	{
+		return BakedClasses[0];
+	}
+	return BakedClasses[Index];
+}
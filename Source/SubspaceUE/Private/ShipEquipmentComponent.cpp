@@ -1,27 +1,37 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "ShipEquipmentComponent.h"
+#include "ProjectileSubsystem.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogShipEquipment, Log, All);
 
 UShipEquipmentComponent::UShipEquipmentComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// Ticking is only enabled while time-dependent equipment (charging
+	// engines) is installed; see RefreshTickRequirement
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void UShipEquipmentComponent::BeginPlay()
 {
 	Super::BeginPlay();
+
+	RefreshTickRequirement();
 }
 
 void UShipEquipmentComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Only charge timers and similar time-dependent equipment state
+	// belong here; derived stats are cache-rebuilt on loadout change
 }
 
 void UShipEquipmentComponent::AddEquipmentSlot(const FEquipmentSlot& Slot)
 {
 	EquipmentSlots.Add(Slot);
+	MarkStatsDirty();
 }
 
 bool UShipEquipmentComponent::InstallEquipment(int32 SlotIndex, const FEquipmentItem& Equipment)
@@ -36,6 +46,7 @@ bool UShipEquipmentComponent::InstallEquipment(int32 SlotIndex, const FEquipment
 	Slot.Equipment = Equipment;
 	Slot.bIsOccupied = true;
 
+	MarkStatsDirty();
 	UE_LOG(LogShipEquipment, Log, TEXT("Installed %s in slot %d"), *Equipment.ItemName, SlotIndex);
 	return true;
 }
@@ -57,6 +68,7 @@ bool UShipEquipmentComponent::RemoveEquipment(int32 SlotIndex, FEquipmentItem& O
 	Slot.bIsOccupied = false;
 	Slot.Equipment = FEquipmentItem();
 
+	MarkStatsDirty();
 	return true;
 }
 
@@ -92,15 +104,134 @@ TArray<FEquipmentSlot> UShipEquipmentComponent::GetWeaponSlots() const
 
 float UShipEquipmentComponent::GetTotalPowerConsumption() const
 {
-	float Total = 0.0f;
+	return GetStatModifiers().TotalPowerConsumption;
+}
+
+bool UShipEquipmentComponent::FireWeapon(int32 SlotIndex, const FVector& Direction)
+{
+	if (!EquipmentSlots.IsValidIndex(SlotIndex))
+	{
+		return false;
+	}
+
+	FEquipmentSlot& Slot = EquipmentSlots[SlotIndex];
+	if (!Slot.bIsOccupied ||
+		(Slot.SlotType != EEquipmentSlotType::PrimaryWeapon && Slot.SlotType != EEquipmentSlotType::Turret))
+	{
+		return false;
+	}
+
+	FEquipmentItem& Weapon = Slot.Equipment;
+	if (Weapon.FireRate <= 0.0f || Weapon.Damage <= 0.0f)
+	{
+		return false;
+	}
+
+	const float Now = GetWorld()->GetTimeSeconds();
+	if (const float* NextFireTime = NextFireTimes.Find(SlotIndex))
+	{
+		if (Now < *NextFireTime)
+		{
+			return false;
+		}
+	}
+
+	// Ammo gating only applies to ballistic weapons (capacity zero means
+	// an energy weapon with unlimited shots)
+	if (Weapon.AmmoCapacity > 0)
+	{
+		if (Weapon.CurrentAmmo <= 0)
+		{
+			return false;
+		}
+		--Weapon.CurrentAmmo;
+	}
+
+	UProjectileSubsystem* Projectiles = GetWorld()->GetSubsystem<UProjectileSubsystem>();
+	if (!Projectiles)
+	{
+		return false;
+	}
+
+	// Beam-style weapons declare a projectile speed of zero; they still
+	// go through the pool as a shot fast enough to land within a frame
+	const float Speed = Weapon.ProjectileSpeed > 0.0f ? Weapon.ProjectileSpeed : Weapon.Range * 60.0f;
+
+	AActor* Owner = GetOwner();
+	const FVector MuzzleLocation = Owner->GetActorTransform().TransformPosition(Slot.MountPosition);
+	Projectiles->FireProjectile(Owner, MuzzleLocation, Direction, Speed, Weapon.Damage, Weapon.Range);
+
+	NextFireTimes.Add(SlotIndex, Now + 1.0f / Weapon.FireRate);
+	return true;
+}
+
+void UShipEquipmentComponent::FireAllWeapons(const FVector& Direction)
+{
+	for (int32 SlotIndex = 0; SlotIndex < EquipmentSlots.Num(); ++SlotIndex)
+	{
+		FireWeapon(SlotIndex, Direction);
+	}
+}
+
+const FEquipmentStatModifiers& UShipEquipmentComponent::GetStatModifiers() const
+{
+	if (bStatsDirty)
+	{
+		RebuildStatModifiers();
+	}
+	return CachedStatModifiers;
+}
+
+void UShipEquipmentComponent::MarkStatsDirty()
+{
+	bStatsDirty = true;
+	RefreshTickRequirement();
+}
+
+void UShipEquipmentComponent::RebuildStatModifiers() const
+{
+	CachedStatModifiers = FEquipmentStatModifiers();
+
+	for (const FEquipmentSlot& Slot : EquipmentSlots)
+	{
+		if (!Slot.bIsOccupied)
+		{
+			continue;
+		}
+		const FEquipmentItem& Item = Slot.Equipment;
+
+		if (Slot.SlotType == EEquipmentSlotType::PrimaryWeapon || Slot.SlotType == EEquipmentSlotType::Turret)
+		{
+			CachedStatModifiers.TotalWeaponDPS += Item.Damage * Item.FireRate;
+		}
+		CachedStatModifiers.TotalShieldCapacity += Item.ShieldCapacity;
+		CachedStatModifiers.TotalShieldRegenRate += Item.ShieldRegenRate;
+		CachedStatModifiers.MaxTravelSpeed = FMath::Max(CachedStatModifiers.MaxTravelSpeed, Item.TravelSpeed);
+		CachedStatModifiers.MaxCombatSpeed = FMath::Max(CachedStatModifiers.MaxCombatSpeed, Item.CombatSpeed);
+		CachedStatModifiers.TotalAcceleration += Item.Acceleration;
+		CachedStatModifiers.TotalPowerConsumption += Item.PowerConsumption;
+		CachedStatModifiers.TotalMass += Item.Mass;
+		CachedStatModifiers.TotalCargoBonus += Item.CargoBonus;
+		CachedStatModifiers.TotalMiningPower += Item.MiningPower;
+		CachedStatModifiers.BestScanRange = FMath::Max(CachedStatModifiers.BestScanRange, Item.ScanRange);
+	}
+	bStatsDirty = false;
+}
+
+void UShipEquipmentComponent::RefreshTickRequirement()
+{
+	// Only equipment with real time-dependent state needs the component
+	// to tick; a fully passive loadout costs nothing per frame
+	bool bNeedsTick = false;
 	for (const FEquipmentSlot& Slot : EquipmentSlots)
 	{
-		if (Slot.bIsOccupied)
+		if (Slot.bIsOccupied && Slot.Equipment.ChargeTime > 0.0f)
 		{
-			Total += Slot.Equipment.PowerConsumption;
+			bNeedsTick = true;
+			break;
 		}
 	}
-	return Total;
+	SetComponentTickEnabled(bNeedsTick);
 }
 
 void UShipEquipmentComponent::SetupUlyssesEquipment()
@@ -2,14 +2,38 @@
 
 #include "ShipInteriorComponent.h"
 #include "Components/StaticMeshComponent.h"
+#include "Components/InstancedStaticMeshComponent.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogShipInterior, Log, All);
 
+namespace
+{
+	/** How close a door must be to another cell's bounds to connect them */
+	constexpr float DoorAdjacencyTolerance = 250.0f;
+
+	/** Doors closer than this are the same portal listed by both rooms */
+	constexpr float DoorMergeDistance = 100.0f;
+
+	/** Distance from a point to an axis-aligned box */
+	float DistanceToBounds(const FVector& Point, const FVector& MinBounds, const FVector& MaxBounds)
+	{
+		const FVector Clamped(
+			FMath::Clamp(Point.X, MinBounds.X, MaxBounds.X),
+			FMath::Clamp(Point.Y, MinBounds.Y, MaxBounds.Y),
+			FMath::Clamp(Point.Z, MinBounds.Z, MaxBounds.Z));
+		return FVector::Dist(Point, Clamped);
+	}
+}
+
 UShipInteriorComponent::UShipInteriorComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.TickInterval = 0.25f;  // Player cell tracking only
 	bInteriorAccessible = true;
 	
 	// Cache the cube mesh for spawning
@@ -28,6 +52,24 @@ void UShipInteriorComponent::BeginPlay()
 void UShipInteriorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// Track which cell the player occupies; this drives both interactive
+	// promotion and cell visibility
+	if (ObjectInstances.Num() == 0 || !GetOwner())
+	{
+		return;
+	}
+
+	APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (!PlayerPawn)
+	{
+		SetOccupiedCell(INDEX_NONE);
+		return;
+	}
+
+	const FVector LocalPosition = GetOwner()->GetTransform().InverseTransformPosition(PlayerPawn->GetActorLocation());
+	SetOccupiedCell(FindCellContaining(LocalPosition));
 }
 
 void UShipInteriorComponent::AddCell(const FInteriorCell& Cell)
@@ -81,7 +123,11 @@ void UShipInteriorComponent::GenerateUlyssesInterior()
 	AddCell(GenerateCargoBay());
 	AddCell(GenerateEngineRoom());
 
-	UE_LOG(LogShipInterior, Log, TEXT("Generated Ulysses interior: %d rooms, %d crew capacity"), 
+	// Adjacency and the nav graph derive from Cells; bake them with the
+	// layout so crew can path before any meshes are spawned
+	RebuildCellAdjacency();
+
+	UE_LOG(LogShipInterior, Log, TEXT("Generated Ulysses interior: %d rooms, %d crew capacity"),
 		Cells.Num(), GetTotalCrewCapacity());
 }
 
@@ -97,19 +143,36 @@ void UShipInteriorComponent::SpawnInteriorMeshes()
 		return;
 	}
 
-	// Spawn meshes for each cell
-	for (const FInteriorCell& Cell : Cells)
+	// Room geometry stays per-component (a handful of floors); placed
+	// objects go into one instanced pool per type
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); CellIndex++)
 	{
+		const FInteriorCell& Cell = Cells[CellIndex];
 		SpawnRoomMesh(Cell);
+		while (SpawnedMeshCellIndex.Num() < SpawnedMeshes.Num())
+		{
+			SpawnedMeshCellIndex.Add(CellIndex);
+		}
 
-		// Spawn objects in this cell
-		for (const FInteriorObject& Object : Cell.PlacedObjects)
+		for (int32 ObjectIndex = 0; ObjectIndex < Cell.PlacedObjects.Num(); ObjectIndex++)
 		{
-			SpawnObjectMesh(Object, Cell.MinBounds);
+			AddObjectInstance(Cell.PlacedObjects[ObjectIndex], CellIndex, ObjectIndex);
 		}
 	}
 
-	UE_LOG(LogShipInterior, Log, TEXT("Spawned %d interior meshes"), SpawnedMeshes.Num());
+	RebuildCellAdjacency();
+
+	// Everything spawns visible; seed the visible set to match so the
+	// first update applies the real occupancy-based culling
+	VisibleCells.Empty();
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); CellIndex++)
+	{
+		VisibleCells.Add(CellIndex);
+	}
+	UpdateInteriorVisibility();
+
+	UE_LOG(LogShipInterior, Log, TEXT("Spawned interior: %d room meshes, %d objects in %d instance pools"),
+		SpawnedMeshes.Num(), ObjectInstances.Num(), ObjectInstancePools.Num());
 }
 
 void UShipInteriorComponent::ClearInteriorMeshes()
@@ -122,6 +185,349 @@ void UShipInteriorComponent::ClearInteriorMeshes()
 		}
 	}
 	SpawnedMeshes.Empty();
+
+	for (FInteriorInstanceRef& Ref : ObjectInstances)
+	{
+		if (Ref.PromotedMesh)
+		{
+			Ref.PromotedMesh->DestroyComponent();
+		}
+	}
+	ObjectInstances.Empty();
+
+	for (TPair<EInteriorObjectType, UInstancedStaticMeshComponent*>& PoolPair : ObjectInstancePools)
+	{
+		if (PoolPair.Value)
+		{
+			PoolPair.Value->DestroyComponent();
+		}
+	}
+	ObjectInstancePools.Empty();
+	SpawnedMeshCellIndex.Empty();
+	CellAdjacency.Empty();
+	VisibleCells.Empty();
+	OccupiedCellIndex = INDEX_NONE;
+}
+
+void UShipInteriorComponent::SetOccupiedCell(int32 CellIndex)
+{
+	if (CellIndex == OccupiedCellIndex)
+	{
+		return;
+	}
+
+	// Collapse the old cell's promoted objects, promote the new cell's
+	for (FInteriorInstanceRef& Ref : ObjectInstances)
+	{
+		if (Ref.PromotedMesh && Ref.CellIndex != CellIndex)
+		{
+			DemoteInstance(Ref);
+		}
+		else if (!Ref.PromotedMesh && Ref.CellIndex == CellIndex &&
+			Cells.IsValidIndex(Ref.CellIndex) &&
+			Cells[Ref.CellIndex].PlacedObjects.IsValidIndex(Ref.ObjectIndex) &&
+			Cells[Ref.CellIndex].PlacedObjects[Ref.ObjectIndex].bIsInteractive)
+		{
+			PromoteInstance(Ref);
+		}
+	}
+	OccupiedCellIndex = CellIndex;
+	UpdateInteriorVisibility();
+}
+
+int32 UShipInteriorComponent::FindCellContaining(const FVector& LocalPosition) const
+{
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); CellIndex++)
+	{
+		const FInteriorCell& Cell = Cells[CellIndex];
+		if (LocalPosition.X >= Cell.MinBounds.X && LocalPosition.X <= Cell.MaxBounds.X &&
+		    LocalPosition.Y >= Cell.MinBounds.Y && LocalPosition.Y <= Cell.MaxBounds.Y &&
+		    LocalPosition.Z >= Cell.MinBounds.Z && LocalPosition.Z <= Cell.MaxBounds.Z)
+		{
+			return CellIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UShipInteriorComponent::RebuildCellAdjacency()
+{
+	CellAdjacency.Empty();
+	CellAdjacency.SetNum(Cells.Num());
+
+	// Two cells connect when either one's door sits on (or near) the
+	// other's bounds - the door positions are the portals
+	for (int32 A = 0; A < Cells.Num(); A++)
+	{
+		for (int32 B = A + 1; B < Cells.Num(); B++)
+		{
+			bool bConnected = false;
+			for (const FVector& Door : Cells[A].DoorPositions)
+			{
+				if (DistanceToBounds(Door, Cells[B].MinBounds, Cells[B].MaxBounds) <= DoorAdjacencyTolerance)
+				{
+					bConnected = true;
+					break;
+				}
+			}
+			if (!bConnected)
+			{
+				for (const FVector& Door : Cells[B].DoorPositions)
+				{
+					if (DistanceToBounds(Door, Cells[A].MinBounds, Cells[A].MaxBounds) <= DoorAdjacencyTolerance)
+					{
+						bConnected = true;
+						break;
+					}
+				}
+			}
+			if (bConnected)
+			{
+				CellAdjacency[A].Add(B);
+				CellAdjacency[B].Add(A);
+			}
+		}
+	}
+
+	// The nav graph is derived from the same layout; keep both caches in
+	// step so every rebuild path refreshes them together
+	BakeNavigationGraph();
+}
+
+void UShipInteriorComponent::BakeNavigationGraph()
+{
+	NavNodes.Empty();
+	NavDistances.Empty();
+	NavNextHop.Empty();
+
+	// One node per room center
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); CellIndex++)
+	{
+		FInteriorNavNode Node;
+		Node.Position = (Cells[CellIndex].MinBounds + Cells[CellIndex].MaxBounds) * 0.5f;
+		Node.Cells.Add(CellIndex);
+		NavNodes.Add(Node);
+	}
+
+	// One node per door, merged when two rooms list the same portal, and
+	// tagged with every cell whose bounds the door touches - the same
+	// tolerance rule adjacency uses
+	for (int32 CellIndex = 0; CellIndex < Cells.Num(); CellIndex++)
+	{
+		for (const FVector& Door : Cells[CellIndex].DoorPositions)
+		{
+			FInteriorNavNode* Existing = nullptr;
+			for (int32 NodeIndex = Cells.Num(); NodeIndex < NavNodes.Num(); NodeIndex++)
+			{
+				if (FVector::Dist(NavNodes[NodeIndex].Position, Door) <= DoorMergeDistance)
+				{
+					Existing = &NavNodes[NodeIndex];
+					break;
+				}
+			}
+			if (Existing)
+			{
+				Existing->Cells.AddUnique(CellIndex);
+				continue;
+			}
+
+			FInteriorNavNode Node;
+			Node.Position = Door;
+			for (int32 Other = 0; Other < Cells.Num(); Other++)
+			{
+				if (Other == CellIndex ||
+				    DistanceToBounds(Door, Cells[Other].MinBounds, Cells[Other].MaxBounds) <= DoorAdjacencyTolerance)
+				{
+					Node.Cells.Add(Other);
+				}
+			}
+			NavNodes.Add(Node);
+		}
+	}
+
+	// Direct edges: any two nodes sharing a cell are a straight walk apart
+	const int32 NumNodes = NavNodes.Num();
+	NavDistances.Init(MAX_flt, NumNodes * NumNodes);
+	NavNextHop.Init(INDEX_NONE, NumNodes * NumNodes);
+	for (int32 A = 0; A < NumNodes; A++)
+	{
+		NavDistances[A * NumNodes + A] = 0.0f;
+		NavNextHop[A * NumNodes + A] = A;
+		for (int32 B = A + 1; B < NumNodes; B++)
+		{
+			bool bShareCell = false;
+			for (int32 Cell : NavNodes[A].Cells)
+			{
+				if (NavNodes[B].Cells.Contains(Cell))
+				{
+					bShareCell = true;
+					break;
+				}
+			}
+			if (bShareCell)
+			{
+				const float Cost = FVector::Dist(NavNodes[A].Position, NavNodes[B].Position);
+				NavDistances[A * NumNodes + B] = Cost;
+				NavDistances[B * NumNodes + A] = Cost;
+				NavNextHop[A * NumNodes + B] = B;
+				NavNextHop[B * NumNodes + A] = A;
+			}
+		}
+	}
+
+	// Floyd-Warshall all-pairs; node counts are tiny (a handful of rooms
+	// and doors) so the cube is nothing, and queries become table walks
+	for (int32 Via = 0; Via < NumNodes; Via++)
+	{
+		for (int32 A = 0; A < NumNodes; A++)
+		{
+			const float ToVia = NavDistances[A * NumNodes + Via];
+			if (ToVia == MAX_flt)
+			{
+				continue;
+			}
+			for (int32 B = 0; B < NumNodes; B++)
+			{
+				const float FromVia = NavDistances[Via * NumNodes + B];
+				if (FromVia != MAX_flt && ToVia + FromVia < NavDistances[A * NumNodes + B])
+				{
+					NavDistances[A * NumNodes + B] = ToVia + FromVia;
+					NavNextHop[A * NumNodes + B] = NavNextHop[A * NumNodes + Via];
+				}
+			}
+		}
+	}
+
+	UE_LOG(LogShipInterior, Log, TEXT("Baked interior nav graph: %d nodes (%d rooms)"),
+		NumNodes, Cells.Num());
+}
+
+bool UShipInteriorComponent::BuildCrewPath(const FVector& FromLocal, const FVector& ToLocal, TArray<FVector>& OutPathPoints) const
+{
+	OutPathPoints.Reset();
+
+	const int32 FromCell = FindCellContaining(FromLocal);
+	const int32 ToCell = FindCellContaining(ToLocal);
+	if (FromCell == INDEX_NONE || ToCell == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Same room: rooms are convex boxes, so a straight segment is the path
+	if (FromCell == ToCell)
+	{
+		OutPathPoints.Add(FromLocal);
+		OutPathPoints.Add(ToLocal);
+		return true;
+	}
+
+	// Pick the entry/exit node pair minimizing the full walk: leg to the
+	// entry node, cached graph distance, leg from the exit node
+	const int32 NumNodes = NavNodes.Num();
+	int32 BestEntry = INDEX_NONE;
+	int32 BestExit = INDEX_NONE;
+	float BestCost = MAX_flt;
+	for (int32 Entry = 0; Entry < NumNodes; Entry++)
+	{
+		if (!NavNodes[Entry].Cells.Contains(FromCell))
+		{
+			continue;
+		}
+		const float EntryLeg = FVector::Dist(FromLocal, NavNodes[Entry].Position);
+		for (int32 Exit = 0; Exit < NumNodes; Exit++)
+		{
+			if (!NavNodes[Exit].Cells.Contains(ToCell) ||
+			    NavDistances[Entry * NumNodes + Exit] == MAX_flt)
+			{
+				continue;
+			}
+			const float Cost = EntryLeg + NavDistances[Entry * NumNodes + Exit] +
+				FVector::Dist(NavNodes[Exit].Position, ToLocal);
+			if (Cost < BestCost)
+			{
+				BestCost = Cost;
+				BestEntry = Entry;
+				BestExit = Exit;
+			}
+		}
+	}
+	if (BestEntry == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// Reconstruct by walking the next-hop chain between the chosen nodes
+	OutPathPoints.Add(FromLocal);
+	int32 Node = BestEntry;
+	OutPathPoints.Add(NavNodes[Node].Position);
+	while (Node != BestExit)
+	{
+		Node = NavNextHop[Node * NumNodes + BestExit];
+		if (Node == INDEX_NONE)
+		{
+			OutPathPoints.Reset();
+			return false;
+		}
+		OutPathPoints.Add(NavNodes[Node].Position);
+	}
+	OutPathPoints.Add(ToLocal);
+	return true;
+}
+
+void UShipInteriorComponent::UpdateInteriorVisibility()
+{
+	// Visible set: the occupied cell plus its door-adjacent neighbours.
+	// No occupied cell (player outside or piloting) hides the interior
+	// entirely.
+	TSet<int32> NewVisible;
+	if (OccupiedCellIndex != INDEX_NONE)
+	{
+		NewVisible.Add(OccupiedCellIndex);
+		if (CellAdjacency.IsValidIndex(OccupiedCellIndex))
+		{
+			for (int32 Neighbour : CellAdjacency[OccupiedCellIndex])
+			{
+				NewVisible.Add(Neighbour);
+			}
+		}
+	}
+	if (NewVisible.Num() == VisibleCells.Num() && NewVisible.Includes(VisibleCells))
+	{
+		return;
+	}
+
+	for (int32 i = 0; i < SpawnedMeshes.Num(); i++)
+	{
+		if (SpawnedMeshes[i] && SpawnedMeshCellIndex.IsValidIndex(i))
+		{
+			SpawnedMeshes[i]->SetVisibility(NewVisible.Contains(SpawnedMeshCellIndex[i]));
+		}
+	}
+
+	for (FInteriorInstanceRef& Ref : ObjectInstances)
+	{
+		SetInstanceHidden(Ref, !NewVisible.Contains(Ref.CellIndex));
+	}
+	VisibleCells = MoveTemp(NewVisible);
+}
+
+void UShipInteriorComponent::SetInstanceHidden(FInteriorInstanceRef& Ref, bool bHidden)
+{
+	// Promoted objects are real components in the occupied cell; their
+	// pool instance is already collapsed
+	if (Ref.PromotedMesh ||
+	    !Cells.IsValidIndex(Ref.CellIndex) || !Cells[Ref.CellIndex].PlacedObjects.IsValidIndex(Ref.ObjectIndex))
+	{
+		return;
+	}
+	const FInteriorObject& Object = Cells[Ref.CellIndex].PlacedObjects[Ref.ObjectIndex];
+
+	if (UInstancedStaticMeshComponent** Pool = ObjectInstancePools.Find(Ref.Type))
+	{
+		const FVector Scale = bHidden ? FVector::ZeroVector : Object.Size / 100.0f;
+		(*Pool)->UpdateInstanceTransform(Ref.InstanceIndex,
+			FTransform(Object.Rotation, Object.Position, Scale), /*bWorldSpace*/ false, /*bMarkRenderStateDirty*/ true);
+	}
 }
 
 void UShipInteriorComponent::SpawnRoomMesh(const FInteriorCell& Cell)
@@ -156,38 +562,100 @@ void UShipInteriorComponent::SpawnRoomMesh(const FInteriorCell& Cell)
 	// For now, this provides a basic floor for each room
 }
 
-void UShipInteriorComponent::SpawnObjectMesh(const FInteriorObject& Object, const FVector& CellOffset)
+void UShipInteriorComponent::AddObjectInstance(const FInteriorObject& Object, int32 CellIndex, int32 ObjectIndex)
+{
+	UInstancedStaticMeshComponent* Pool = GetOrCreateInstancePool(Object.Type);
+	if (!Pool)
+	{
+		return;
+	}
+
+	FInteriorInstanceRef Ref;
+	Ref.Type = Object.Type;
+	Ref.CellIndex = CellIndex;
+	Ref.ObjectIndex = ObjectIndex;
+	Ref.InstanceIndex = Pool->AddInstance(
+		FTransform(Object.Rotation, Object.Position, Object.Size / 100.0f), /*bWorldSpace*/ false);
+	ObjectInstances.Add(Ref);
+}
+
+UInstancedStaticMeshComponent* UShipInteriorComponent::GetOrCreateInstancePool(EInteriorObjectType Type)
 {
+	if (UInstancedStaticMeshComponent** Existing = ObjectInstancePools.Find(Type))
+	{
+		return *Existing;
+	}
+
 	AActor* Owner = GetOwner();
-	if (!Owner) return;
+	if (!Owner)
+	{
+		return nullptr;
+	}
 
-	// Spawn object mesh
+	UInstancedStaticMeshComponent* Pool = NewObject<UInstancedStaticMeshComponent>(Owner);
+	Pool->RegisterComponent();
+	Pool->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	if (CachedCubeMesh)
+	{
+		Pool->SetStaticMesh(CachedCubeMesh);
+	}
+	Pool->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+
+	ObjectInstancePools.Add(Type, Pool);
+	return Pool;
+}
+
+void UShipInteriorComponent::PromoteInstance(FInteriorInstanceRef& Ref)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner || !Cells.IsValidIndex(Ref.CellIndex) ||
+	    !Cells[Ref.CellIndex].PlacedObjects.IsValidIndex(Ref.ObjectIndex))
+	{
+		return;
+	}
+	const FInteriorObject& Object = Cells[Ref.CellIndex].PlacedObjects[Ref.ObjectIndex];
+
+	// Real component with full collision for interaction traces
 	UStaticMeshComponent* ObjectMesh = NewObject<UStaticMeshComponent>(Owner);
-	if (ObjectMesh)
+	ObjectMesh->RegisterComponent();
+	ObjectMesh->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+	ObjectMesh->SetRelativeLocation(Object.Position);
+	ObjectMesh->SetRelativeRotation(Object.Rotation);
+	ObjectMesh->SetRelativeScale3D(Object.Size / 100.0f);
+	if (CachedCubeMesh)
 	{
-		ObjectMesh->RegisterComponent();
-		ObjectMesh->AttachToComponent(Owner->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-		ObjectMesh->SetRelativeLocation(Object.Position);
-		ObjectMesh->SetRelativeRotation(Object.Rotation);
-		ObjectMesh->SetRelativeScale3D(Object.Size / 100.0f);
-		
-		// Use cached cube mesh as placeholder
-		if (CachedCubeMesh)
-		{
-			ObjectMesh->SetStaticMesh(CachedCubeMesh);
-		}
-		
-		// Make interactive objects highlighted or use different collision
-		if (Object.bIsInteractive)
-		{
-			ObjectMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-		}
-		else
-		{
-			ObjectMesh->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
-		}
-		
-		SpawnedMeshes.Add(ObjectMesh);
+		ObjectMesh->SetStaticMesh(CachedCubeMesh);
+	}
+	ObjectMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+	Ref.PromotedMesh = ObjectMesh;
+
+	// Zero-scale the pool instance rather than removing it, so instance
+	// indices stay stable for every other record
+	if (UInstancedStaticMeshComponent** Pool = ObjectInstancePools.Find(Ref.Type))
+	{
+		(*Pool)->UpdateInstanceTransform(Ref.InstanceIndex,
+			FTransform(Object.Rotation, Object.Position, FVector::ZeroVector), /*bWorldSpace*/ false, /*bMarkRenderStateDirty*/ true);
+	}
+}
+
+void UShipInteriorComponent::DemoteInstance(FInteriorInstanceRef& Ref)
+{
+	if (Ref.PromotedMesh)
+	{
+		Ref.PromotedMesh->DestroyComponent();
+		Ref.PromotedMesh = nullptr;
+	}
+
+	if (!Cells.IsValidIndex(Ref.CellIndex) || !Cells[Ref.CellIndex].PlacedObjects.IsValidIndex(Ref.ObjectIndex))
+	{
+		return;
+	}
+	const FInteriorObject& Object = Cells[Ref.CellIndex].PlacedObjects[Ref.ObjectIndex];
+
+	if (UInstancedStaticMeshComponent** Pool = ObjectInstancePools.Find(Ref.Type))
+	{
+		(*Pool)->UpdateInstanceTransform(Ref.InstanceIndex,
+			FTransform(Object.Rotation, Object.Position, Object.Size / 100.0f), /*bWorldSpace*/ false, /*bMarkRenderStateDirty*/ true);
 	}
 }
 
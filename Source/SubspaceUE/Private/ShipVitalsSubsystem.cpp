@@ -0,0 +1,144 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "ShipVitalsSubsystem.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogShipVitals, Log, All);
+
+void UShipVitalsSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	UpdateTimer += DeltaTime;
+	if (UpdateTimer < UpdateInterval || Ships.Num() == 0)
+	{
+		return;
+	}
+
+	// One clamp-and-add pass over contiguous arrays for every ship in
+	// the sector; the elapsed accumulator keeps the rates exact even
+	// though the pass runs at 10 Hz rather than per frame
+	const float Elapsed = UpdateTimer;
+	UpdateTimer = 0.0f;
+
+	const int32 Count = Ships.Num();
+	for (int32 i = 0; i < Count; ++i)
+	{
+		Shields[i] = FMath::Min(Shields[i] + ShieldRegenRates[i] * Elapsed, MaxShields[i]);
+		Energies[i] = FMath::Min(Energies[i] + EnergyRegenRates[i] * Elapsed, MaxEnergies[i]);
+	}
+
+	// Drop entries whose actors are gone; rare enough to fold in here
+	for (int32 i = Ships.Num() - 1; i >= 0; --i)
+	{
+		if (!Ships[i].IsValid())
+		{
+			ShipIndexLookup.Remove(Ships[i]);
+			Ships.RemoveAtSwap(i, EAllowShrinking::No);
+			Shields.RemoveAtSwap(i, EAllowShrinking::No);
+			MaxShields.RemoveAtSwap(i, EAllowShrinking::No);
+			ShieldRegenRates.RemoveAtSwap(i, EAllowShrinking::No);
+			Energies.RemoveAtSwap(i, EAllowShrinking::No);
+			MaxEnergies.RemoveAtSwap(i, EAllowShrinking::No);
+			EnergyRegenRates.RemoveAtSwap(i, EAllowShrinking::No);
+
+			if (Ships.IsValidIndex(i))
+			{
+				ShipIndexLookup.Add(Ships[i], i);
+			}
+		}
+	}
+}
+
+TStatId UShipVitalsSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UShipVitalsSubsystem, STATGROUP_Tickables);
+}
+
+void UShipVitalsSubsystem::RegisterShip(AActor* Ship, float MaxShield, float ShieldRegenRate,
+	float MaxEnergy, float EnergyRegenRate, float InitialShield, float InitialEnergy)
+{
+	if (!Ship || ShipIndexLookup.Contains(Ship))
+	{
+		return;
+	}
+
+	const int32 Index = Ships.Add(Ship);
+	Shields.Add(FMath::Clamp(InitialShield, 0.0f, MaxShield));
+	MaxShields.Add(MaxShield);
+	ShieldRegenRates.Add(ShieldRegenRate);
+	Energies.Add(FMath::Clamp(InitialEnergy, 0.0f, MaxEnergy));
+	MaxEnergies.Add(MaxEnergy);
+	EnergyRegenRates.Add(EnergyRegenRate);
+	ShipIndexLookup.Add(Ship, Index);
+
+	UE_LOG(LogShipVitals, Verbose, TEXT("ShipVitals: Registered %s (%d ships)"),
+		*Ship->GetName(), Ships.Num());
+}
+
+void UShipVitalsSubsystem::UnregisterShip(AActor* Ship)
+{
+	int32 Index;
+	if (!Ship || !ShipIndexLookup.RemoveAndCopyValue(Ship, Index))
+	{
+		return;
+	}
+
+	Ships.RemoveAtSwap(Index, EAllowShrinking::No);
+	Shields.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxShields.RemoveAtSwap(Index, EAllowShrinking::No);
+	ShieldRegenRates.RemoveAtSwap(Index, EAllowShrinking::No);
+	Energies.RemoveAtSwap(Index, EAllowShrinking::No);
+	MaxEnergies.RemoveAtSwap(Index, EAllowShrinking::No);
+	EnergyRegenRates.RemoveAtSwap(Index, EAllowShrinking::No);
+
+	if (Ships.IsValidIndex(Index))
+	{
+		ShipIndexLookup.Add(Ships[Index], Index);
+	}
+}
+
+float UShipVitalsSubsystem::GetShield(AActor* Ship) const
+{
+	const int32* Index = ShipIndexLookup.Find(Ship);
+	return Index ? Shields[*Index] : 0.0f;
+}
+
+float UShipVitalsSubsystem::GetEnergy(AActor* Ship) const
+{
+	const int32* Index = ShipIndexLookup.Find(Ship);
+	return Index ? Energies[*Index] : 0.0f;
+}
+
+float UShipVitalsSubsystem::DrainShield(AActor* Ship, float Amount)
+{
+	const int32* Index = ShipIndexLookup.Find(Ship);
+	if (!Index || Amount <= 0.0f)
+	{
+		return Amount;
+	}
+
+	const float Absorbed = FMath::Min(Amount, Shields[*Index]);
+	Shields[*Index] -= Absorbed;
+	return Amount - Absorbed;
+}
+
+bool UShipVitalsSubsystem::ConsumeEnergy(AActor* Ship, float Amount)
+{
+	const int32* Index = ShipIndexLookup.Find(Ship);
+	if (!Index || Energies[*Index] < Amount)
+	{
+		return false;
+	}
+
+	Energies[*Index] -= Amount;
+	return true;
+}
+
+void UShipVitalsSubsystem::SetShield(AActor* Ship, float NewShield)
+{
+	if (const int32* Index = ShipIndexLookup.Find(Ship))
+	{
+		Shields[*Index] = FMath::Clamp(NewShield, 0.0f, MaxShields[*Index]);
+	}
+}
@@ -1,6 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SolarSystemManager.h"
+#include "InitSchedulerSubsystem.h"
+#include "SubspaceStats.h"
+#include "Async/ParallelFor.h"
 #include "Engine/World.h"
 #include "Engine/StaticMeshActor.h"
 #include "Components/StaticMeshComponent.h"
@@ -18,9 +21,13 @@ ASolarSystemManager::ASolarSystemManager()
 	DistanceScale = 0.00001;  // 1:100,000 scale for distances
 	PlanetSizeScale = 50.0;   // Planets 50x larger than realistic for visibility
 	GlobalTimeMultiplier = 10000.0;  // Speed up time 10,000x so we can see orbits
-	
+	OrbitSolverTimestep = 0.25;  // Solver passes at 4 Hz, interpolated in between
+
 	bAutoSpawnPlanets = true;
 	bSpawnSun = true;
+	bEnablePlanetStreaming = false;
+	PlanetStreamingRadius = 200000000.0;  // ~1.3 AU at the default distance scale
+	StreamingCheckTimer = 0.0;
 	bOrbitsPaused = false;
 	StoredTimeMultiplier = GlobalTimeMultiplier;
 
@@ -32,19 +39,284 @@ void ASolarSystemManager::BeginPlay()
 {
 	Super::BeginPlay();
 
-	if (bAutoSpawnPlanets)
+	if (!bAutoSpawnPlanets)
+	{
+		return;
+	}
+
+	// Stage the spawn through the init scheduler (one body per step) so
+	// map load does not stall on nine planet meshes in one frame
+	if (UInitSchedulerSubsystem* Init = GetWorld() ? GetWorld()->GetSubsystem<UInitSchedulerSubsystem>() : nullptr)
+	{
+		Init->EnqueueStage(TEXT("Solar System"), 1,
+			[WeakThis = TWeakObjectPtr<ASolarSystemManager>(this), Step = 0]() mutable
+			{
+				ASolarSystemManager* Manager = WeakThis.Get();
+				return !Manager || Manager->RunWorldSpawnStep(Step++);
+			});
+		return;
+	}
+
+	if (bSpawnSun)
+	{
+		SpawnSunActor();
+	}
+	SpawnAllPlanets();
+}
+
+bool ASolarSystemManager::RunWorldSpawnStep(int32 StepIndex)
+{
+	if (StepIndex == 0)
 	{
 		if (bSpawnSun)
 		{
 			SpawnSunActor();
 		}
-		SpawnAllPlanets();
+
+		// Cache the spawn data up front; streaming no-ops until Planets
+		// catches up to it, so the half-built state is inert
+		ManagedPlanetData = GetPlanetaryData();
+		Planets.Reset();
+		return false;
+	}
+
+	const int32 PlanetIndex = StepIndex - 1;
+	if (ManagedPlanetData.IsValidIndex(PlanetIndex))
+	{
+		const FPlanetData& Data = ManagedPlanetData[PlanetIndex];
+		APlanetActor* Planet = CreatePlanet(
+			Data.Name,
+			Data.SemiMajorAxisAU,
+			Data.Eccentricity,
+			Data.OrbitalPeriodDays,
+			Data.InclinationDeg,
+			Data.LongitudeAscendingNodeDeg,
+			Data.ArgumentPeriapsisDeg,
+			Data.MeanAnomalyAtEpochDeg,
+			Data.DiameterKm,
+			Data.MassEarthMasses,
+			Data.RotationPeriodDays,
+			Data.bHasMoons
+		);
+		if (Planet)
+		{
+			Planets.Add(Planet);
+			UE_LOG(LogTemp, Log, TEXT("Solar System: Spawned %s at distance %.2f units"),
+				*Data.Name, Planet->SemiMajorAxis);
+		}
+		return false;
 	}
+
+	// All bodies spawned; hand the orbits to the batched solver
+	RebuildOrbitSolverArrays();
+	UE_LOG(LogTemp, Log, TEXT("Solar System: Spawned %d planets across frames"), Planets.Num());
+	return true;
 }
 
 void ASolarSystemManager::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+
+	if (Solver.CurrPositions.Num() == 0)
+	{
+		return;
+	}
+
+	// Fixed-timestep solver passes; actor transforms interpolate between
+	// the last two passes so motion stays smooth at any frame rate
+	Solver.Accumulator += DeltaTime;
+	while (Solver.Accumulator >= OrbitSolverTimestep)
+	{
+		Solver.Accumulator -= OrbitSolverTimestep;
+		StepOrbitSolver(OrbitSolverTimestep * GlobalTimeMultiplier);
+	}
+	InterpolatePlanetTransforms(static_cast<float>(Solver.Accumulator / OrbitSolverTimestep));
+
+	// Periodic distance check for planet hibernation
+	if (bEnablePlanetStreaming)
+	{
+		StreamingCheckTimer -= DeltaTime;
+		if (StreamingCheckTimer <= 0.0)
+		{
+			StreamingCheckTimer = 1.0;
+			UpdatePlanetStreaming();
+		}
+	}
+}
+
+void ASolarSystemManager::UpdatePlanetStreaming()
+{
+	if (ManagedPlanetData.Num() != Planets.Num())
+	{
+		return;
+	}
+
+	APlayerController* PlayerController = GetWorld() ? GetWorld()->GetFirstPlayerController() : nullptr;
+	APawn* PlayerPawn = PlayerController ? PlayerController->GetPawn() : nullptr;
+	if (!PlayerPawn)
+	{
+		return;
+	}
+
+	const FVector PlayerLocation = PlayerPawn->GetActorLocation();
+	const double RadiusSquared = PlanetStreamingRadius * PlanetStreamingRadius;
+
+	for (int32 Body = 0; Body < Planets.Num(); ++Body)
+	{
+		// The solver keeps orbital positions current for hibernated
+		// planets too, so the distance test needs no actor
+		const double DistSquared = FVector::DistSquared(PlayerLocation, Solver.CurrPositions[Body]);
+
+		if (Planets[Body] && DistSquared > RadiusSquared)
+		{
+			UE_LOG(LogTemp, Log, TEXT("Solar System: Hibernating %s"), *ManagedPlanetData[Body].Name);
+			Planets[Body]->Destroy();
+			Planets[Body] = nullptr;
+		}
+		else if (!Planets[Body] && DistSquared <= RadiusSquared)
+		{
+			const FPlanetData& Data = ManagedPlanetData[Body];
+			APlanetActor* Planet = CreatePlanet(
+				Data.Name,
+				Data.SemiMajorAxisAU,
+				Data.Eccentricity,
+				Data.OrbitalPeriodDays,
+				Data.InclinationDeg,
+				Data.LongitudeAscendingNodeDeg,
+				Data.ArgumentPeriapsisDeg,
+				Data.MeanAnomalyAtEpochDeg,
+				Data.DiameterKm,
+				Data.MassEarthMasses,
+				Data.RotationPeriodDays,
+				Data.bHasMoons
+			);
+			if (Planet)
+			{
+				Planet->bOrbitDrivenBySolver = true;
+				Planet->SetActorLocation(Solver.CurrPositions[Body]);
+				Planets[Body] = Planet;
+				UE_LOG(LogTemp, Log, TEXT("Solar System: Restored %s from hibernation"), *Data.Name);
+			}
+		}
+	}
+}
+
+void ASolarSystemManager::RebuildOrbitSolverArrays()
+{
+	const int32 NumBodies = Planets.Num();
+	Solver.SemiMajorAxis.SetNum(NumBodies);
+	Solver.SemiMinorAxis.SetNum(NumBodies);
+	Solver.Eccentricity.SetNum(NumBodies);
+	Solver.MeanMotion.SetNum(NumBodies);
+	Solver.MeanAnomalyAtEpoch.SetNum(NumBodies);
+	Solver.BasisX.SetNum(NumBodies);
+	Solver.BasisY.SetNum(NumBodies);
+	Solver.PrevPositions.SetNum(NumBodies);
+	Solver.CurrPositions.SetNum(NumBodies);
+	Solver.SimTime = 0.0;
+	Solver.Accumulator = 0.0;
+
+	for (int32 Body = 0; Body < NumBodies; ++Body)
+	{
+		APlanetActor* Planet = Planets[Body];
+		if (!Planet)
+		{
+			continue;
+		}
+
+		Solver.SemiMajorAxis[Body] = Planet->SemiMajorAxis;
+		Solver.SemiMinorAxis[Body] = Planet->SemiMajorAxis * FMath::Sqrt(1.0 - Planet->Eccentricity * Planet->Eccentricity);
+		Solver.Eccentricity[Body] = Planet->Eccentricity;
+		Solver.MeanMotion[Body] = (2.0 * PI) / (Planet->OrbitalPeriodDays * 86400.0);
+		Solver.MeanAnomalyAtEpoch[Body] = FMath::DegreesToRadians(Planet->MeanAnomalyAtEpoch);
+
+		// Bake the constant orientation chain (argument of periapsis,
+		// inclination, ascending node) into in-plane basis vectors:
+		// position = center + BasisX * a(cosE - e) + BasisY * b*sinE
+		const double ArgP = FMath::DegreesToRadians(Planet->ArgumentOfPeriapsis);
+		const double Inc = FMath::DegreesToRadians(Planet->Inclination);
+		const double Lan = FMath::DegreesToRadians(Planet->LongitudeOfAscendingNode);
+		auto OrientPlaneVector = [ArgP, Inc, Lan](double X, double Y)
+		{
+			const double X1 = X * FMath::Cos(ArgP) - Y * FMath::Sin(ArgP);
+			const double Y1 = X * FMath::Sin(ArgP) + Y * FMath::Cos(ArgP);
+			const double Y2 = Y1 * FMath::Cos(Inc);
+			const double Z2 = Y1 * FMath::Sin(Inc);
+			return FVector(
+				X1 * FMath::Cos(Lan) - Y2 * FMath::Sin(Lan),
+				X1 * FMath::Sin(Lan) + Y2 * FMath::Cos(Lan),
+				Z2
+			);
+		};
+		Solver.BasisX[Body] = OrientPlaneVector(1.0, 0.0);
+		Solver.BasisY[Body] = OrientPlaneVector(0.0, 1.0);
+
+		Planet->bOrbitDrivenBySolver = true;
+	}
+
+	// Prime both position sets so the first interpolated frame is valid
+	StepOrbitSolver(0.0);
+	Solver.PrevPositions = Solver.CurrPositions;
+	InterpolatePlanetTransforms(0.0f);
+
+	UE_LOG(LogTemp, Log, TEXT("Solar System: Batched orbit solver rebuilt for %d bodies"), NumBodies);
+}
+
+void ASolarSystemManager::StepOrbitSolver(double SimDeltaSeconds)
+{
+	SCOPE_CYCLE_COUNTER(STAT_SubspaceOrbitStep);
+	CSV_SCOPED_TIMING_STAT(Subspace, OrbitStep);
+
+	Solver.SimTime += SimDeltaSeconds;
+	Solver.PrevPositions = Solver.CurrPositions;
+
+	const FVector OrbitCenter = GetActorLocation();
+	const double SimTime = Solver.SimTime;
+	FOrbitSolverState& State = Solver;
+
+	// One contiguous pass over the element arrays; bodies are independent
+	ParallelFor(State.CurrPositions.Num(), [&State, OrbitCenter, SimTime](int32 Body)
+	{
+		double MeanAnomaly = State.MeanAnomalyAtEpoch[Body] + State.MeanMotion[Body] * SimTime;
+		MeanAnomaly = FMath::Fmod(MeanAnomaly, 2.0 * PI);
+		if (MeanAnomaly < 0.0)
+		{
+			MeanAnomaly += 2.0 * PI;
+		}
+
+		// Newton-Raphson on Kepler's equation M = E - e*sin(E)
+		const double Eccentricity = State.Eccentricity[Body];
+		double EccentricAnomaly = MeanAnomaly;
+		for (int32 Iteration = 0; Iteration < 10; ++Iteration)
+		{
+			const double F = EccentricAnomaly - Eccentricity * FMath::Sin(EccentricAnomaly) - MeanAnomaly;
+			const double FPrime = 1.0 - Eccentricity * FMath::Cos(EccentricAnomaly);
+			const double Delta = F / FPrime;
+			EccentricAnomaly -= Delta;
+			if (FMath::Abs(Delta) < 1e-8)
+			{
+				break;
+			}
+		}
+
+		const double PlaneX = State.SemiMajorAxis[Body] * (FMath::Cos(EccentricAnomaly) - Eccentricity);
+		const double PlaneY = State.SemiMinorAxis[Body] * FMath::Sin(EccentricAnomaly);
+		State.CurrPositions[Body] = OrbitCenter + State.BasisX[Body] * PlaneX + State.BasisY[Body] * PlaneY;
+	});
+}
+
+void ASolarSystemManager::InterpolatePlanetTransforms(float Alpha)
+{
+	for (int32 Body = 0; Body < Planets.Num(); ++Body)
+	{
+		APlanetActor* Planet = Planets[Body];
+		if (Planet && Planet->bOrbitDrivenBySolver)
+		{
+			const FVector NewPosition = FMath::Lerp(Solver.PrevPositions[Body], Solver.CurrPositions[Body], Alpha);
+			Planet->SetActorLocation(NewPosition);
+			Planet->OnOrbitPositionUpdated(NewPosition);
+		}
+	}
 }
 
 void ASolarSystemManager::SpawnSunActor()
@@ -111,6 +383,12 @@ void ASolarSystemManager::SpawnAllPlanets()
 	}
 
 	UE_LOG(LogTemp, Log, TEXT("Solar System: Spawned %d planets"), Planets.Num());
+
+	// Keep the spawn data around so hibernated planets can be respawned
+	ManagedPlanetData = PlanetaryData;
+
+	// Hand all orbits to the batched solver
+	RebuildOrbitSolverArrays();
 }
 
 APlanetActor* ASolarSystemManager::SpawnPlanet(FString PlanetName)
@@ -161,9 +439,10 @@ APlanetActor* ASolarSystemManager::CreatePlanet(
 		return nullptr;
 	}
 
-	// Spawn the planet actor
+	// Spawn the planet actor. Unique name so a planet respawned from
+	// hibernation does not collide with its not-yet-collected predecessor.
 	FActorSpawnParameters SpawnParams;
-	SpawnParams.Name = FName(*Name);
+	SpawnParams.Name = MakeUniqueObjectName(GetWorld()->GetCurrentLevel(), PlanetActorClass, FName(*Name));
 	SpawnParams.Owner = this;
 
 	FVector SpawnLocation = GetActorLocation();  // Will be repositioned by orbit calculation
@@ -261,13 +540,29 @@ FVector ASolarSystemManager::GetSunPosition() const
 
 void ASolarSystemManager::SetAllPlanetsOrbitPosition(double NormalizedPosition)
 {
-	for (APlanetActor* Planet : Planets)
+	const double MeanAnomaly = NormalizedPosition * 2.0 * PI;
+	for (int32 Body = 0; Body < Planets.Num(); ++Body)
 	{
-		if (Planet)
+		APlanetActor* Planet = Planets[Body];
+		if (!Planet)
+		{
+			continue;
+		}
+		Planet->SetOrbitPosition(NormalizedPosition);
+
+		// Re-anchor the solver's epoch so the batched solve continues
+		// from the teleported position
+		if (Solver.MeanAnomalyAtEpoch.IsValidIndex(Body))
 		{
-			Planet->SetOrbitPosition(NormalizedPosition);
+			Solver.MeanAnomalyAtEpoch[Body] = MeanAnomaly - Solver.MeanMotion[Body] * Solver.SimTime;
 		}
 	}
+
+	if (Solver.CurrPositions.Num() > 0)
+	{
+		StepOrbitSolver(0.0);
+		Solver.PrevPositions = Solver.CurrPositions;
+	}
 }
 
 double ASolarSystemManager::AUToUnrealUnits(double AU) const
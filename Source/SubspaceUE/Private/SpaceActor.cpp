@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SpaceActor.h"
+#include "SpatialPartitionSubsystem.h"
 #include "Components/StaticMeshComponent.h"
 #include "UObject/ConstructorHelpers.h"
 
@@ -26,6 +27,22 @@ ASpaceActor::ASpaceActor()
 void ASpaceActor::BeginPlay()
 {
 	Super::BeginPlay();
+
+	// Register with the sector spatial partition for proximity queries
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->RegisterActor(this);
+	}
+}
+
+void ASpaceActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->UnregisterActor(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void ASpaceActor::Tick(float DeltaTime)
@@ -1,6 +1,7 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SpaceLightingActor.h"
+#include "LightRelevanceSubsystem.h"
 #include "Components/DirectionalLightComponent.h"
 #include "Components/SkyLightComponent.h"
 
@@ -36,4 +37,20 @@ void ASpaceLightingActor::BeginPlay()
 	{
 		SkyLight->RecaptureSky();
 	}
+
+	LightRelevance = GetWorld()->GetSubsystem<ULightRelevanceSubsystem>();
+	if (LightRelevance.IsValid())
+	{
+		LightRelevance->RegisterLight(this);
+	}
+}
+
+void ASpaceLightingActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (LightRelevance.IsValid())
+	{
+		LightRelevance->UnregisterLight(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
@@ -6,20 +6,35 @@
 #include "Materials/MaterialInterface.h"
 #include "UObject/ConstructorHelpers.h"
 #include "Engine/World.h"
+#include "Engine/Texture2D.h"
 #include "Camera/PlayerCameraManager.h"
 #include "GameFramework/PlayerController.h"
 
+namespace
+{
+	/** Baked starfield side length in pixels */
+	constexpr int32 StarfieldTextureSize = 1024;
+
+	/** Star count at density 1.0 */
+	constexpr int32 MaxStarCount = 20000;
+
+	/** Fixed seed so the starfield is identical every session */
+	constexpr int32 StarfieldSeed = 1337;
+}
+
 ASpaceSkyboxActor::ASpaceSkyboxActor()
 {
 	PrimaryActorTick.bCanEverTick = true;
+	// Only enabled in BeginPlay when camera-follow or rotation needs it
+	PrimaryActorTick.bStartWithTickEnabled = false;
 
 	// Create skybox mesh component
 	SkyboxMesh = CreateDefaultSubobject<UStaticMeshComponent>(TEXT("SkyboxMesh"));
 	RootComponent = SkyboxMesh;
-	
+
 	// Scale factor for converting radius to mesh scale (sphere mesh default size is ~100 units diameter)
 	const float MeshScaleFactor = 50.0f;
-	
+
 	// Load sphere mesh
 	static ConstructorHelpers::FObjectFinder<UStaticMesh> SphereMesh(TEXT("/Engine/BasicShapes/Sphere"));
 	if (SphereMesh.Succeeded())
@@ -41,12 +56,13 @@ ASpaceSkyboxActor::ASpaceSkyboxActor()
 void ASpaceSkyboxActor::BeginPlay()
 {
 	Super::BeginPlay();
-	
+
 	// Create dynamic material instance if a base material is set
 	if (SkyboxMaterial && SkyboxMesh)
 	{
 		DynamicMaterial = UMaterialInstanceDynamic::Create(SkyboxMaterial, this);
 		SkyboxMesh->SetMaterial(0, DynamicMaterial);
+		CreateProceduralStarfield();
 		UpdateMaterialParameters();
 	}
 	else
@@ -54,7 +70,11 @@ void ASpaceSkyboxActor::BeginPlay()
 		// Create a simple procedural starfield if no material is provided
 		CreateProceduralStarfield();
 	}
-	
+
+	// The tick only moves/rotates the skybox; parameters are pushed on
+	// change, so a static skybox needs no tick at all
+	SetActorTickEnabled(bFollowCamera || bRotateSkybox);
+
 	UE_LOG(LogTemp, Log, TEXT("SpaceSkyboxActor: Initialized skybox"));
 }
 
@@ -84,21 +104,94 @@ void ASpaceSkyboxActor::UpdateMaterialParameters()
 		return;
 	}
 
-	// Update material parameters
-	DynamicMaterial->SetScalarParameterValue(TEXT("StarBrightness"), StarBrightness);
-	DynamicMaterial->SetScalarParameterValue(TEXT("StarDensity"), StarDensity);
-	DynamicMaterial->SetVectorParameterValue(TEXT("NebulaColor"), NebulaColor);
+	// Render-thread parameter updates are not free; only push values
+	// that actually changed since the last call
+	if (!FMath::IsNearlyEqual(PushedStarBrightness, StarBrightness))
+	{
+		DynamicMaterial->SetScalarParameterValue(TEXT("StarBrightness"), StarBrightness);
+		PushedStarBrightness = StarBrightness;
+	}
+	if (!FMath::IsNearlyEqual(PushedStarDensity, StarDensity))
+	{
+		DynamicMaterial->SetScalarParameterValue(TEXT("StarDensity"), StarDensity);
+		PushedStarDensity = StarDensity;
+	}
+	if (!PushedNebulaColor.Equals(NebulaColor))
+	{
+		DynamicMaterial->SetVectorParameterValue(TEXT("NebulaColor"), NebulaColor);
+		PushedNebulaColor = NebulaColor;
+	}
 }
 
 void ASpaceSkyboxActor::CreateProceduralStarfield()
 {
-	// This is a placeholder - in a real implementation, you would:
-	// 1. Create a material with noise functions for stars
-	// 2. Use particle systems for distant stars
-	// 3. Or use a pre-made space skybox texture
-	
-	UE_LOG(LogTemp, Warning, TEXT("SpaceSkyboxActor: No skybox material set. Please assign a starfield material in the editor."));
-	UE_LOG(LogTemp, Log, TEXT("SpaceSkyboxActor: You can use a basic emissive material with a star texture, or create one using the Material Editor."));
+	// Bake (or reuse) the session-wide starfield texture. The bake runs
+	// once per session, not once per map load, so sector travel does not
+	// pay it again.
+	UTexture2D* Starfield = GetOrBakeStarfieldTexture(StarDensity);
+
+	if (DynamicMaterial && Starfield)
+	{
+		// Harmless if the assigned material has no such parameter
+		DynamicMaterial->SetTextureParameterValue(TEXT("StarTexture"), Starfield);
+	}
+	else if (!DynamicMaterial)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SpaceSkyboxActor: No skybox material set. Please assign a starfield material with a StarTexture parameter in the editor."));
+	}
+}
+
+UTexture2D* ASpaceSkyboxActor::GetOrBakeStarfieldTexture(float Density)
+{
+	// Rooted so the texture survives level transitions; every skybox in
+	// every map shares this one bake
+	static UTexture2D* SharedStarfield = nullptr;
+	if (SharedStarfield)
+	{
+		return SharedStarfield;
+	}
+
+	UTexture2D* Texture = UTexture2D::CreateTransient(StarfieldTextureSize, StarfieldTextureSize, PF_B8G8R8A8);
+	if (!Texture)
+	{
+		return nullptr;
+	}
+
+	FTexture2DMipMap& Mip = Texture->GetPlatformData()->Mips[0];
+	FColor* Pixels = static_cast<FColor*>(Mip.BulkData.Lock(LOCK_READ_WRITE));
+	FMemory::Memzero(Pixels, StarfieldTextureSize * StarfieldTextureSize * sizeof(FColor));
+
+	// Deterministic scatter: same sky every session and on every machine
+	FRandomStream Stream(StarfieldSeed);
+	const int32 StarCount = FMath::RoundToInt(MaxStarCount * FMath::Clamp(Density, 0.0f, 1.0f));
+	for (int32 i = 0; i < StarCount; ++i)
+	{
+		const int32 X = Stream.RandRange(0, StarfieldTextureSize - 1);
+		const int32 Y = Stream.RandRange(0, StarfieldTextureSize - 1);
+
+		// Mostly dim stars with a few bright ones, slight warm/cool tint
+		const float Brightness = FMath::Pow(Stream.FRand(), 3.0f);
+		const uint8 Luma = static_cast<uint8>(40 + Brightness * 215.0f);
+		const int8 Tint = static_cast<int8>(Stream.RandRange(-20, 20));
+
+		FColor& Pixel = Pixels[Y * StarfieldTextureSize + X];
+		Pixel.R = static_cast<uint8>(FMath::Clamp<int32>(Luma + Tint, 0, 255));
+		Pixel.G = Luma;
+		Pixel.B = static_cast<uint8>(FMath::Clamp<int32>(Luma - Tint, 0, 255));
+		Pixel.A = 255;
+	}
+
+	Mip.BulkData.Unlock();
+	Texture->SRGB = false;
+	Texture->Filter = TF_Nearest;
+	Texture->UpdateResource();
+
+	Texture->AddToRoot();
+	SharedStarfield = Texture;
+
+	UE_LOG(LogTemp, Log, TEXT("SpaceSkyboxActor: Baked %dx%d starfield (%d stars)"),
+		StarfieldTextureSize, StarfieldTextureSize, StarCount);
+	return SharedStarfield;
 }
 
 void ASpaceSkyboxActor::FollowPlayerCamera()
@@ -109,9 +202,13 @@ void ASpaceSkyboxActor::FollowPlayerCamera()
 		{
 			if (APlayerCameraManager* CameraManager = PC->PlayerCameraManager)
 			{
-				// Move skybox to camera location so it appears infinitely far away
+				// Move skybox to camera location so it appears infinitely far away.
+				// Skip the transform dirty when the camera is stationary.
 				FVector CameraLocation = CameraManager->GetCameraLocation();
-				SetActorLocation(CameraLocation);
+				if (!CameraLocation.Equals(GetActorLocation(), 1.0f))
+				{
+					SetActorLocation(CameraLocation);
+				}
 			}
 		}
 	}
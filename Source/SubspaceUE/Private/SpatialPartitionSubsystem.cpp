@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SpatialPartitionSubsystem.h"
+#include "GameFramework/Actor.h"
+
+void USpatialPartitionSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	// Coarse re-bucketing pass; queries tolerate up to a quarter second
+	// of cell staleness, which is well under a cell width of movement
+	RefreshTimer -= DeltaTime;
+	if (RefreshTimer <= 0.0f)
+	{
+		RefreshTimer = 0.25f;
+		RefreshActorCells();
+	}
+}
+
+TStatId USpatialPartitionSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USpatialPartitionSubsystem, STATGROUP_Tickables);
+}
+
+FIntVector USpatialPartitionSubsystem::LocationToCell(const FVector& Location) const
+{
+	return FIntVector(
+		FMath::FloorToInt(Location.X / CellSize),
+		FMath::FloorToInt(Location.Y / CellSize),
+		FMath::FloorToInt(Location.Z / CellSize)
+	);
+}
+
+void USpatialPartitionSubsystem::RegisterActor(AActor* Actor)
+{
+	if (!Actor || ActorCells.Contains(Actor))
+	{
+		return;
+	}
+
+	const FIntVector Cell = LocationToCell(Actor->GetActorLocation());
+	Grid.FindOrAdd(Cell).Add(Actor);
+	ActorCells.Add(Actor, Cell);
+}
+
+void USpatialPartitionSubsystem::UnregisterActor(AActor* Actor)
+{
+	if (!Actor)
+	{
+		return;
+	}
+
+	FIntVector Cell;
+	if (ActorCells.RemoveAndCopyValue(Actor, Cell))
+	{
+		if (TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(Cell))
+		{
+			CellActors->RemoveSwap(Actor);
+			if (CellActors->Num() == 0)
+			{
+				Grid.Remove(Cell);
+			}
+		}
+	}
+}
+
+void USpatialPartitionSubsystem::RefreshActorCells()
+{
+	// Collect moves and stale entries first - mutating the maps while
+	// iterating them is not safe
+	TArray<TPair<TWeakObjectPtr<AActor>, FIntVector>> Moves;
+	TArray<TWeakObjectPtr<AActor>> Stale;
+
+	for (const TPair<TWeakObjectPtr<AActor>, FIntVector>& Entry : ActorCells)
+	{
+		AActor* Actor = Entry.Key.Get();
+		if (!Actor)
+		{
+			Stale.Add(Entry.Key);
+			continue;
+		}
+		const FIntVector NewCell = LocationToCell(Actor->GetActorLocation());
+		if (NewCell != Entry.Value)
+		{
+			Moves.Emplace(Entry.Key, NewCell);
+		}
+	}
+
+	for (const TWeakObjectPtr<AActor>& Entry : Stale)
+	{
+		FIntVector Cell;
+		if (ActorCells.RemoveAndCopyValue(Entry, Cell))
+		{
+			if (TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(Cell))
+			{
+				CellActors->RemoveSwap(Entry);
+				if (CellActors->Num() == 0)
+				{
+					Grid.Remove(Cell);
+				}
+			}
+		}
+	}
+
+	for (const TPair<TWeakObjectPtr<AActor>, FIntVector>& Move : Moves)
+	{
+		const FIntVector OldCell = ActorCells[Move.Key];
+		if (TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(OldCell))
+		{
+			CellActors->RemoveSwap(Move.Key);
+			if (CellActors->Num() == 0)
+			{
+				Grid.Remove(OldCell);
+			}
+		}
+		Grid.FindOrAdd(Move.Value).Add(Move.Key);
+		ActorCells[Move.Key] = Move.Value;
+	}
+}
+
+TArray<AActor*> USpatialPartitionSubsystem::QueryRadius(const FVector& Center, float Radius, TSubclassOf<AActor> ClassFilter) const
+{
+	TArray<AActor*> Result;
+	if (Radius <= 0.0f)
+	{
+		return Result;
+	}
+
+	// One cell of slack on each side covers re-bucketing staleness
+	const FIntVector MinCell = LocationToCell(Center - FVector(Radius + CellSize));
+	const FIntVector MaxCell = LocationToCell(Center + FVector(Radius + CellSize));
+	const float RadiusSquared = Radius * Radius;
+
+	for (int32 Z = MinCell.Z; Z <= MaxCell.Z; ++Z)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+			{
+				const TArray<TWeakObjectPtr<AActor>>* CellActors = Grid.Find(FIntVector(X, Y, Z));
+				if (!CellActors)
+				{
+					continue;
+				}
+				for (const TWeakObjectPtr<AActor>& WeakActor : *CellActors)
+				{
+					AActor* Actor = WeakActor.Get();
+					if (!Actor || (ClassFilter && !Actor->IsA(ClassFilter)))
+					{
+						continue;
+					}
+					if (FVector::DistSquared(Center, Actor->GetActorLocation()) <= RadiusSquared)
+					{
+						Result.Add(Actor);
+					}
+				}
+			}
+		}
+	}
+	return Result;
+}
+
+AActor* USpatialPartitionSubsystem::QueryNearest(const FVector& Center, float MaxRadius, TSubclassOf<AActor> ClassFilter) const
+{
+	AActor* Nearest = nullptr;
+	float NearestDistSquared = MaxRadius * MaxRadius;
+
+	for (AActor* Actor : QueryRadius(Center, MaxRadius, ClassFilter))
+	{
+		const float DistSquared = FVector::DistSquared(Center, Actor->GetActorLocation());
+		if (DistSquared <= NearestDistSquared)
+		{
+			NearestDistSquared = DistSquared;
+			Nearest = Actor;
+		}
+	}
+	return Nearest;
+}
@@ -6,7 +6,7 @@
 #include "GameFramework/CharacterMovementComponent.h"
 #include "SubspacePlayerPawn.h"
 #include "SubspacePlayerController.h"
-#include "Kismet/GameplayStatics.h"
+#include "SpatialPartitionSubsystem.h"
 
 ASubspaceCharacter::ASubspaceCharacter()
 {
@@ -154,24 +154,12 @@ void ASubspaceCharacter::EnterExitShip()
 
 void ASubspaceCharacter::CheckForNearbyShip()
 {
-	// Find all ships in range
-	TArray<AActor*> FoundShips;
-	UGameplayStatics::GetAllActorsOfClass(GetWorld(), ASubspacePlayerPawn::StaticClass(), FoundShips);
-	
+	// Ask the spatial partition for the closest registered ship instead
+	// of scanning every actor in the world
 	NearbyShip = nullptr;
-	float ClosestDistance = ShipDetectionRange;
-	
-	for (AActor* Actor : FoundShips)
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
 	{
-		ASubspacePlayerPawn* Ship = Cast<ASubspacePlayerPawn>(Actor);
-		if (Ship)
-		{
-			float Distance = FVector::Dist(GetActorLocation(), Ship->GetActorLocation());
-			if (Distance < ClosestDistance)
-			{
-				ClosestDistance = Distance;
-				NearbyShip = Ship;
-			}
-		}
+		NearbyShip = Cast<ASubspacePlayerPawn>(
+			Partition->QueryNearest(GetActorLocation(), ShipDetectionRange, ASubspacePlayerPawn::StaticClass()));
 	}
 }
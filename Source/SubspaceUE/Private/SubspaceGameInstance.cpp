@@ -1,6 +1,78 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SubspaceGameInstance.h"
+#include "VoxelComponent.h"
+#include "Async/Async.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/BufferArchive.h"
+#include "Serialization/MemoryReader.h"
+#include "TimerManager.h"
+
+namespace VoxelSaveFormat
+{
+	constexpr uint32 Magic = 0x53564F58; // 'SVOX'
+	constexpr uint32 Version = 1;
+	constexpr int32 RegionSize = 32;
+	constexpr int32 CellsPerRegion = RegionSize * RegionSize * RegionSize;
+}
+
+namespace PlayerSaveFormat
+{
+	constexpr uint32 Magic = 0x53534156; // 'SSAV'
+	constexpr uint32 Version = 1;
+}
+
+namespace
+{
+	/**
+	 * Copy of the player-facing game instance state, taken on the game
+	 * thread so the serializing task never touches live UPROPERTYs.
+	 */
+	struct FPlayerStateSnapshot
+	{
+		TMap<FName, int32> Inventory;
+		int32 Credits = 0;
+		int32 GalaxySeed = 0;
+		TMap<FName, float> FactionReputation;
+	};
+
+	void SerializePlayerState(FArchive& Ar, FPlayerStateSnapshot& State)
+	{
+		using namespace PlayerSaveFormat;
+
+		uint32 MagicValue = Magic;
+		uint32 VersionValue = Version;
+		Ar << MagicValue;
+		Ar << VersionValue;
+		Ar << State.Inventory;
+		Ar << State.Credits;
+		Ar << State.GalaxySeed;
+		Ar << State.FactionReputation;
+	}
+
+	bool DeserializePlayerState(FArchive& Ar, FPlayerStateSnapshot& OutState)
+	{
+		using namespace PlayerSaveFormat;
+
+		uint32 MagicValue = 0;
+		uint32 VersionValue = 0;
+		Ar << MagicValue;
+		Ar << VersionValue;
+		if (MagicValue != Magic || VersionValue != Version)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Player save has bad magic/version"));
+			return false;
+		}
+
+		Ar << OutState.Inventory;
+		Ar << OutState.Credits;
+		Ar << OutState.GalaxySeed;
+		Ar << OutState.FactionReputation;
+		return !Ar.IsError();
+	}
+}
 
 USubspaceGameInstance::USubspaceGameInstance()
 {
@@ -22,36 +94,335 @@ void USubspaceGameInstance::Init()
 	FactionReputation.Add(FName("Pirates"), -50.0f);
 	FactionReputation.Add(FName("Traders"), 25.0f);
 
+	if (AutosaveInterval > 0.0f)
+	{
+		GetTimerManager().SetTimer(AutosaveTimerHandle, this, &USubspaceGameInstance::Autosave, AutosaveInterval, true);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Initialization complete"));
 }
 
 void USubspaceGameInstance::Shutdown()
 {
 	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Shutting down..."));
-	
-	// Cleanup here
-	
+
+	GetTimerManager().ClearTimer(AutosaveTimerHandle);
+
 	Super::Shutdown();
 }
 
 void USubspaceGameInstance::SaveGame()
 {
-	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Saving game..."));
-	
-	// TODO: Implement save system using UE's SaveGame class
-	// TODO: Serialize player inventory, credits, faction rep
-	// TODO: Save current sector location
-	
-	UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Save system not yet implemented"));
+	// Snapshot on the game thread; serialization and the write go async
+	FPlayerStateSnapshot Snapshot;
+	Snapshot.Inventory = PlayerInventory;
+	Snapshot.Credits = PlayerCredits;
+	Snapshot.GalaxySeed = GalaxySeed;
+	Snapshot.FactionReputation = FactionReputation;
+	const FString FilePath = GetPlayerSavePath();
+
+	Async(EAsyncExecution::ThreadPool, [Snapshot = MoveTemp(Snapshot), FilePath]() mutable
+	{
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+
+		FBufferArchive Buffer;
+		SerializePlayerState(Buffer, Snapshot);
+
+		if (FFileHelper::SaveArrayToFile(Buffer, *FilePath))
+		{
+			UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Saved player state (%d bytes) to %s"),
+				Buffer.Num(), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Failed to write player save %s"), *FilePath);
+		}
+	});
+
+	// Flush structures modified since the last save; SaveVoxelStructure
+	// snapshots and writes on its own background task
+	for (TPair<FString, TWeakObjectPtr<UVoxelComponent>>& DirtyPair : DirtyStructures)
+	{
+		if (UVoxelComponent* Structure = DirtyPair.Value.Get())
+		{
+			SaveVoxelStructure(Structure, DirtyPair.Key);
+		}
+	}
+	DirtyStructures.Empty();
 }
 
 void USubspaceGameInstance::LoadGame()
 {
-	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Loading game..."));
-	
-	// TODO: Implement load system using UE's SaveGame class
-	// TODO: Deserialize player data
-	// TODO: Restore game state
-	
-	UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Load system not yet implemented"));
+	const FString FilePath = GetPlayerSavePath();
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: No player save at %s"), *FilePath);
+		return;
+	}
+
+	FMemoryReader Reader(FileData, true);
+	FPlayerStateSnapshot Snapshot;
+	if (!DeserializePlayerState(Reader, Snapshot))
+	{
+		return;
+	}
+
+	PlayerInventory = MoveTemp(Snapshot.Inventory);
+	PlayerCredits = Snapshot.Credits;
+	GalaxySeed = Snapshot.GalaxySeed;
+	FactionReputation = MoveTemp(Snapshot.FactionReputation);
+
+	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Loaded player state from %s"), *FilePath);
+}
+
+void USubspaceGameInstance::MarkStructureDirty(UVoxelComponent* VoxelComponent, const FString& SlotName)
+{
+	if (!VoxelComponent || SlotName.IsEmpty())
+	{
+		return;
+	}
+	DirtyStructures.Add(SlotName, VoxelComponent);
+}
+
+void USubspaceGameInstance::Autosave()
+{
+	// Dirty tracking keeps this cheap: untouched structures are skipped
+	// entirely, and the player-state write happens off-thread
+	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Autosaving (%d dirty structures)"), DirtyStructures.Num());
+	SaveGame();
+}
+
+FString USubspaceGameInstance::GetVoxelSavePath(const FString& SlotName)
+{
+	return FPaths::ProjectSavedDir() / TEXT("VoxelStructures") / SlotName + TEXT(".svox");
+}
+
+FString USubspaceGameInstance::GetPlayerSavePath()
+{
+	return FPaths::ProjectSavedDir() / TEXT("SaveGames") / TEXT("PlayerState.ssav");
+}
+
+void USubspaceGameInstance::SerializeVoxelStructure(FArchive& Ar, const TArray<FVoxelBlock>& Blocks)
+{
+	using namespace VoxelSaveFormat;
+
+	uint32 MagicValue = Magic;
+	uint32 VersionValue = Version;
+	Ar << MagicValue;
+	Ar << VersionValue;
+
+	// Build the material palette and a cell record per region. A cell
+	// record is (palette index + 1) in the high byte and the block type
+	// in the low byte; zero means empty.
+	TArray<FString> Palette;
+	TMap<FString, uint8> PaletteLookup;
+	TMap<FIntVector, TArray<uint16>> Regions;
+
+	for (const FVoxelBlock& Block : Blocks)
+	{
+		if (Block.bIsDestroyed)
+		{
+			continue;
+		}
+
+		uint8 PaletteIndex;
+		if (const uint8* Existing = PaletteLookup.Find(Block.MaterialType))
+		{
+			PaletteIndex = *Existing;
+		}
+		else
+		{
+			PaletteIndex = static_cast<uint8>(Palette.Add(Block.MaterialType));
+			PaletteLookup.Add(Block.MaterialType, PaletteIndex);
+		}
+
+		const FIntVector Coord(
+			FMath::RoundToInt(Block.Position.X),
+			FMath::RoundToInt(Block.Position.Y),
+			FMath::RoundToInt(Block.Position.Z)
+		);
+		const FIntVector RegionCoord(
+			FMath::FloorToInt(static_cast<float>(Coord.X) / RegionSize),
+			FMath::FloorToInt(static_cast<float>(Coord.Y) / RegionSize),
+			FMath::FloorToInt(static_cast<float>(Coord.Z) / RegionSize)
+		);
+		const FIntVector Local = Coord - RegionCoord * RegionSize;
+		const int32 CellIndex = Local.X + Local.Y * RegionSize + Local.Z * RegionSize * RegionSize;
+
+		TArray<uint16>& Cells = Regions.FindOrAdd(RegionCoord);
+		if (Cells.Num() == 0)
+		{
+			Cells.SetNumZeroed(CellsPerRegion);
+		}
+		Cells[CellIndex] = static_cast<uint16>((PaletteIndex + 1) << 8) | static_cast<uint8>(Block.BlockType);
+	}
+
+	int32 NumMaterials = Palette.Num();
+	Ar << NumMaterials;
+	for (FString& MaterialName : Palette)
+	{
+		Ar << MaterialName;
+	}
+
+	// Write each region as a run-length-encoded cell stream - empty space
+	// between blocks collapses into single runs
+	int32 NumRegions = Regions.Num();
+	Ar << NumRegions;
+	for (TPair<FIntVector, TArray<uint16>>& RegionPair : Regions)
+	{
+		Ar << RegionPair.Key;
+
+		const TArray<uint16>& Cells = RegionPair.Value;
+		int32 CellIndex = 0;
+		while (CellIndex < CellsPerRegion)
+		{
+			uint16 CellValue = Cells[CellIndex];
+			uint32 RunLength = 1;
+			while (CellIndex + static_cast<int32>(RunLength) < CellsPerRegion &&
+			       Cells[CellIndex + RunLength] == CellValue)
+			{
+				++RunLength;
+			}
+			Ar << RunLength;
+			Ar << CellValue;
+			CellIndex += RunLength;
+		}
+	}
+}
+
+bool USubspaceGameInstance::DeserializeVoxelStructure(FArchive& Ar, TArray<FVoxelBlock>& OutBlocks)
+{
+	using namespace VoxelSaveFormat;
+
+	uint32 MagicValue = 0;
+	uint32 VersionValue = 0;
+	Ar << MagicValue;
+	Ar << VersionValue;
+	if (MagicValue != Magic || VersionValue != Version)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Voxel save has bad magic/version"));
+		return false;
+	}
+
+	int32 NumMaterials = 0;
+	Ar << NumMaterials;
+	TArray<FString> Palette;
+	Palette.SetNum(NumMaterials);
+	for (FString& MaterialName : Palette)
+	{
+		Ar << MaterialName;
+	}
+
+	int32 NumRegions = 0;
+	Ar << NumRegions;
+	for (int32 RegionIndex = 0; RegionIndex < NumRegions; ++RegionIndex)
+	{
+		FIntVector RegionCoord;
+		Ar << RegionCoord;
+
+		int32 CellIndex = 0;
+		while (CellIndex < CellsPerRegion)
+		{
+			uint32 RunLength = 0;
+			uint16 CellValue = 0;
+			Ar << RunLength;
+			Ar << CellValue;
+			if (RunLength == 0 || CellIndex + static_cast<int32>(RunLength) > CellsPerRegion)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Corrupt run in voxel save"));
+				return false;
+			}
+
+			if (CellValue != 0)
+			{
+				const int32 PaletteIndex = (CellValue >> 8) - 1;
+				if (!Palette.IsValidIndex(PaletteIndex))
+				{
+					UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Bad palette index in voxel save"));
+					return false;
+				}
+				const EBlockType BlockType = static_cast<EBlockType>(CellValue & 0xFF);
+
+				for (uint32 Run = 0; Run < RunLength; ++Run)
+				{
+					const int32 Cell = CellIndex + Run;
+					const FIntVector Local(
+						Cell % RegionSize,
+						(Cell / RegionSize) % RegionSize,
+						Cell / (RegionSize * RegionSize)
+					);
+					const FIntVector Coord = RegionCoord * RegionSize + Local;
+					OutBlocks.Add(FVoxelBlock(FVector(Coord), FVector::OneVector, Palette[PaletteIndex], BlockType));
+				}
+			}
+			CellIndex += RunLength;
+		}
+	}
+	return true;
+}
+
+void USubspaceGameInstance::SaveVoxelStructure(UVoxelComponent* VoxelComponent, const FString& SlotName)
+{
+	if (!VoxelComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: SaveVoxelStructure called with no component"));
+		return;
+	}
+
+	// Snapshot on the game thread; serialization and the write go async
+	TArray<FVoxelBlock> Snapshot = VoxelComponent->GetAllBlocks();
+	const FString FilePath = GetVoxelSavePath(SlotName);
+
+	Async(EAsyncExecution::ThreadPool, [Snapshot = MoveTemp(Snapshot), FilePath]()
+	{
+		IFileManager::Get().MakeDirectory(*FPaths::GetPath(FilePath), true);
+
+		FBufferArchive Buffer;
+		SerializeVoxelStructure(Buffer, Snapshot);
+
+		if (FFileHelper::SaveArrayToFile(Buffer, *FilePath))
+		{
+			UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Saved voxel structure (%d blocks, %d bytes) to %s"),
+				Snapshot.Num(), Buffer.Num(), *FilePath);
+		}
+		else
+		{
+			UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: Failed to write voxel save %s"), *FilePath);
+		}
+	});
+}
+
+bool USubspaceGameInstance::LoadVoxelStructure(UVoxelComponent* VoxelComponent, const FString& SlotName)
+{
+	if (!VoxelComponent)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: LoadVoxelStructure called with no component"));
+		return false;
+	}
+
+	const FString FilePath = GetVoxelSavePath(SlotName);
+	TArray<uint8> FileData;
+	if (!FFileHelper::LoadFileToArray(FileData, *FilePath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SubspaceGameInstance: No voxel save at %s"), *FilePath);
+		return false;
+	}
+
+	FMemoryReader Reader(FileData, true);
+	TArray<FVoxelBlock> LoadedBlocks;
+	if (!DeserializeVoxelStructure(Reader, LoadedBlocks))
+	{
+		return false;
+	}
+
+	// RebuildMesh repartitions into chunks, which then mesh on background
+	// tasks - large structures stream in over a few frames
+	VoxelComponent->ClearBlocks();
+	VoxelComponent->Blocks = MoveTemp(LoadedBlocks);
+	VoxelComponent->RebuildMesh();
+
+	UE_LOG(LogTemp, Log, TEXT("SubspaceGameInstance: Loaded voxel structure (%d blocks) from %s"),
+		VoxelComponent->Blocks.Num(), *FilePath);
+	return true;
 }
@@ -1,6 +1,8 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "SubspaceGameMode.h"
+#include "AsteroidFieldSubsystem.h"
+#include "InitSchedulerSubsystem.h"
 #include "SubspacePlayerController.h"
 #include "SubspacePlayerPawn.h"
 #include "SubspaceHUD.h"
@@ -31,33 +33,88 @@ void ASubspaceGameMode::BeginPlay()
 	Super::BeginPlay();
 
 	UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Initializing game systems..."));
-	
-	// Spawn space skybox
-	if (GetWorld())
+
+	UInitSchedulerSubsystem* Init = GetWorld() ? GetWorld()->GetSubsystem<UInitSchedulerSubsystem>() : nullptr;
+	if (!Init)
+	{
+		// No scheduler (commandlets, tests): construct everything now
+		SpawnEnvironmentActors();
+		InitializeGalaxySystem();
+		GenerateAsteroids(50);
+		SpawnAIShips(5);
+		OnWorldInitComplete();
+		return;
+	}
+
+	// Stage the setup across frames, player-visible work first: the
+	// backdrop and light are what the first rendered frames show, the
+	// sector content can trickle in behind them
+	// The dependency is satisfied trivially when no AAutoInitGameActor is
+	// in the map; with one, its settings land before anything spawns
+	TWeakObjectPtr<ASubspaceGameMode> WeakThis(this);
+	Init->EnqueueStage(TEXT("Environment"), 0, { TEXT("World Settings") }, [WeakThis]()
+	{
+		if (ASubspaceGameMode* Mode = WeakThis.Get())
+		{
+			Mode->SpawnEnvironmentActors();
+		}
+		return true;
+	});
+	Init->EnqueueStage(TEXT("Galaxy"), 1, [WeakThis]()
+	{
+		if (ASubspaceGameMode* Mode = WeakThis.Get())
+		{
+			Mode->InitializeGalaxySystem();
+		}
+		return true;
+	});
+	Init->EnqueueStage(TEXT("Asteroid Field"), 2, { TEXT("Galaxy") }, [WeakThis]()
+	{
+		if (ASubspaceGameMode* Mode = WeakThis.Get())
+		{
+			Mode->GenerateAsteroids(50);
+		}
+		return true;
+	});
+	Init->EnqueueStage(TEXT("AI Ships"), 2, { TEXT("Galaxy") }, [WeakThis, Remaining = 5]() mutable
 	{
-		FActorSpawnParameters SpawnParams;
-		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-		
-		// Spawn skybox
-		ASpaceSkyboxActor* Skybox = GetWorld()->SpawnActor<ASpaceSkyboxActor>(ASpaceSkyboxActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
-		if (Skybox)
+		// One ship per step; each spawn is its own slice of the budget
+		ASubspaceGameMode* Mode = WeakThis.Get();
+		if (!Mode)
 		{
-			UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Space skybox spawned"));
+			return true;
 		}
-		
-		// Spawn lighting
-		GetWorld()->SpawnActor<ASpaceLightingActor>(ASpaceLightingActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
-		UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Lighting spawned"));
+		Mode->SpawnAIShips(1);
+		return --Remaining <= 0;
+	});
+	Init->OnInitComplete.AddDynamic(this, &ASubspaceGameMode::OnWorldInitComplete);
+}
+
+void ASubspaceGameMode::SpawnEnvironmentActors()
+{
+	if (!GetWorld())
+	{
+		return;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	// Spawn skybox
+	ASpaceSkyboxActor* Skybox = GetWorld()->SpawnActor<ASpaceSkyboxActor>(ASpaceSkyboxActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	if (Skybox)
+	{
+		UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Space skybox spawned"));
 	}
-	
-	// Initialize core game systems
-	InitializeGalaxySystem();
-	
-	// Generate initial sector content
-	GenerateAsteroids(50);
-	SpawnAIShips(5);
 
-	UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Game systems initialized at sector (%d, %d, %d)"), 
+	// Spawn lighting
+	GetWorld()->SpawnActor<ASpaceLightingActor>(ASpaceLightingActor::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams);
+	UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Lighting spawned"));
+}
+
+void ASubspaceGameMode::OnWorldInitComplete()
+{
+	UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Game systems initialized at sector (%d, %d, %d)"),
 		CurrentSectorCoordinates.X, CurrentSectorCoordinates.Y, CurrentSectorCoordinates.Z);
 }
 
@@ -123,43 +180,20 @@ void ASubspaceGameMode::SpawnAIShips(int32 NumShips)
 void ASubspaceGameMode::GenerateAsteroids(int32 NumAsteroids)
 {
 	UE_LOG(LogTemp, Log, TEXT("SubspaceGameMode: Generating %d asteroids..."), NumAsteroids);
-	
-	if (GetWorld())
+
+	if (!GetWorld())
 	{
-		for (int32 i = 0; i < NumAsteroids; i++)
-		{
-			// Random position in a larger area around origin
-			FVector SpawnLocation = FVector(
-				FMath::RandRange(-10000.0f, 10000.0f),
-				FMath::RandRange(-10000.0f, 10000.0f),
-				FMath::RandRange(-5000.0f, 5000.0f)
-			);
-			
-			FRotator SpawnRotation = FRotator(
-				FMath::RandRange(-180.0f, 180.0f),
-				FMath::RandRange(-180.0f, 180.0f),
-				FMath::RandRange(-180.0f, 180.0f)
-			);
-			
-			FActorSpawnParameters SpawnParams;
-			SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
-			
-			ASpaceActor* Asteroid = GetWorld()->SpawnActor<ASpaceActor>(ASpaceActor::StaticClass(), SpawnLocation, SpawnRotation, SpawnParams);
-			if (Asteroid)
-			{
-				// Set random scale for variety
-				float Scale = FMath::RandRange(1.0f, 3.0f);
-				Asteroid->SetActorScale3D(FVector(Scale));
-				
-				// Random slow rotation
-				Asteroid->RotationSpeed = FVector(
-					FMath::RandRange(-5.0f, 5.0f),
-					FMath::RandRange(-5.0f, 5.0f),
-					FMath::RandRange(-5.0f, 5.0f)
-				);
-				
-				UE_LOG(LogTemp, Log, TEXT("Spawned asteroid at %s"), *SpawnLocation.ToString());
-			}
-		}
+		return;
+	}
+
+	// The field engine scatters shared-mesh instances and only promotes
+	// an asteroid to a live voxel actor when something interacts with it,
+	// so the count here can be thousands, not dozens. Seeded from the
+	// sector so a revisit reproduces the same field.
+	if (UAsteroidFieldSubsystem* Field = GetWorld()->GetSubsystem<UAsteroidFieldSubsystem>())
+	{
+		const int32 SectorSeed = CurrentSectorCoordinates.X * 73856093 ^
+			CurrentSectorCoordinates.Y * 19349663 ^ CurrentSectorCoordinates.Z * 83492791;
+		Field->GenerateField(FVector::ZeroVector, 10000.0f, NumAsteroids, SectorSeed);
 	}
 }
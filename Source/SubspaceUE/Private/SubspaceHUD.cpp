@@ -4,6 +4,8 @@
 #include "Engine/Canvas.h"
 #include "Engine/Font.h"
 #include "GameFramework/PlayerController.h"
+#include "NavigationComponent.h"
+#include "SpatialPartitionSubsystem.h"
 #include "SubspacePlayerPawn.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -91,4 +93,119 @@ void ASubspaceHUD::DrawHUD()
 	
 	DrawLine(CenterX - CrosshairSize, CenterY, CenterX + CrosshairSize, CenterY, FLinearColor::Green, 2.0f);
 	DrawLine(CenterX, CenterY - CrosshairSize, CenterX, CenterY + CrosshairSize, FLinearColor::Green, 2.0f);
+
+	// Target markers: one batched projection pass, then one draw pass
+	BuildTargetMarkers(PC, PlayerPawn);
+	DrawTargetMarkers();
+}
+
+void ASubspaceHUD::BuildTargetMarkers(APlayerController* PC, APawn* PlayerPawn)
+{
+	Markers.Reset();
+
+	USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>();
+	if (!Partition)
+	{
+		return;
+	}
+
+	// The player's selected target outranks everything else on screen
+	AActor* TargetedActor = nullptr;
+	if (UNavigationComponent* Navigation = PlayerPawn->FindComponentByClass<UNavigationComponent>())
+	{
+		TargetedActor = Navigation->CurrentTarget;
+	}
+
+	const FVector PlayerLocation = PlayerPawn->GetActorLocation();
+	TArray<AActor*> Contacts = Partition->QueryRadius(PlayerLocation, SensorRange);
+
+	for (AActor* Contact : Contacts)
+	{
+		if (!Contact || Contact == PlayerPawn)
+		{
+			continue;
+		}
+
+		// Single projection per contact; off-screen and behind-camera
+		// contacts are culled here and never reach the draw pass
+		FVector2D ScreenPosition;
+		if (!PC->ProjectWorldLocationToScreen(Contact->GetActorLocation(), ScreenPosition, /*bPlayerViewportRelative*/ false))
+		{
+			continue;
+		}
+		if (ScreenPosition.X < 0.0f || ScreenPosition.X > Canvas->SizeX ||
+			ScreenPosition.Y < 0.0f || ScreenPosition.Y > Canvas->SizeY)
+		{
+			continue;
+		}
+
+		FTargetMarker& Marker = Markers.AddDefaulted_GetRef();
+		Marker.ScreenPosition = ScreenPosition;
+		Marker.Distance = FVector::Dist(PlayerLocation, Contact->GetActorLocation());
+		if (Contact == TargetedActor)
+		{
+			Marker.Priority = 0;
+		}
+		else
+		{
+			Marker.Priority = Contact->IsA<APawn>() ? 1 : 2;
+		}
+		Marker.Label = Contact->GetName();
+	}
+
+	// Highest priority first, nearest first within a priority; everything
+	// past the marker budget is dropped
+	Markers.Sort([](const FTargetMarker& A, const FTargetMarker& B)
+	{
+		if (A.Priority != B.Priority)
+		{
+			return A.Priority < B.Priority;
+		}
+		return A.Distance < B.Distance;
+	});
+
+	if (Markers.Num() > MaxMarkers)
+	{
+		Markers.SetNum(MaxMarkers, EAllowShrinking::No);
+	}
+}
+
+void ASubspaceHUD::DrawTargetMarkers()
+{
+	// Corner brackets go through DrawLine, which the canvas batches into
+	// a single line set; text is capped to the top few markers because
+	// each label is its own draw
+	for (int32 MarkerIndex = 0; MarkerIndex < Markers.Num(); ++MarkerIndex)
+	{
+		const FTargetMarker& Marker = Markers[MarkerIndex];
+
+		FLinearColor MarkerColor;
+		switch (Marker.Priority)
+		{
+		case 0:  MarkerColor = FLinearColor::Yellow; break;
+		case 1:  MarkerColor = FLinearColor::Red; break;
+		default: MarkerColor = FLinearColor::Gray; break;
+		}
+
+		const float X = Marker.ScreenPosition.X;
+		const float Y = Marker.ScreenPosition.Y;
+		const float Half = 12.0f;
+		const float Corner = 5.0f;
+
+		// Four corner brackets
+		DrawLine(X - Half, Y - Half, X - Half + Corner, Y - Half, MarkerColor, 1.0f);
+		DrawLine(X - Half, Y - Half, X - Half, Y - Half + Corner, MarkerColor, 1.0f);
+		DrawLine(X + Half, Y - Half, X + Half - Corner, Y - Half, MarkerColor, 1.0f);
+		DrawLine(X + Half, Y - Half, X + Half, Y - Half + Corner, MarkerColor, 1.0f);
+		DrawLine(X - Half, Y + Half, X - Half + Corner, Y + Half, MarkerColor, 1.0f);
+		DrawLine(X - Half, Y + Half, X - Half, Y + Half - Corner, MarkerColor, 1.0f);
+		DrawLine(X + Half, Y + Half, X + Half - Corner, Y + Half, MarkerColor, 1.0f);
+		DrawLine(X + Half, Y + Half, X + Half, Y + Half - Corner, MarkerColor, 1.0f);
+
+		if (MarkerIndex < MaxLabeledMarkers)
+		{
+			const FString LabelText = FString::Printf(TEXT("%s  %.0fm"), *Marker.Label, Marker.Distance);
+			DrawText(LabelText, MarkerColor, X + Half + 4.0f, Y - Half, HUDFont, 0.8f);
+		}
+	}
 }
@@ -0,0 +1,491 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "AsteroidFieldSubsystem.h"
+#include "InitSchedulerSubsystem.h"
+#include "ProjectileSubsystem.h"
+#include "SolarSystemManager.h"
+#include "SpaceActor.h"
+#include "SpatialPartitionSubsystem.h"
+#include "TradingComponent.h"
+#include "VoxelComponent.h"
+#include "VoxelMaterial.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/AutomationTest.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSubspacePerf, Log, All);
+
+/**
+ * Sector-scale performance scenarios. Each test scripts a worst-case
+ * world (trader swarm, voxel fleet battle, full sector), samples frame
+ * times and peak memory over a measurement window, and fails when the
+ * scenario's budget is exceeded - so every scaling feature has a
+ * regression gate, not just a one-off measurement.
+ *
+ * Run headless through the editor binary the same way build-project.sh
+ * launches it:
+ *   -game -nullrhi -ExecCmds="Automation RunTests Subspace.Perf; Quit"
+ *
+ * Frame percentiles and memory are checked here; the per-system
+ * game-thread breakdown rides the existing Subspace.CsvCapture hook,
+ * which each scenario triggers for its window so the STATGROUP_Subspace
+ * counters land in Saved/Profiling/CSV alongside the pass/fail.
+ */
+namespace SubspacePerf
+{
+	/** Frame-time and memory budget for one scenario */
+	struct FBudget
+	{
+		/** Mean frame time ceiling (ms) */
+		float MaxAverageMs = 33.4f;
+
+		/** 99th-percentile frame time ceiling (ms) */
+		float MaxP99Ms = 66.7f;
+
+		/** Peak physical memory ceiling (MB) */
+		float MaxPeakMemoryMB = 6144.0f;
+	};
+
+	/** Everything one running scenario owns and measures */
+	struct FScenarioState
+	{
+		/** Actors the scenario spawned, destroyed again at teardown */
+		TArray<TWeakObjectPtr<AActor>> SpawnedActors;
+
+		/** Frame times (ms) collected over the measurement window */
+		TArray<float> FrameMs;
+
+		/** Highest physical memory use seen during the window (bytes) */
+		uint64 PeakUsedPhysical = 0;
+
+		/** Scripted per-frame load run while sampling (may be unset) */
+		TFunction<void(UWorld*)> PerFrameLoad;
+
+		/** Deterministic stream driving the scripted load */
+		FRandomStream Random = FRandomStream(20260826);
+
+		/** The world the scenario runs in */
+		TWeakObjectPtr<UWorld> World;
+	};
+
+	/** The current game world, or null when run without -game */
+	UWorld* GetGameWorld()
+	{
+		if (!GEngine)
+		{
+			return nullptr;
+		}
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+			{
+				return Context.World();
+			}
+		}
+		return nullptr;
+	}
+
+	/** Value at a percentile (0-1) of an unsorted sample array */
+	float Percentile(TArray<float> Samples, float Fraction)
+	{
+		if (Samples.Num() == 0)
+		{
+			return 0.0f;
+		}
+		Samples.Sort();
+		const int32 Index = FMath::Clamp(FMath::FloorToInt(Fraction * Samples.Num()), 0, Samples.Num() - 1);
+		return Samples[Index];
+	}
+
+	/** Compare the window against the budget, logging the numbers either way */
+	void CheckBudget(FAutomationTestBase* Test, const FScenarioState& State, const FBudget& Budget, const TCHAR* ScenarioName)
+	{
+		float Sum = 0.0f;
+		for (float Sample : State.FrameMs)
+		{
+			Sum += Sample;
+		}
+		const float AverageMs = State.FrameMs.Num() > 0 ? Sum / State.FrameMs.Num() : 0.0f;
+		const float P50 = Percentile(State.FrameMs, 0.50f);
+		const float P95 = Percentile(State.FrameMs, 0.95f);
+		const float P99 = Percentile(State.FrameMs, 0.99f);
+		const float PeakMB = State.PeakUsedPhysical / (1024.0f * 1024.0f);
+
+		UE_LOG(LogSubspacePerf, Log,
+			TEXT("%s: %d frames, avg %.2fms, p50 %.2fms, p95 %.2fms, p99 %.2fms, peak mem %.0fMB (see Saved/Profiling/CSV for the per-system breakdown)"),
+			ScenarioName, State.FrameMs.Num(), AverageMs, P50, P95, P99, PeakMB);
+
+		if (State.FrameMs.Num() == 0)
+		{
+			Test->AddError(FString::Printf(TEXT("%s: no frames sampled"), ScenarioName));
+			return;
+		}
+		if (AverageMs > Budget.MaxAverageMs)
+		{
+			Test->AddError(FString::Printf(TEXT("%s: average frame %.2fms over budget %.2fms"),
+				ScenarioName, AverageMs, Budget.MaxAverageMs));
+		}
+		if (P99 > Budget.MaxP99Ms)
+		{
+			Test->AddError(FString::Printf(TEXT("%s: p99 frame %.2fms over budget %.2fms"),
+				ScenarioName, P99, Budget.MaxP99Ms));
+		}
+		if (PeakMB > Budget.MaxPeakMemoryMB)
+		{
+			Test->AddError(FString::Printf(TEXT("%s: peak memory %.0fMB over budget %.0fMB"),
+				ScenarioName, PeakMB, Budget.MaxPeakMemoryMB));
+		}
+	}
+
+	/** Spawn a bare space actor the scenario tracks for teardown */
+	ASpaceActor* SpawnTrackedActor(const TSharedRef<FScenarioState>& State, const FVector& Location)
+	{
+		UWorld* World = State->World.Get();
+		if (!World)
+		{
+			return nullptr;
+		}
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		ASpaceActor* Actor = World->SpawnActor<ASpaceActor>(ASpaceActor::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+		if (Actor)
+		{
+			Actor->RotationSpeed = FVector::ZeroVector;
+			State->SpawnedActors.Add(Actor);
+		}
+		return Actor;
+	}
+
+	/** Start the per-system CSV capture for the measurement window */
+	void BeginCsvCapture(UWorld* World, float Seconds)
+	{
+		if (GEngine && World)
+		{
+			GEngine->Exec(World, *FString::Printf(TEXT("Subspace.CsvCapture %.0f"), Seconds));
+		}
+	}
+}
+
+/** Samples frame time and memory for a wall-clock window, running the scripted load */
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FSubspacePerfSampleCommand, TSharedRef<SubspacePerf::FScenarioState>, State, double, EndTime);
+bool FSubspacePerfSampleCommand::Update()
+{
+	UWorld* World = State->World.Get();
+	if (!World)
+	{
+		return true;
+	}
+
+	if (State->PerFrameLoad)
+	{
+		State->PerFrameLoad(World);
+	}
+	State->FrameMs.Add((float)(FApp::GetDeltaTime() * 1000.0));
+	State->PeakUsedPhysical = FMath::Max(State->PeakUsedPhysical, FPlatformMemory::GetStats().UsedPhysical);
+
+	return FPlatformTime::Seconds() >= EndTime;
+}
+
+/** Waits (with a deadline) for the staged init scheduler to drain */
+DEFINE_LATENT_AUTOMATION_COMMAND_TWO_PARAMETER(FSubspacePerfWaitForInitCommand, TSharedRef<SubspacePerf::FScenarioState>, State, double, Deadline);
+bool FSubspacePerfWaitForInitCommand::Update()
+{
+	UWorld* World = State->World.Get();
+	if (!World || FPlatformTime::Seconds() >= Deadline)
+	{
+		return true;
+	}
+	UInitSchedulerSubsystem* Init = World->GetSubsystem<UInitSchedulerSubsystem>();
+	return !Init || !Init->IsInitializing();
+}
+
+/** Checks the collected window against the scenario budget */
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FSubspacePerfCheckBudgetCommand, FAutomationTestBase*, Test, TSharedRef<SubspacePerf::FScenarioState>, State, SubspacePerf::FBudget, Budget, FString, ScenarioName);
+bool FSubspacePerfCheckBudgetCommand::Update()
+{
+	SubspacePerf::CheckBudget(Test, State.Get(), Budget, *ScenarioName);
+	return true;
+}
+
+/** Destroys everything the scenario spawned */
+DEFINE_LATENT_AUTOMATION_COMMAND_ONE_PARAMETER(FSubspacePerfTeardownCommand, TSharedRef<SubspacePerf::FScenarioState>, State);
+bool FSubspacePerfTeardownCommand::Update()
+{
+	for (const TWeakObjectPtr<AActor>& Actor : State->SpawnedActors)
+	{
+		if (AActor* Live = Actor.Get())
+		{
+			Live->Destroy();
+		}
+	}
+	State->SpawnedActors.Empty();
+	return true;
+}
+
+/**
+ * 200 AI traders against 25 stocked stations with the economy live.
+ * Every sampled frame a slice of the traders runs deal evaluation and
+ * a few stations mutate stock, which keeps the price republish, trade
+ * index invalidation, and offer book resort paths all hot at once.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubspacePerfTraderEconomyTest, "Subspace.Perf.TraderEconomy",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FSubspacePerfTraderEconomyTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = SubspacePerf::GetGameWorld();
+	if (!World)
+	{
+		AddError(TEXT("No game world; run with -game (headless: -nullrhi) and Automation RunTests Subspace.Perf"));
+		return false;
+	}
+
+	TSharedRef<SubspacePerf::FScenarioState> State = MakeShared<SubspacePerf::FScenarioState>();
+	State->World = World;
+
+	// Stations on a ring, alternating producer/consumer so deals exist
+	const TArray<FName> BuyWares = { TEXT("Ore"), TEXT("Silicon"), TEXT("Food") };
+	const TArray<FName> SellWares = { TEXT("Steel"), TEXT("Microchips"), TEXT("Water") };
+	TArray<UTradingComponent*> Stations;
+	for (int32 Index = 0; Index < 25; ++Index)
+	{
+		const float Angle = Index * 2.0f * PI / 25.0f;
+		ASpaceActor* Station = SubspacePerf::SpawnTrackedActor(State,
+			FVector(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f) * 50000.0f);
+		if (!Station)
+		{
+			continue;
+		}
+		UTradingComponent* Trading = NewObject<UTradingComponent>(Station, TEXT("StationTrading"));
+		Trading->RegisterComponent();
+		if (Index % 2 == 0)
+		{
+			Trading->SetupStationTrading(BuyWares, SellWares);
+		}
+		else
+		{
+			Trading->SetupStationTrading(SellWares, BuyWares);
+		}
+		for (const TPair<FName, FWare>& WarePair : Trading->WareLibrary)
+		{
+			Trading->AddWareToStorage(WarePair.Key, 200);
+		}
+		Stations.Add(Trading);
+	}
+
+	// Traders scattered through the ring
+	TArray<UTradingComponent*> Traders;
+	for (int32 Index = 0; Index < 200; ++Index)
+	{
+		ASpaceActor* Ship = SubspacePerf::SpawnTrackedActor(State, State->Random.VRand() * 40000.0f);
+		if (!Ship)
+		{
+			continue;
+		}
+		UTradingComponent* Trading = NewObject<UTradingComponent>(Ship, TEXT("TraderTrading"));
+		Trading->RegisterComponent();
+		Traders.Add(Trading);
+	}
+
+	State->PerFrameLoad = [State, Stations, Traders, NextTrader = 0](UWorld*) mutable
+	{
+		// A slice of the fleet evaluates deals each frame - 10 per frame
+		// keeps all 200 cycling through the index every second or so
+		for (int32 Slice = 0; Slice < 10 && Traders.Num() > 0; ++Slice)
+		{
+			UTradingComponent* Trader = Traders[NextTrader++ % Traders.Num()];
+			if (Trader && Trader->GetOwner())
+			{
+				Trader->FindProfitableDeals(Trader->GetOwner()->GetActorLocation(), 1.0e9f, 5);
+			}
+		}
+
+		// Stock churn keeps repricing and index invalidation live
+		for (int32 Mutation = 0; Mutation < 3 && Stations.Num() > 0; ++Mutation)
+		{
+			UTradingComponent* Station = Stations[State->Random.RandRange(0, Stations.Num() - 1)];
+			if (Station && Station->WareIds.Num() > 0)
+			{
+				const FName WareId = Station->WareIds[State->Random.RandRange(0, Station->WareIds.Num() - 1)];
+				if (State->Random.FRand() < 0.5f)
+				{
+					Station->AddWareToStorage(WareId, State->Random.RandRange(1, 5));
+				}
+				else
+				{
+					Station->RemoveWareFromStorage(WareId, State->Random.RandRange(1, 5));
+				}
+			}
+		}
+	};
+
+	SubspacePerf::FBudget Budget;
+	SubspacePerf::BeginCsvCapture(World, 15.0f);
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfSampleCommand(State, FPlatformTime::Seconds() + 15.0));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfCheckBudgetCommand(this, State, Budget, TEXT("TraderEconomy")));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfTeardownCommand(State));
+	return true;
+}
+
+/**
+ * 60-ship voxel fleet battle with sustained block destruction: every
+ * ship is a live voxel hull, projectiles stream through the partition
+ * each frame, and direct block damage keeps chunk remesh, collision
+ * rebuild, and split detection continuously busy.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubspacePerfVoxelFleetBattleTest, "Subspace.Perf.VoxelFleetBattle",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FSubspacePerfVoxelFleetBattleTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = SubspacePerf::GetGameWorld();
+	if (!World)
+	{
+		AddError(TEXT("No game world; run with -game (headless: -nullrhi) and Automation RunTests Subspace.Perf"));
+		return false;
+	}
+
+	TSharedRef<SubspacePerf::FScenarioState> State = MakeShared<SubspacePerf::FScenarioState>();
+	State->World = World;
+
+	// One fleet on a grid; each ship is an 8x4x4 voxel hull
+	struct FFleetShip
+	{
+		TWeakObjectPtr<UVoxelComponent> Voxels;
+		TArray<FGuid> BlockIds;
+		FVector Location = FVector::ZeroVector;
+	};
+	TSharedRef<TArray<FFleetShip>> Fleet = MakeShared<TArray<FFleetShip>>();
+
+	USpatialPartitionSubsystem* Partition = World->GetSubsystem<USpatialPartitionSubsystem>();
+	const FString MaterialName = UVoxelMaterialLibrary::GetMaterialDisplayName(EMaterialTier::Iron);
+	for (int32 Index = 0; Index < 60; ++Index)
+	{
+		const FVector Location((Index % 10) * 3000.0f, (Index / 10) * 3000.0f, 0.0f);
+		ASpaceActor* Ship = SubspacePerf::SpawnTrackedActor(State, Location);
+		if (!Ship)
+		{
+			continue;
+		}
+
+		UVoxelComponent* Voxels = NewObject<UVoxelComponent>(Ship, TEXT("ShipVoxels"));
+		Voxels->bDetectSplits = true;
+		Voxels->RegisterComponent();
+		for (int32 X = 0; X < 8; ++X)
+		{
+			for (int32 Y = 0; Y < 4; ++Y)
+			{
+				for (int32 Z = 0; Z < 4; ++Z)
+				{
+					FVoxelBlock Block;
+					Block.Position = FVector(X, Y, Z);
+					Block.Size = FVector::OneVector;
+					Block.MaterialType = MaterialName;
+					Block.CalculateProperties();
+					Voxels->AddBlock(Block);
+				}
+			}
+		}
+		if (Partition)
+		{
+			Partition->RegisterActor(Ship);
+		}
+
+		FFleetShip Entry;
+		Entry.Voxels = Voxels;
+		Entry.Location = Location;
+		for (const FVoxelBlock& Block : Voxels->GetAllBlocks())
+		{
+			Entry.BlockIds.Add(Block.Id);
+		}
+		Fleet->Add(Entry);
+	}
+
+	State->PerFrameLoad = [State, Fleet](UWorld* InWorld)
+	{
+		UProjectileSubsystem* Projectiles = InWorld->GetSubsystem<UProjectileSubsystem>();
+		if (Fleet->Num() < 2)
+		{
+			return;
+		}
+
+		// Sustained crossfire: twenty shots per frame between random ships
+		for (int32 Shot = 0; Shot < 20 && Projectiles; ++Shot)
+		{
+			const FFleetShip& From = (*Fleet)[State->Random.RandRange(0, Fleet->Num() - 1)];
+			const FFleetShip& To = (*Fleet)[State->Random.RandRange(0, Fleet->Num() - 1)];
+			Projectiles->FireProjectile(nullptr, From.Location,
+				(To.Location - From.Location).GetSafeNormal(), 20000.0f, 25.0f, 100000.0f);
+		}
+
+		// Direct block damage on a few hulls guarantees destruction even
+		// when the crossfire misses, keeping remeshing saturated
+		for (int32 Hit = 0; Hit < 5; ++Hit)
+		{
+			const FFleetShip& Ship = (*Fleet)[State->Random.RandRange(0, Fleet->Num() - 1)];
+			if (UVoxelComponent* Voxels = Ship.Voxels.Get())
+			{
+				if (Ship.BlockIds.Num() > 0)
+				{
+					Voxels->DamageBlock(Ship.BlockIds[State->Random.RandRange(0, Ship.BlockIds.Num() - 1)], 40.0f);
+				}
+			}
+		}
+	};
+
+	SubspacePerf::FBudget Budget;
+	SubspacePerf::BeginCsvCapture(World, 15.0f);
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfSampleCommand(State, FPlatformTime::Seconds() + 15.0));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfCheckBudgetCommand(this, State, Budget, TEXT("VoxelFleetBattle")));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfTeardownCommand(State));
+	return true;
+}
+
+/**
+ * Full ambient sector: the staged solar system spawn (Sun plus nine
+ * orbiting planets with surface LOD) and a dense instanced asteroid
+ * field, sampled with no scripted load so the measurement is the pure
+ * cost of the world existing.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSubspacePerfFullSectorTest, "Subspace.Perf.FullSector",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+bool FSubspacePerfFullSectorTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = SubspacePerf::GetGameWorld();
+	if (!World)
+	{
+		AddError(TEXT("No game world; run with -game (headless: -nullrhi) and Automation RunTests Subspace.Perf"));
+		return false;
+	}
+
+	TSharedRef<SubspacePerf::FScenarioState> State = MakeShared<SubspacePerf::FScenarioState>();
+	State->World = World;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	if (ASolarSystemManager* SolarSystem = World->SpawnActor<ASolarSystemManager>(
+		ASolarSystemManager::StaticClass(), FVector::ZeroVector, FRotator::ZeroRotator, SpawnParams))
+	{
+		State->SpawnedActors.Add(SolarSystem);
+	}
+	if (UAsteroidFieldSubsystem* Field = World->GetSubsystem<UAsteroidFieldSubsystem>())
+	{
+		Field->GenerateField(FVector::ZeroVector, 100000.0f, 2500, 20260826);
+	}
+
+	// The solar system stages itself through the init scheduler; measure
+	// only after the staged spawn drains so load cost is not conflated
+	// with steady-state cost
+	SubspacePerf::FBudget Budget;
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfWaitForInitCommand(State, FPlatformTime::Seconds() + 30.0));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfSampleCommand(State, FPlatformTime::Seconds() + 45.0));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfCheckBudgetCommand(this, State, Budget, TEXT("FullSector")));
+	ADD_LATENT_AUTOMATION_COMMAND(FSubspacePerfTeardownCommand(State));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -37,6 +37,24 @@ void ASubspacePlayerController::SetupInputComponent()
 	SetupEnhancedInput();
 }
 
+void ASubspacePlayerController::ServerRequestVoxelBaseline_Implementation(UVoxelComponent* Target)
+{
+	// An unresolved target means this client's channel for the component
+	// has not opened yet; the component retries until the reply lands
+	if (Target && Target->IsEditAuthority())
+	{
+		ClientReceiveVoxelBaseline(Target, Target->BuildBaseline());
+	}
+}
+
+void ASubspacePlayerController::ClientReceiveVoxelBaseline_Implementation(UVoxelComponent* Target, FVoxelEditDelta Baseline)
+{
+	if (Target)
+	{
+		Target->ApplyBaseline(Baseline);
+	}
+}
+
 void ASubspacePlayerController::SetupEnhancedInput()
 {
 	if (!InputConfig)
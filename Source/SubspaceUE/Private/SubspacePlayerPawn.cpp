@@ -7,6 +7,8 @@
 #include "UObject/ConstructorHelpers.h"
 #include "SubspacePlayerController.h"
 #include "Materials/MaterialInstanceDynamic.h"
+#include "SpatialPartitionSubsystem.h"
+#include "FlightDynamicsSubsystem.h"
 #include "SubspaceCharacter.h"
 
 ASubspacePlayerPawn::ASubspacePlayerPawn()
@@ -71,9 +73,37 @@ void ASubspacePlayerPawn::BeginPlay()
 		}
 	}
 	
+	// Register with the sector spatial partition for proximity queries
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->RegisterActor(this);
+	}
+
+	// Linear motion is integrated by the shared fixed-step flight solver
+	if (UFlightDynamicsSubsystem* Flight = GetWorld()->GetSubsystem<UFlightDynamicsSubsystem>())
+	{
+		Flight->RegisterShip(this, ShipMass, DragCoefficient);
+		FlightDynamics = Flight;
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("SubspacePlayerPawn: Ship initialized"));
 }
 
+void ASubspacePlayerPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->UnregisterActor(this);
+	}
+
+	if (UFlightDynamicsSubsystem* Flight = FlightDynamics.Get())
+	{
+		Flight->UnregisterShip(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void ASubspacePlayerPawn::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -120,14 +150,14 @@ void ASubspacePlayerPawn::SetupPlayerInputComponent(UInputComponent* PlayerInput
 
 void ASubspacePlayerPawn::ApplyThrust(const FVector& Direction, float Magnitude)
 {
-	// Force = Mass * Acceleration
-	// Acceleration = Force / Mass
 	FVector Force = Direction * Magnitude * MaxThrust;
-	// Convert to world space
+	// Convert to world space and hand off to the fixed-step integrator,
+	// which applies F = ma at the simulation rate rather than frame rate
 	FVector WorldForce = GetActorRotation().RotateVector(Force);
-	// Apply acceleration (F = ma, so a = F/m)
-	FVector Acceleration = WorldForce / ShipMass;
-	Velocity += Acceleration * GetWorld()->GetDeltaSeconds();
+	if (UFlightDynamicsSubsystem* Flight = FlightDynamics.Get())
+	{
+		Flight->AddForce(this, WorldForce);
+	}
 }
 
 void ASubspacePlayerPawn::ApplyRotation(const FVector& RotationAxis, float Magnitude)
@@ -138,20 +168,11 @@ void ASubspacePlayerPawn::ApplyRotation(const FVector& RotationAxis, float Magni
 
 void ASubspacePlayerPawn::UpdatePhysics(float DeltaTime)
 {
-	// Apply velocity to position (Unreal uses cm, so velocity is in cm/s)
-	FVector NewLocation = GetActorLocation() + (Velocity * DeltaTime);
-	SetActorLocation(NewLocation);
-
-	// Apply simplified quadratic drag: Drag_force = Cd * v^2 (omitting density for gameplay tuning)
-	// This creates more realistic speed limiting than linear drag
-	float Speed = Velocity.Size();
-	if (Speed > 0.01f)
+	// Position and quadratic drag are integrated by UFlightDynamicsSubsystem
+	// at a fixed timestep; mirror its velocity for HUD and Blueprint readers
+	if (const UFlightDynamicsSubsystem* Flight = FlightDynamics.Get())
 	{
-		float SpeedSquared = Speed * Speed; // Cache for performance
-		FVector VelocityDirection = Velocity / Speed; // Normalize velocity (cached to avoid GetSafeNormal)
-		FVector DragForce = -VelocityDirection * DragCoefficient * SpeedSquared;
-		FVector DragAcceleration = DragForce / ShipMass;
-		Velocity += DragAcceleration * DeltaTime;
+		Velocity = Flight->GetShipVelocity(this);
 	}
 
 	// Apply angular velocity to rotation
@@ -263,6 +284,10 @@ void ASubspacePlayerPawn::EmergencyBrake()
 {
 	Velocity = FVector::ZeroVector;
 	AngularVelocity = FVector::ZeroVector;
+	if (UFlightDynamicsSubsystem* Flight = FlightDynamics.Get())
+	{
+		Flight->SetShipVelocity(this, FVector::ZeroVector);
+	}
 	UE_LOG(LogTemp, Log, TEXT("SubspacePlayerPawn: Emergency brake engaged"));
 }
 
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "SubspaceStats.h"
+#include "Containers/Ticker.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSubspaceStats, Log, All);
+
+CSV_DEFINE_CATEGORY_MODULE(SUBSPACEUE_API, Subspace, true);
+
+DEFINE_STAT(STAT_SubspaceVoxelRebuild);
+DEFINE_STAT(STAT_SubspaceTradingProduction);
+DEFINE_STAT(STAT_SubspaceNavigationTick);
+DEFINE_STAT(STAT_SubspaceOrbitStep);
+
+#if CSV_PROFILER
+namespace
+{
+	/**
+	 * Subspace.CsvCapture <seconds>
+	 * Captures a frame-cost CSV over the given window (default 10s) and
+	 * writes it to Saved/Profiling/CSV. Runs fine on headless servers
+	 * where attaching Insights is impractical.
+	 */
+	void SubspaceCsvCapture(const TArray<FString>& Args)
+	{
+		FCsvProfiler* Profiler = FCsvProfiler::Get();
+		if (!Profiler || Profiler->IsCapturing())
+		{
+			UE_LOG(LogSubspaceStats, Warning, TEXT("SubspaceStats: CSV capture already in progress"));
+			return;
+		}
+
+		float Seconds = 10.0f;
+		if (Args.Num() > 0)
+		{
+			Seconds = FMath::Clamp(FCString::Atof(*Args[0]), 1.0f, 600.0f);
+		}
+
+		Profiler->BeginCapture(-1, FPaths::ProfilingDir() / TEXT("CSV"));
+		UE_LOG(LogSubspaceStats, Log, TEXT("SubspaceStats: Capturing frame-cost CSV for %.1fs"), Seconds);
+
+		FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateLambda(
+			[](float) -> bool
+			{
+				if (FCsvProfiler* Prof = FCsvProfiler::Get())
+				{
+					Prof->EndCapture();
+					UE_LOG(LogSubspaceStats, Log, TEXT("SubspaceStats: CSV capture complete, see Saved/Profiling/CSV"));
+				}
+				return false;
+			}), Seconds);
+	}
+
+	FAutoConsoleCommand GSubspaceCsvCaptureCmd(
+		TEXT("Subspace.CsvCapture"),
+		TEXT("Capture per-system frame-cost CSV for N seconds (default 10) to Saved/Profiling/CSV"),
+		FConsoleCommandWithArgsDelegate::CreateStatic(&SubspaceCsvCapture));
+}
+#endif // CSV_PROFILER
@@ -0,0 +1,200 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "TradeIndexSubsystem.h"
+#include "GameFramework/Actor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTradeIndex, Log, All);
+
+void UTradeIndexSubsystem::RegisterStation(UTradingComponent* Station)
+{
+	if (!Station)
+	{
+		return;
+	}
+	Stations.Add(Station);
+	DirtyStations.Add(Station);
+}
+
+void UTradeIndexSubsystem::UnregisterStation(UTradingComponent* Station)
+{
+	if (!Station)
+	{
+		return;
+	}
+	Stations.Remove(Station);
+	DirtyStations.Remove(Station);
+
+	for (TPair<FName, FWareOfferBook>& BookPair : OfferBooks)
+	{
+		BookPair.Value.SellOffers.RemoveAll([Station](const FTradeOffer& Offer) { return Offer.Station == Station; });
+		BookPair.Value.BuyOffers.RemoveAll([Station](const FTradeOffer& Offer) { return Offer.Station == Station; });
+	}
+}
+
+void UTradeIndexSubsystem::MarkStationDirty(UTradingComponent* Station)
+{
+	if (Station && Stations.Contains(Station))
+	{
+		DirtyStations.Add(Station);
+	}
+}
+
+void UTradeIndexSubsystem::RefreshDirtyStations()
+{
+	if (DirtyStations.Num() == 0)
+	{
+		return;
+	}
+
+	TSet<FName> TouchedWares;
+	for (const TWeakObjectPtr<UTradingComponent>& WeakStation : DirtyStations)
+	{
+		UTradingComponent* Station = WeakStation.Get();
+		if (!Station)
+		{
+			continue;
+		}
+
+		// Drop the station's stale offers everywhere, then re-add
+		for (TPair<FName, FWareOfferBook>& BookPair : OfferBooks)
+		{
+			const int32 Removed =
+				BookPair.Value.SellOffers.RemoveAll([Station](const FTradeOffer& Offer) { return Offer.Station == Station; }) +
+				BookPair.Value.BuyOffers.RemoveAll([Station](const FTradeOffer& Offer) { return Offer.Station == Station; });
+			if (Removed > 0)
+			{
+				TouchedWares.Add(BookPair.Key);
+			}
+		}
+		RebuildStationOffers(Station);
+		for (const FTradeOrder& Order : Station->TradeOrders)
+		{
+			TouchedWares.Add(Order.WareId);
+		}
+	}
+	DirtyStations.Empty();
+
+	// Restore price ordering in every book that changed
+	for (const FName& WareId : TouchedWares)
+	{
+		if (FWareOfferBook* Book = OfferBooks.Find(WareId))
+		{
+			Book->SellOffers.Sort([](const FTradeOffer& A, const FTradeOffer& B) { return A.UnitPrice < B.UnitPrice; });
+			Book->BuyOffers.Sort([](const FTradeOffer& A, const FTradeOffer& B) { return A.UnitPrice > B.UnitPrice; });
+		}
+	}
+}
+
+void UTradeIndexSubsystem::RebuildStationOffers(UTradingComponent* Station)
+{
+	AActor* Owner = Station->GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+	const FVector Location = Owner->GetActorLocation();
+
+	for (int32 OrderIndex = 0; OrderIndex < Station->TradeOrders.Num(); ++OrderIndex)
+	{
+		const FTradeOrder& Order = Station->TradeOrders[OrderIndex];
+		if (!Order.bIsActive)
+		{
+			continue;
+		}
+
+		const int32 Stock = Station->GetWareStock(Order.WareId);
+		FTradeOffer Offer;
+		Offer.Station = Station;
+		Offer.Location = Location;
+
+		// The station publishes its order prices whenever stock changes;
+		// the index reads the table instead of re-running the price curve
+		Offer.UnitPrice = Station->GetPublishedPrice(OrderIndex);
+
+		if (Order.bIsBuyOrder)
+		{
+			// Station buys until its stock reaches MaxQuantity
+			Offer.Quantity = Order.MaxQuantity - Stock;
+			if (Offer.Quantity > 0)
+			{
+				OfferBooks.FindOrAdd(Order.WareId).BuyOffers.Add(Offer);
+			}
+		}
+		else
+		{
+			// Station sells stock above its MinQuantity reserve
+			Offer.Quantity = Stock - Order.MinQuantity;
+			if (Offer.Quantity > 0)
+			{
+				OfferBooks.FindOrAdd(Order.WareId).SellOffers.Add(Offer);
+			}
+		}
+	}
+}
+
+TArray<FTradeDeal> UTradeIndexSubsystem::FindProfitableDeals(const FVector& CurrentLocation, float MaxJumpDistance, int32 MaxResults)
+{
+	RefreshDirtyStations();
+
+	const float MaxDistSquared = MaxJumpDistance * MaxJumpDistance;
+	TArray<FTradeDeal> Deals;
+
+	for (const TPair<FName, FWareOfferBook>& BookPair : OfferBooks)
+	{
+		const FWareOfferBook& Book = BookPair.Value;
+
+		// Cheapest in-range seller
+		const FTradeOffer* BestSell = nullptr;
+		for (const FTradeOffer& Offer : Book.SellOffers)
+		{
+			if (Offer.Station.IsValid() && FVector::DistSquared(CurrentLocation, Offer.Location) <= MaxDistSquared)
+			{
+				BestSell = &Offer;
+				break;
+			}
+		}
+		if (!BestSell)
+		{
+			continue;
+		}
+
+		// Best-paying in-range buyer at a different station
+		const FTradeOffer* BestBuy = nullptr;
+		for (const FTradeOffer& Offer : Book.BuyOffers)
+		{
+			if (Offer.Station.IsValid() && Offer.Station != BestSell->Station &&
+			    FVector::DistSquared(CurrentLocation, Offer.Location) <= MaxDistSquared)
+			{
+				BestBuy = &Offer;
+				break;
+			}
+		}
+		if (!BestBuy)
+		{
+			continue;
+		}
+
+		const float ProfitPerUnit = BestBuy->UnitPrice - BestSell->UnitPrice;
+		if (ProfitPerUnit <= 0.0f)
+		{
+			continue;
+		}
+
+		FTradeDeal Deal;
+		Deal.BuyStation = BestSell->Station->GetOwner();   // where the trader buys
+		Deal.SellStation = BestBuy->Station->GetOwner();   // where the trader sells
+		Deal.WareId = BookPair.Key;
+		Deal.ProfitPerUnit = ProfitPerUnit;
+		Deal.Volume = FMath::Min(BestSell->Quantity, BestBuy->Quantity);
+		Deal.TotalProfit = ProfitPerUnit * Deal.Volume;
+		Deal.Distance = FVector::Dist(BestSell->Location, BestBuy->Location);
+		Deals.Add(Deal);
+	}
+
+	Deals.Sort([](const FTradeDeal& A, const FTradeDeal& B) { return A.TotalProfit > B.TotalProfit; });
+	if (Deals.Num() > MaxResults)
+	{
+		Deals.SetNum(MaxResults);
+	}
+	return Deals;
+}
@@ -1,6 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "TradingComponent.h"
+#include "SubspaceStats.h"
+#include "ProductionSchedulerSubsystem.h"
+#include "TradeIndexSubsystem.h"
 #include "Engine/World.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -20,15 +23,74 @@ void UTradingComponent::BeginPlay()
 	{
 		InitializeWareLibrary();
 	}
+	else if (WareIds.Num() != WareLibrary.Num())
+	{
+		// Library was preconfigured in the editor; intern it now
+		RebuildWareIndex();
+	}
+
+	// Stations configured before BeginPlay join the trade index now;
+	// SetupStationTrading covers the ones configured later
+	if (TradeOrders.Num() > 0)
+	{
+		RepublishPrices();
+		RegisterWithTradeIndex();
+	}
+
+	// Production runs on completion events, not ticks
+	if (UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
+	{
+		ProductionScheduler = GameInstance->GetSubsystem<UProductionSchedulerSubsystem>();
+	}
+	NotifyProductionStateChanged();
+}
+
+void UTradingComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UTradeIndexSubsystem* Index = TradeIndex.Get())
+	{
+		Index->UnregisterStation(this);
+	}
+	if (UProductionSchedulerSubsystem* Scheduler = ProductionScheduler.Get())
+	{
+		Scheduler->CancelStationProduction(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void UTradingComponent::NotifyProductionStateChanged()
+{
+	if (UProductionSchedulerSubsystem* Scheduler = ProductionScheduler.Get())
+	{
+		Scheduler->ScheduleStationProduction(this);
+	}
+}
+
+void UTradingComponent::RegisterWithTradeIndex()
+{
+	if (UTradeIndexSubsystem* Index = GetWorld() ? GetWorld()->GetSubsystem<UTradeIndexSubsystem>() : nullptr)
+	{
+		TradeIndex = Index;
+		Index->RegisterStation(this);
+	}
+}
+
+void UTradingComponent::NotifyTradeIndexDirty()
+{
+	if (UTradeIndexSubsystem* Index = TradeIndex.Get())
+	{
+		Index->MarkStationDirty(this);
+	}
 }
 
 void UTradingComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	
-	// Update production for stations
-	UpdateProduction(DeltaTime);
-	
+
+	// Production is handled by UProductionSchedulerSubsystem completion
+	// events; nothing per-tick for stations anymore
+
 	// TODO: Auto-trade logic for ships
 	if (bAutoTradeEnabled)
 	{
@@ -87,10 +149,13 @@ void UTradingComponent::InitializeWareLibrary()
 		EngineComponents->InputWares.Add(TEXT("Crystals"), 1);
 	}
 	
+	// Assign dense indices and size the flat stock array
+	RebuildWareIndex();
+
 	UE_LOG(LogTrading, Log, TEXT("Initialized ware library with %d wares"), WareLibrary.Num());
 }
 
-float UTradingComponent::CalculatePrice(const FString& WareId, bool bIsBuying) const
+float UTradingComponent::CalculatePrice(FName WareId, bool bIsBuying) const
 {
 	const FWare* Ware = WareLibrary.Find(WareId);
 	if (!Ware)
@@ -120,7 +185,40 @@ float UTradingComponent::CalculatePrice(const FString& WareId, bool bIsBuying) c
 	return BasePrice * PriceModifier;
 }
 
-bool UTradingComponent::BuyWare(AActor* FromStation, const FString& WareId, int32 Quantity, int32& OutCost)
+void UTradingComponent::RepublishPrices()
+{
+	PublishedPrices.SetNum(TradeOrders.Num());
+	for (int32 OrderIndex = 0; OrderIndex < TradeOrders.Num(); ++OrderIndex)
+	{
+		const FTradeOrder& Order = TradeOrders[OrderIndex];
+		PublishedPrices[OrderIndex] = Order.bIsActive
+			? CalculatePrice(Order.WareId, Order.bIsBuyOrder) * Order.PriceModifier
+			: 0.0f;
+	}
+}
+
+void UTradingComponent::RepublishPricesForWare(FName WareId)
+{
+	// Only the changed ware's orders reprice - the curve depends on that
+	// ware's stock alone, so everything else stays published as-is
+	if (PublishedPrices.Num() != TradeOrders.Num())
+	{
+		RepublishPrices();
+		return;
+	}
+	for (int32 OrderIndex = 0; OrderIndex < TradeOrders.Num(); ++OrderIndex)
+	{
+		const FTradeOrder& Order = TradeOrders[OrderIndex];
+		if (Order.WareId == WareId)
+		{
+			PublishedPrices[OrderIndex] = Order.bIsActive
+				? CalculatePrice(Order.WareId, Order.bIsBuyOrder) * Order.PriceModifier
+				: 0.0f;
+		}
+	}
+}
+
+bool UTradingComponent::BuyWare(AActor* FromStation, FName WareId, int32 Quantity, int32& OutCost)
 {
 	if (!FromStation || Quantity <= 0)
 	{
@@ -159,14 +257,14 @@ bool UTradingComponent::BuyWare(AActor* FromStation, const FString& WareId, int3
 		Credits -= OutCost;
 		StationTrading->Credits += OutCost;
 		
-		UE_LOG(LogTrading, Log, TEXT("Bought %d x %s for %d credits"), Quantity, *WareId, OutCost);
+		UE_LOG(LogTrading, Log, TEXT("Bought %d x %s for %d credits"), Quantity, *WareId.ToString(), OutCost);
 		return true;
 	}
 	
 	return false;
 }
 
-bool UTradingComponent::SellWare(AActor* ToStation, const FString& WareId, int32 Quantity, int32& OutRevenue)
+bool UTradingComponent::SellWare(AActor* ToStation, FName WareId, int32 Quantity, int32& OutRevenue)
 {
 	if (!ToStation || Quantity <= 0)
 	{
@@ -202,7 +300,7 @@ bool UTradingComponent::SellWare(AActor* ToStation, const FString& WareId, int32
 		Credits += OutRevenue;
 		StationTrading->Credits -= OutRevenue;
 		
-		UE_LOG(LogTrading, Log, TEXT("Sold %d x %s for %d credits"), Quantity, *WareId, OutRevenue);
+		UE_LOG(LogTrading, Log, TEXT("Sold %d x %s for %d credits"), Quantity, *WareId.ToString(), OutRevenue);
 		return true;
 	}
 	
@@ -211,16 +309,17 @@ bool UTradingComponent::SellWare(AActor* ToStation, const FString& WareId, int32
 
 TArray<FTradeDeal> UTradingComponent::FindProfitableDeals(FVector CurrentLocation, float MaxJumpDistance, int32 MaxResults)
 {
-	TArray<FTradeDeal> Deals;
-	
-	// TODO: Query all stations in range
-	// For each ware, find best buy/sell station pair
-	// Calculate profit considering distance and volume
-	
-	return Deals;
+	// The sector trade index keeps price-sorted per-ware offer books, so
+	// the best buy/sell pair per ware is an index walk, not a scan over
+	// every station's every ware
+	if (UTradeIndexSubsystem* Index = GetWorld() ? GetWorld()->GetSubsystem<UTradeIndexSubsystem>() : nullptr)
+	{
+		return Index->FindProfitableDeals(CurrentLocation, MaxJumpDistance, MaxResults);
+	}
+	return TArray<FTradeDeal>();
 }
 
-bool UTradingComponent::AddWareToStorage(const FString& WareId, int32 Quantity)
+bool UTradingComponent::AddWareToStorage(FName WareId, int32 Quantity)
 {
 	const FWare* Ware = WareLibrary.Find(WareId);
 	if (!Ware || Quantity <= 0)
@@ -236,21 +335,21 @@ bool UTradingComponent::AddWareToStorage(const FString& WareId, int32 Quantity)
 		return false;
 	}
 	
-	int32* CurrentStock = Storage.WareStock.Find(WareId);
-	if (CurrentStock)
-	{
-		*CurrentStock += Quantity;
-	}
-	else
+	const int32 WareIndex = GetWareIndex(WareId);
+	if (WareIndex == INDEX_NONE)
 	{
-		Storage.WareStock.Add(WareId, Quantity);
+		return false;
 	}
-	
+	Storage.StockByIndex[WareIndex] += Quantity;
+
 	Storage.CurrentUsed += RequiredSpace;
+	RepublishPricesForWare(WareId);
+	NotifyTradeIndexDirty();
+	NotifyProductionStateChanged();
 	return true;
 }
 
-bool UTradingComponent::RemoveWareFromStorage(const FString& WareId, int32 Quantity)
+bool UTradingComponent::RemoveWareFromStorage(FName WareId, int32 Quantity)
 {
 	const FWare* Ware = WareLibrary.Find(WareId);
 	if (!Ware || Quantity <= 0)
@@ -258,26 +357,47 @@ bool UTradingComponent::RemoveWareFromStorage(const FString& WareId, int32 Quant
 		return false;
 	}
 	
-	int32* CurrentStock = Storage.WareStock.Find(WareId);
-	if (!CurrentStock || *CurrentStock < Quantity)
+	const int32 WareIndex = GetWareIndex(WareId);
+	if (WareIndex == INDEX_NONE || Storage.StockByIndex[WareIndex] < Quantity)
 	{
 		return false;
 	}
-	
-	*CurrentStock -= Quantity;
+
+	Storage.StockByIndex[WareIndex] -= Quantity;
 	int32 FreedSpace = FMath::RoundToInt(Ware->Volume * Quantity);
 	Storage.CurrentUsed = FMath::Max(0, Storage.CurrentUsed - FreedSpace);
-	
+
+	RepublishPricesForWare(WareId);
+	NotifyTradeIndexDirty();
+	NotifyProductionStateChanged();
 	return true;
 }
 
-int32 UTradingComponent::GetWareStock(const FString& WareId) const
+int32 UTradingComponent::GetWareStock(FName WareId) const
 {
-	const int32* Stock = Storage.WareStock.Find(WareId);
-	return Stock ? *Stock : 0;
+	return GetWareStockByIndex(GetWareIndex(WareId));
 }
 
-void UTradingComponent::SetupStationTrading(const TArray<FString>& BuyWares, const TArray<FString>& SellWares)
+int32 UTradingComponent::GetWareIndex(FName WareId) const
+{
+	const int32* Index = WareIndexLookup.Find(WareId);
+	return Index ? *Index : INDEX_NONE;
+}
+
+void UTradingComponent::RebuildWareIndex()
+{
+	WareIds.Empty(WareLibrary.Num());
+	WareIndexLookup.Empty(WareLibrary.Num());
+	for (const TPair<FName, FWare>& WarePair : WareLibrary)
+	{
+		WareIndexLookup.Add(WarePair.Key, WareIds.Add(WarePair.Key));
+	}
+
+	// Preserve existing stock where possible; new wares start at zero
+	Storage.StockByIndex.SetNumZeroed(WareIds.Num());
+}
+
+void UTradingComponent::SetupStationTrading(const TArray<FName>& BuyWares, const TArray<FName>& SellWares)
 {
 	TradeOrders.Empty();
 	
@@ -309,10 +429,20 @@ void UTradingComponent::SetupStationTrading(const TArray<FString>& BuyWares, con
 	
 	UE_LOG(LogTrading, Log, TEXT("Setup station trading: %d buy orders, %d sell orders"),
 		BuyWares.Num(), SellWares.Num());
+
+	// New orders mean new published prices, new offers for the trade
+	// index, and possibly new production cycles to schedule
+	RepublishPrices();
+	RegisterWithTradeIndex();
+	NotifyTradeIndexDirty();
+	NotifyProductionStateChanged();
 }
 
 void UTradingComponent::UpdateProduction(float DeltaTime)
 {
+	SCOPE_CYCLE_COUNTER(STAT_SubspaceTradingProduction);
+	CSV_SCOPED_TIMING_STAT(Subspace, TradingProduction);
+
 	ProductionTimer += DeltaTime;
 	
 	// Process production every 10 seconds
@@ -339,7 +469,7 @@ void UTradingComponent::UpdateProduction(float DeltaTime)
 			{
 				// Check if we have input materials
 				bool bCanProduce = true;
-				for (const TPair<FString, int32>& Input : Ware->InputWares)
+				for (const TPair<FName, int32>& Input : Ware->InputWares)
 				{
 					if (GetWareStock(Input.Key) < Input.Value)
 					{
@@ -351,14 +481,14 @@ void UTradingComponent::UpdateProduction(float DeltaTime)
 				if (bCanProduce)
 				{
 					// Consume input materials
-					for (const TPair<FString, int32>& Input : Ware->InputWares)
+					for (const TPair<FName, int32>& Input : Ware->InputWares)
 					{
 						RemoveWareFromStorage(Input.Key, Input.Value);
 					}
 					
 					// Produce output
 					AddWareToStorage(Order.WareId, 1);
-					UE_LOG(LogTrading, Verbose, TEXT("Produced 1x %s"), *Order.WareId);
+					UE_LOG(LogTrading, Verbose, TEXT("Produced 1x %s"), *Order.WareId.ToString());
 				}
 			}
 		}
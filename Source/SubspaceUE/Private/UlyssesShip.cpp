@@ -3,6 +3,10 @@
 #include "UlyssesShip.h"
 #include "ShipInteriorComponent.h"
 #include "ShipEquipmentComponent.h"
+#include "SpatialPartitionSubsystem.h"
+#include "FlightDynamicsSubsystem.h"
+#include "ShipVitalsSubsystem.h"
+#include "ShipClassRegistry.h"
 #include "Components/StaticMeshComponent.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogUlyssesShip, Log, All);
@@ -35,19 +39,75 @@ void AUlyssesShip::BeginPlay()
 	Super::BeginPlay();
 
 	InitializeUlysses();
+
+	// Register with the sector spatial partition for proximity queries
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->RegisterActor(this);
+	}
+
+	// Register with the shared fixed-step flight solver; drag matches the
+	// player pawn's tuning until ships get per-class drag stats
+	if (UFlightDynamicsSubsystem* Flight = GetWorld()->GetSubsystem<UFlightDynamicsSubsystem>())
+	{
+		Flight->RegisterShip(this, Stats.Mass, 0.5f);
+		FlightDynamics = Flight;
+	}
+
+	// Shield and energy regeneration run in the sector-wide batched pass;
+	// shields regenerate at 10% of max per second, energy likewise
+	if (UShipVitalsSubsystem* Vitals = GetWorld()->GetSubsystem<UShipVitalsSubsystem>())
+	{
+		Vitals->RegisterShip(this, Stats.MaxShield, Stats.MaxShield * 0.1f,
+			Stats.PowerGeneration, Stats.PowerGeneration * 0.1f, CurrentShield, CurrentEnergy);
+		ShipVitals = Vitals;
+	}
+}
+
+void AUlyssesShip::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (USpatialPartitionSubsystem* Partition = GetWorld()->GetSubsystem<USpatialPartitionSubsystem>())
+	{
+		Partition->UnregisterActor(this);
+	}
+
+	if (UFlightDynamicsSubsystem* Flight = FlightDynamics.Get())
+	{
+		Flight->UnregisterShip(this);
+	}
+
+	if (UShipVitalsSubsystem* Vitals = ShipVitals.Get())
+	{
+		Vitals->UnregisterShip(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AUlyssesShip::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
-	// Regenerate shields over time
-	RegenerateShields(DeltaTime);
+	// Mirror the integrator's velocity so GetCurrentSpeed stays accurate
+	if (const UFlightDynamicsSubsystem* Flight = FlightDynamics.Get())
+	{
+		Velocity = Flight->GetShipVelocity(this);
+	}
 
-	// Regenerate energy
-	if (CurrentEnergy < Stats.PowerGeneration)
+	// Shield/energy regen runs batched in UShipVitalsSubsystem; mirror the
+	// authoritative values for Blueprint and the percentage getters
+	if (const UShipVitalsSubsystem* Vitals = ShipVitals.Get())
 	{
-		CurrentEnergy = FMath::Min(CurrentEnergy + (Stats.PowerGeneration * DeltaTime * 0.1f), Stats.PowerGeneration);
+		CurrentShield = Vitals->GetShield(this);
+		CurrentEnergy = Vitals->GetEnergy(this);
+	}
+	else
+	{
+		RegenerateShields(DeltaTime);
+		if (CurrentEnergy < Stats.PowerGeneration)
+		{
+			CurrentEnergy = FMath::Min(CurrentEnergy + (Stats.PowerGeneration * DeltaTime * 0.1f), Stats.PowerGeneration);
+		}
 	}
 }
 
@@ -85,7 +145,18 @@ void AUlyssesShip::InitializeUlysses()
 
 void AUlyssesShip::SetupDefaultStats()
 {
-	// Ulysses Corvette-class default statistics
+	// The registry serves the shared baked class block: designers tune
+	// the DataTable, and spawning copies a finished stat struct instead
+	// of assembling values imperatively
+	if (UShipClassRegistry* Registry = UGameInstance::GetSubsystem<UShipClassRegistry>(GetGameInstance()))
+	{
+		ShipClassIndex = Registry->FindShipClassIndex(TEXT("Ulysses"));
+		Stats = Registry->GetShipClass(ShipClassIndex).Stats;
+		return;
+	}
+
+	// Ulysses Corvette-class default statistics (no registry available,
+	// e.g. spawned without a game instance in tests)
 	Stats.Hull = 1500.0f;
 	Stats.MaxHull = 1500.0f;
 	Stats.Shield = 750.0f;
@@ -176,8 +247,13 @@ void AUlyssesShip::ApplyDamage(float Amount)
 {
 	if (Amount <= 0.0f) return;
 
-	// Shields absorb damage first
-	if (CurrentShield > 0.0f)
+	// Shields absorb damage first; the vitals subsystem owns the value
+	if (UShipVitalsSubsystem* Vitals = ShipVitals.Get())
+	{
+		Amount = Vitals->DrainShield(this, Amount);
+		CurrentShield = Vitals->GetShield(this);
+	}
+	else if (CurrentShield > 0.0f)
 	{
 		float ShieldDamage = FMath::Min(Amount, CurrentShield);
 		CurrentShield -= ShieldDamage;
@@ -200,10 +276,16 @@ void AUlyssesShip::ApplyDamage(float Amount)
 
 void AUlyssesShip::RegenerateShields(float DeltaTime)
 {
+	// Normally handled by the batched vitals pass; kept for scripted
+	// catch-up regeneration and as the fallback path
 	if (CurrentShield < Stats.MaxShield)
 	{
 		// Shields regenerate at 10% of max per second
 		float RegenRate = Stats.MaxShield * 0.1f;
 		CurrentShield = FMath::Min(CurrentShield + (RegenRate * DeltaTime), Stats.MaxShield);
+		if (UShipVitalsSubsystem* Vitals = ShipVitals.Get())
+		{
+			Vitals->SetShield(this, CurrentShield);
+		}
 	}
 }
@@ -42,8 +42,10 @@ bool FVoxelBlock::Intersects(const FVoxelBlock& Other) const
 
 void FVoxelBlock::CalculateProperties()
 {
-	// Use the new material system
-	FVoxelMaterialProperties Material = UVoxelMaterialLibrary::GetMaterialPropertiesByName(MaterialType);
+	// Resolve the material string once; everything downstream (packed
+	// mirrors, meshing, damage) uses the cached index
+	MaterialIndex = static_cast<uint8>(UVoxelMaterialLibrary::MaterialNameToTier(MaterialType));
+	const FVoxelMaterialProperties& Material = UVoxelMaterialLibrary::GetMaterialPropertiesByIndex(MaterialIndex);
 	float Volume = Size.X * Size.Y * Size.Z;
 
 	// Adjust volume based on shape
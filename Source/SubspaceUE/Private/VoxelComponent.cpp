@@ -1,196 +1,1882 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
 #include "VoxelComponent.h"
+#include "SubspacePlayerController.h"
+#include "SubspaceStats.h"
+#include "VoxelShapeTables.h"
 #include "Components/SceneComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+
+/**
+ * Wire format for replicated voxel edits. Records are chunk-relative so
+ * coordinates fit in a byte per axis (ChunkSize is capped at 64):
+ *
+ *   Add     opcode + local xyz + material + type + shape + orient + rgb  (11 bytes)
+ *   Remove  opcode + local xyz                                           (4 bytes)
+ *   Damage  opcode + local xyz + damage float                            (8 bytes)
+ *
+ * Baseline payloads are groups of [chunk coord, record count, records]
+ * covering every live block, written with the same record layout.
+ */
+namespace VoxelEditFormat
+{
+	constexpr uint8 OpAdd = 0;
+	constexpr uint8 OpRemove = 1;
+	constexpr uint8 OpDamage = 2;
+
+	void WriteLocalCoord(TArray<uint8>& Payload, const FIntVector& Coord, const FIntVector& ChunkCoord, int32 ChunkSize)
+	{
+		Payload.Add(static_cast<uint8>(Coord.X - ChunkCoord.X * ChunkSize));
+		Payload.Add(static_cast<uint8>(Coord.Y - ChunkCoord.Y * ChunkSize));
+		Payload.Add(static_cast<uint8>(Coord.Z - ChunkCoord.Z * ChunkSize));
+	}
+
+	FIntVector ReadLocalCoord(const uint8*& Cursor, const FIntVector& ChunkCoord, int32 ChunkSize)
+	{
+		const FIntVector Coord(
+			ChunkCoord.X * ChunkSize + Cursor[0],
+			ChunkCoord.Y * ChunkSize + Cursor[1],
+			ChunkCoord.Z * ChunkSize + Cursor[2]);
+		Cursor += 3;
+		return Coord;
+	}
+
+	void WriteFloat(TArray<uint8>& Payload, float Value)
+	{
+		Payload.Append(reinterpret_cast<const uint8*>(&Value), sizeof(float));
+	}
+
+	float ReadFloat(const uint8*& Cursor)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, Cursor, sizeof(float));
+		Cursor += sizeof(float);
+		return Value;
+	}
+
+	void WriteInt32(TArray<uint8>& Payload, int32 Value)
+	{
+		Payload.Append(reinterpret_cast<const uint8*>(&Value), sizeof(int32));
+	}
+
+	int32 ReadInt32(const uint8*& Cursor)
+	{
+		int32 Value;
+		FMemory::Memcpy(&Value, Cursor, sizeof(int32));
+		Cursor += sizeof(int32);
+		return Value;
+	}
+
+	void WriteAddRecord(TArray<uint8>& Payload, const FIntVector& ChunkCoord, int32 ChunkSize,
+		const FIntVector& Coord, uint8 Material, uint8 BlockType, uint8 Shape, uint8 Orientation, const FColor& Color)
+	{
+		Payload.Add(OpAdd);
+		WriteLocalCoord(Payload, Coord, ChunkCoord, ChunkSize);
+		Payload.Add(Material);
+		Payload.Add(BlockType);
+		Payload.Add(Shape);
+		Payload.Add(Orientation);
+		Payload.Add(Color.R);
+		Payload.Add(Color.G);
+		Payload.Add(Color.B);
+	}
+}
+
+namespace
+{
+	/** Seconds between baseline request retries while one is unanswered */
+	constexpr float BaselineRetryInterval = 2.0f;
+
+	/** Emit a shaped voxel's precomputed geometry translated to its cell */
+	void AppendShapedVoxel(const FPackedVoxel& Voxel,
+		TArray<FVector>& Vertices, TArray<int32>& Triangles,
+		TArray<FVector>& Normals, TArray<FColor>& VertexColors)
+	{
+		const VoxelShape::FShapeGeometry& Geo = VoxelShape::GetShapeGeometry(Voxel.Shape, Voxel.Orientation);
+		const FVector Center(Voxel.Coord);
+		const int32 BaseIndex = Vertices.Num();
+
+		Vertices.Reserve(BaseIndex + Geo.Vertices.Num());
+		for (int32 i = 0; i < Geo.Vertices.Num(); ++i)
+		{
+			Vertices.Add(Center + Geo.Vertices[i]);
+			Normals.Add(Geo.Normals[i]);
+			VertexColors.Add(Voxel.Color);
+			Triangles.Add(BaseIndex + i);
+		}
+	}
+
+	/**
+	 * Reusable scratch buffers for one mesh build. Rebuilds arrive many
+	 * times per minute under fire and run on worker threads; pooling the
+	 * working buffers and Reset()-ing them between builds keeps their
+	 * capacity across rebuilds instead of churning the allocator.
+	 */
+	struct FMeshBuildScratch
+	{
+		/** Dense voxel-pointer grid for the greedy passes */
+		TArray<const FPackedVoxel*> VoxelGrid;
+
+		/** Voxels owned by this build (border voxels only cull) */
+		TSet<const FPackedVoxel*> OwnedVoxels;
+
+		/** Cube occupancy lookup for the simple mesher */
+		TSet<FIntVector> OccupiedCells;
+
+		/** Cube-only filtered copies when shaped blocks are present */
+		TArray<FPackedVoxel> CubeVoxels;
+		TArray<FPackedVoxel> CubeBorder;
+
+		/** Output buffers for one greedy axis pass */
+		struct FAxisPassBuffers
+		{
+			TArray<FVector> Vertices;
+			TArray<int32> Triangles;
+			TArray<FVector> Normals;
+			TArray<FColor> VertexColors;
+		};
+
+		/** Per-pass buffers for the six parallel greedy passes */
+		FAxisPassBuffers PassOutputs[6];
+
+		/** Clear contents, keeping every allocation */
+		void Reset()
+		{
+			VoxelGrid.Reset();
+			OwnedVoxels.Reset();
+			OccupiedCells.Reset();
+			CubeVoxels.Reset();
+			CubeBorder.Reset();
+			for (FAxisPassBuffers& Pass : PassOutputs)
+			{
+				Pass.Vertices.Reset();
+				Pass.Triangles.Reset();
+				Pass.Normals.Reset();
+				Pass.VertexColors.Reset();
+			}
+		}
+	};
+
+	FCriticalSection GMeshBuildScratchLock;
+	TArray<TUniquePtr<FMeshBuildScratch>> GMeshBuildScratchPool;
+
+	/** One warm scratch per concurrent chunk build is plenty */
+	constexpr int32 MaxPooledScratches = 8;
+
+	/** Checks a scratch out of the pool for the current scope */
+	struct FScopedMeshBuildScratch
+	{
+		FScopedMeshBuildScratch()
+		{
+			{
+				FScopeLock Lock(&GMeshBuildScratchLock);
+				if (GMeshBuildScratchPool.Num() > 0)
+				{
+					Scratch = GMeshBuildScratchPool.Pop(EAllowShrinking::No);
+				}
+			}
+			if (!Scratch)
+			{
+				Scratch = MakeUnique<FMeshBuildScratch>();
+			}
+		}
+
+		~FScopedMeshBuildScratch()
+		{
+			Scratch->Reset();
+			FScopeLock Lock(&GMeshBuildScratchLock);
+			if (GMeshBuildScratchPool.Num() < MaxPooledScratches)
+			{
+				GMeshBuildScratchPool.Add(MoveTemp(Scratch));
+			}
+		}
+
+		FMeshBuildScratch& Get() { return *Scratch; }
+
+	private:
+		TUniquePtr<FMeshBuildScratch> Scratch;
+	};
+}
+
+void FVoxelGridCache::EnsureContains(const FIntVector& Coord)
+{
+	if (GridSize == FIntVector::ZeroValue)
+	{
+		// First allocation: a small region centered on the first block
+		GridMin = Coord - FIntVector(8);
+		GridSize = FIntVector(16);
+		Cells.Init(INDEX_NONE, GridSize.X * GridSize.Y * GridSize.Z);
+		return;
+	}
+
+	if (IsInBounds(Coord))
+	{
+		return;
+	}
+
+	// Double the extent on each axis the coordinate falls outside of, so
+	// repeated growth in one direction costs O(log n) reallocations
+	FIntVector NewMin = GridMin;
+	FIntVector NewMax = GridMin + GridSize - FIntVector(1);
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		int32 Extent = NewMax[Axis] - NewMin[Axis] + 1;
+		while (Coord[Axis] < NewMin[Axis])
+		{
+			NewMin[Axis] -= Extent;
+			Extent *= 2;
+		}
+		while (Coord[Axis] > NewMax[Axis])
+		{
+			NewMax[Axis] += Extent;
+			Extent *= 2;
+		}
+	}
+
+	const FIntVector NewSize = NewMax - NewMin + FIntVector(1);
+	const int64 NewCount = static_cast<int64>(NewSize.X) * NewSize.Y * NewSize.Z;
+	if (NewCount > 128 * 1024 * 1024)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelGridCache: Grid grew to %lld cells - structure bounds are suspiciously large"), NewCount);
+	}
+
+	TArray<int32> NewCells;
+	NewCells.Init(INDEX_NONE, NewCount);
+
+	// Remap the existing cells into the grown allocation
+	for (int32 Z = 0; Z < GridSize.Z; ++Z)
+	{
+		for (int32 Y = 0; Y < GridSize.Y; ++Y)
+		{
+			for (int32 X = 0; X < GridSize.X; ++X)
+			{
+				const int32 OldIndex = X + Y * GridSize.X + Z * GridSize.X * GridSize.Y;
+				if (Cells[OldIndex] != INDEX_NONE)
+				{
+					const FIntVector Local = GridMin + FIntVector(X, Y, Z) - NewMin;
+					NewCells[Local.X + Local.Y * NewSize.X + Local.Z * NewSize.X * NewSize.Y] = Cells[OldIndex];
+				}
+			}
+		}
+	}
+
+	Cells = MoveTemp(NewCells);
+	GridMin = NewMin;
+	GridSize = NewSize;
+}
+
+UVoxelComponent::UVoxelComponent()
+{
+	PrimaryComponentTick.bCanEverTick = true;
+	bUseGreedyMeshing = false;
+	bAsyncMeshing = true;
+	bNeedsRebuild = false;
+	ChunkSize = 32;
+	bDetectSplits = true;
+	bReplicateEdits = false;
+	CollisionRebuildInterval = 0.5f;
+	CollisionRebuildTimer = 0.0f;
+	bEnableLOD = true;
+	LODDistances = { 50000.0f, 150000.0f };
+	CurrentLOD = 0;
+	LODCheckTimer = 0.0f;
+	NextSectionIndex = 0;
+	CachedTotalMass = 0.0f;
+	MassWeightedSum = FVector::ZeroVector;
+	MassWeightedSquaredSum = 0.0f;
+}
+
+void UVoxelComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Create procedural mesh component if not already created
+	if (!ProceduralMesh)
+	{
+		ProceduralMesh = NewObject<UProceduralMeshComponent>(GetOwner(), TEXT("VoxelProceduralMesh"));
+		ProceduralMesh->RegisterComponent();
+		ProceduralMesh->AttachToComponent(GetOwner()->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
+		ProceduralMesh->bUseAsyncCooking = true; // Enable async collision cooking for performance
+	}
+
+	// Initial mesh generation if we have blocks
+	if (Blocks.Num() > 0)
+	{
+		RebuildMesh();
+	}
+
+	if (bReplicateEdits)
+	{
+		SetIsReplicated(true);
+
+		// Late joiner: the block array never replicates, so pull a packed
+		// baseline of the current state and ride the delta stream from there
+		if (GetOwnerRole() != ROLE_Authority)
+		{
+			RequestBaseline();
+		}
+	}
+}
+
+void UVoxelComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	// An unanswered baseline request re-sends until the baseline lands:
+	// the first request can fire before the local controller exists, and
+	// the reply is dropped if this component had no client channel yet
+	if (bAwaitingBaseline)
+	{
+		BaselineRetryTimer -= DeltaTime;
+		if (BaselineRetryTimer <= 0.0f)
+		{
+			RequestBaseline();
+		}
+	}
+
+	// Stream this frame's edits before remeshing: one delta per touched
+	// chunk, however many edits landed in it
+	if (PendingEditDeltas.Num() > 0)
+	{
+		FlushPendingEditDeltas();
+	}
+
+	// Resolve connectivity before remeshing so a split detected this tick
+	// sees the structure state that caused it
+	if (PendingSplitChecks.Num() > 0)
+	{
+		ProcessPendingSplitChecks();
+	}
+
+	// Remesh only the chunks that changed since last tick
+	if (bNeedsRebuild)
+	{
+		RebuildDirtyChunks();
+		bNeedsRebuild = false;
+	}
+
+	// Collision rebuilds on its own, slower cadence: a burst of edits
+	// costs one box re-merge, not one cook per edit
+	if (CollisionDirtyChunks.Num() > 0)
+	{
+		CollisionRebuildTimer -= DeltaTime;
+		if (CollisionRebuildTimer <= 0.0f)
+		{
+			CollisionRebuildTimer = CollisionRebuildInterval;
+			RebuildDirtyCollision();
+		}
+	}
+
+	// Periodic distance check for the LOD switcher; swapping LODs only
+	// toggles section visibility, never regenerates geometry
+	if (bEnableLOD)
+	{
+		LODCheckTimer -= DeltaTime;
+		if (LODCheckTimer <= 0.0f)
+		{
+			LODCheckTimer = 0.5f;
+			UpdateLODSelection();
+		}
+	}
+}
+
+FPackedVoxel UVoxelComponent::PackVoxel(const FVoxelBlock& Block)
+{
+	FPackedVoxel Packed;
+	const FVector Rounded = RoundPosition(Block.Position);
+	Packed.Coord = FIntVector(
+		FMath::RoundToInt(Rounded.X),
+		FMath::RoundToInt(Rounded.Y),
+		FMath::RoundToInt(Rounded.Z)
+	);
+	Packed.Material = Block.MaterialIndex;
+	Packed.Shape = static_cast<uint8>(Block.Shape);
+	Packed.Orientation = static_cast<uint8>(Block.Orientation);
+	Packed.Color = Block.Color;
+	return Packed;
+}
+
+void UVoxelComponent::AppendPackedBlock(const FVoxelBlock& Block)
+{
+	const FPackedVoxel Packed = PackVoxel(Block);
+	PackedCoords.Add(Packed.Coord);
+	PackedMaterials.Add(Packed.Material);
+	PackedShapes.Add(Packed.Shape);
+	PackedOrientations.Add(Packed.Orientation);
+	PackedColors.Add(Packed.Color);
+	PackedMasses.Add(Block.Mass);
+	PackedDestroyed.Add(Block.bIsDestroyed);
+}
+
+void UVoxelComponent::AddBlock(const FVoxelBlock& Block)
+{
+	const int32 Index = Blocks.Add(Block);
+	AppendPackedBlock(Block);
+	if (!Block.bIsDestroyed)
+	{
+		AccumulateBlockMass(Block, 1.0f);
+		GridCache.EnsureContains(PackedCoords[Index]);
+		GridCache.Set(PackedCoords[Index], Index);
+	}
+	BlockIdIndex.Add(Block.Id, Index);
+	Chunks.FindOrAdd(GetChunkCoord(Block.Position)).BlockIndices.Add(Index);
+	MarkBlockChunksDirty(Block);
+	MarkForRebuild();
+
+	if (IsEditAuthority())
+	{
+		RecordAddEdit(Block);
+	}
+}
+
+bool UVoxelComponent::RemoveBlock(const FGuid& BlockId)
+{
+	const int32* IndexPtr = BlockIdIndex.Find(BlockId);
+	if (!IndexPtr)
+	{
+		return false;
+	}
+
+	RemoveBlockAtIndex(*IndexPtr);
+	MarkForRebuild();
+	return true;
+}
+
+int32 UVoxelComponent::RemoveBlocks(const TArray<FGuid>& BlockIds)
+{
+	int32 NumRemoved = 0;
+	for (const FGuid& BlockId : BlockIds)
+	{
+		const int32* IndexPtr = BlockIdIndex.Find(BlockId);
+		if (IndexPtr)
+		{
+			RemoveBlockAtIndex(*IndexPtr);
+			++NumRemoved;
+		}
+	}
+
+	// One deferred rebuild for the whole batch
+	if (NumRemoved > 0)
+	{
+		MarkForRebuild();
+	}
+	return NumRemoved;
+}
+
+void UVoxelComponent::RemoveBlockAtIndex(int32 Index)
+{
+	if (IsEditAuthority())
+	{
+		RecordRemoveEdit(PackedCoords[Index]);
+	}
+
+	const FVoxelBlock Removed = Blocks[Index];
+	if (!Removed.bIsDestroyed)
+	{
+		AccumulateBlockMass(Removed, -1.0f);
+		if (bDetectSplits)
+		{
+			PendingSplitChecks.Add(PackedCoords[Index]);
+		}
+	}
+	if (GridCache.Get(PackedCoords[Index]) == Index)
+	{
+		GridCache.Set(PackedCoords[Index], INDEX_NONE);
+	}
+	const int32 LastIndex = Blocks.Num() - 1;
+	Blocks.RemoveAtSwap(Index);
+	PackedCoords.RemoveAtSwap(Index);
+	PackedMaterials.RemoveAtSwap(Index);
+	PackedShapes.RemoveAtSwap(Index);
+	PackedOrientations.RemoveAtSwap(Index);
+	PackedColors.RemoveAtSwap(Index);
+	PackedMasses.RemoveAtSwap(Index);
+	PackedDestroyed.RemoveAtSwap(Index);
+	BlockIdIndex.Remove(Removed.Id);
+
+	// Unregister the removed block from its chunk
+	if (FVoxelChunk* Chunk = Chunks.Find(GetChunkCoord(Removed.Position)))
+	{
+		Chunk->BlockIndices.RemoveSwap(Index);
+	}
+
+	// RemoveAtSwap moved the last block into the freed slot - fix up its bookkeeping
+	if (Index != LastIndex)
+	{
+		const FVoxelBlock& Moved = Blocks[Index];
+		BlockIdIndex[Moved.Id] = Index;
+		if (GridCache.Get(PackedCoords[Index]) == LastIndex)
+		{
+			GridCache.Set(PackedCoords[Index], Index);
+		}
+		if (FVoxelChunk* MovedChunk = Chunks.Find(GetChunkCoord(Moved.Position)))
+		{
+			const int32 Entry = MovedChunk->BlockIndices.Find(LastIndex);
+			if (Entry != INDEX_NONE)
+			{
+				MovedChunk->BlockIndices[Entry] = Index;
+			}
+		}
+	}
+
+	MarkBlockChunksDirty(Removed);
+}
+
+bool UVoxelComponent::GetBlock(const FGuid& BlockId, FVoxelBlock& OutBlock) const
+{
+	const int32* IndexPtr = BlockIdIndex.Find(BlockId);
+	if (IndexPtr)
+	{
+		OutBlock = Blocks[*IndexPtr];
+		return true;
+	}
+	return false;
+}
+
+void UVoxelComponent::ClearBlocks()
+{
+	Blocks.Empty();
+	Chunks.Empty();
+	BlockIdIndex.Empty();
+	PackedCoords.Empty();
+	PackedMaterials.Empty();
+	PackedShapes.Empty();
+	PackedOrientations.Empty();
+	PackedColors.Empty();
+	PackedMasses.Empty();
+	PackedDestroyed.Empty();
+	GridCache.Reset();
+	PendingSplitChecks.Empty();
+	ChunkCollisionBoxes.Empty();
+	CollisionDirtyChunks.Empty();
+	NextSectionIndex = 0;
+	CachedTotalMass = 0.0f;
+	MassWeightedSum = FVector::ZeroVector;
+	MassWeightedSquaredSum = 0.0f;
+	if (ProceduralMesh)
+	{
+		ProceduralMesh->ClearAllMeshSections();
+		ProceduralMesh->ClearCollisionConvexMeshes();
+	}
+	bNeedsRebuild = false;
+}
+
+bool UVoxelComponent::DamageBlock(const FGuid& BlockId, float Damage)
+{
+	const int32* IndexPtr = BlockIdIndex.Find(BlockId);
+	if (!IndexPtr)
+	{
+		return false;
+	}
+
+	FVoxelBlock& Block = Blocks[*IndexPtr];
+	if (Block.bIsDestroyed)
+	{
+		return false;
+	}
+
+	Block.TakeDamage(Damage);
+
+	// Replicate the damage amount, not the outcome: clients replay
+	// TakeDamage against the same baseline durability
+	if (IsEditAuthority())
+	{
+		RecordDamageEdit(PackedCoords[*IndexPtr], Damage);
+	}
+
+	if (!Block.bIsDestroyed)
+	{
+		return false;
+	}
+
+	// Destroyed flip: pull the block out of the aggregates, grid and mesh
+	AccumulateBlockMass(Block, -1.0f);
+	PackedDestroyed[*IndexPtr] = true;
+	if (GridCache.Get(PackedCoords[*IndexPtr]) == *IndexPtr)
+	{
+		GridCache.Set(PackedCoords[*IndexPtr], INDEX_NONE);
+	}
+	if (bDetectSplits)
+	{
+		PendingSplitChecks.Add(PackedCoords[*IndexPtr]);
+	}
+	MarkBlockChunksDirty(Block);
+	MarkForRebuild();
+	return true;
+}
+
+// ===== Edit replication =====
+
+bool UVoxelComponent::IsEditAuthority() const
+{
+	return bReplicateEdits && GetOwnerRole() == ROLE_Authority && GetNetMode() != NM_Standalone;
+}
+
+void UVoxelComponent::RecordAddEdit(const FVoxelBlock& Block)
+{
+	const FPackedVoxel Packed = PackVoxel(Block);
+	const FIntVector ChunkCoord = GetChunkCoord(Block.Position);
+	FPendingChunkEdits& Pending = PendingEditDeltas.FindOrAdd(ChunkCoord);
+	VoxelEditFormat::WriteAddRecord(Pending.Payload, ChunkCoord, ChunkSize, Packed.Coord,
+		Packed.Material, static_cast<uint8>(Block.BlockType), Packed.Shape, Packed.Orientation, Packed.Color);
+	++Pending.NumRecords;
+}
+
+void UVoxelComponent::RecordRemoveEdit(const FIntVector& Coord)
+{
+	const FIntVector ChunkCoord = GetChunkCoord(FVector(Coord));
+	FPendingChunkEdits& Pending = PendingEditDeltas.FindOrAdd(ChunkCoord);
+	Pending.Payload.Add(VoxelEditFormat::OpRemove);
+	VoxelEditFormat::WriteLocalCoord(Pending.Payload, Coord, ChunkCoord, ChunkSize);
+	++Pending.NumRecords;
+}
+
+void UVoxelComponent::RecordDamageEdit(const FIntVector& Coord, float Damage)
+{
+	const FIntVector ChunkCoord = GetChunkCoord(FVector(Coord));
+	FPendingChunkEdits& Pending = PendingEditDeltas.FindOrAdd(ChunkCoord);
+	Pending.Payload.Add(VoxelEditFormat::OpDamage);
+	VoxelEditFormat::WriteLocalCoord(Pending.Payload, Coord, ChunkCoord, ChunkSize);
+	VoxelEditFormat::WriteFloat(Pending.Payload, Damage);
+	++Pending.NumRecords;
+}
+
+void UVoxelComponent::FlushPendingEditDeltas()
+{
+	for (TPair<FIntVector, FPendingChunkEdits>& Pending : PendingEditDeltas)
+	{
+		FVoxelEditDelta Delta;
+		Delta.ChunkCoord = Pending.Key;
+		Delta.Sequence = ++EditSequence;
+		Delta.NumRecords = Pending.Value.NumRecords;
+		Delta.Payload = MoveTemp(Pending.Value.Payload);
+		MulticastEditDelta(Delta);
+	}
+	PendingEditDeltas.Empty();
+}
+
+void UVoxelComponent::ApplyEditRecords(const FIntVector& InChunkCoord, const uint8*& Cursor, const uint8* End, int32 NumRecords)
+{
+	for (int32 Record = 0; Record < NumRecords && Cursor < End; ++Record)
+	{
+		const uint8 Op = *Cursor++;
+		const FIntVector Coord = VoxelEditFormat::ReadLocalCoord(Cursor, InChunkCoord, ChunkSize);
+
+		switch (Op)
+		{
+		case VoxelEditFormat::OpAdd:
+		{
+			const uint8 Material = *Cursor++;
+			const uint8 BlockType = *Cursor++;
+			const uint8 Shape = *Cursor++;
+			const uint8 Orientation = *Cursor++;
+			const uint8 R = *Cursor++;
+			const uint8 G = *Cursor++;
+			const uint8 B = *Cursor++;
+
+			// Rebuild the block from the record; the client block gets its
+			// own Guid - ids never cross the wire, cells are the shared
+			// addressing scheme
+			FVoxelBlock Block;
+			Block.Position = FVector(Coord);
+			Block.Size = FVector::OneVector;
+			Block.MaterialType = UVoxelMaterialLibrary::GetMaterialDisplayName(static_cast<EMaterialTier>(Material));
+			Block.BlockType = static_cast<EBlockType>(BlockType);
+			Block.Shape = static_cast<EBlockShape>(Shape);
+			Block.Orientation = static_cast<EBlockOrientation>(Orientation);
+			Block.CalculateProperties();
+			Block.Color = FColor(R, G, B);
+			AddBlock(Block);
+			break;
+		}
+
+		case VoxelEditFormat::OpRemove:
+		{
+			const int32 Index = GridCache.Get(Coord);
+			if (Index != INDEX_NONE)
+			{
+				RemoveBlockAtIndex(Index);
+				MarkForRebuild();
+			}
+			break;
+		}
+
+		case VoxelEditFormat::OpDamage:
+		{
+			const float Damage = VoxelEditFormat::ReadFloat(Cursor);
+			const int32 Index = GridCache.Get(Coord);
+			if (Index != INDEX_NONE)
+			{
+				DamageBlock(Blocks[Index].Id, Damage);
+			}
+			break;
+		}
+
+		default:
+			// Unknown opcode: the stream is unreadable from here on
+			Cursor = End;
+			break;
+		}
+	}
+}
+
+void UVoxelComponent::MulticastEditDelta_Implementation(const FVoxelEditDelta& Delta)
+{
+	// The server applied the edit locally when it was recorded
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return;
+	}
+
+	// Everything before the incoming baseline is superseded by it
+	if (bAwaitingBaseline)
+	{
+		return;
+	}
+
+	// A sequence jump means we missed deltas (joined mid-session or the
+	// baseline raced the stream): applying onto stale state would diverge,
+	// so pull a fresh baseline instead
+	if (LastAppliedSequence == INDEX_NONE || Delta.Sequence != LastAppliedSequence + 1)
+	{
+		RequestBaseline();
+		return;
+	}
+
+	const uint8* Cursor = Delta.Payload.GetData();
+	ApplyEditRecords(Delta.ChunkCoord, Cursor, Cursor + Delta.Payload.Num(), Delta.NumRecords);
+	LastAppliedSequence = Delta.Sequence;
+}
+
+void UVoxelComponent::RequestBaseline()
+{
+	bAwaitingBaseline = true;
+	BaselineRetryTimer = BaselineRetryInterval;
+
+	// Relay through the local controller: a Server RPC needs a connection
+	// that owns the calling actor, and this client does not own ships it
+	// merely views - its controller is the one actor it always owns
+	ASubspacePlayerController* Controller = GetWorld()
+		? Cast<ASubspacePlayerController>(GetWorld()->GetFirstPlayerController()) : nullptr;
+	if (Controller)
+	{
+		Controller->ServerRequestVoxelBaseline(this);
+	}
+	// No controller yet (component BeginPlay ran first): the retry timer re-sends
+}
+
+FVoxelEditDelta UVoxelComponent::BuildBaseline()
+{
+	// Flush first so the baseline includes this frame's edits and the next
+	// delta follows it in sequence
+	if (PendingEditDeltas.Num() > 0)
+	{
+		FlushPendingEditDeltas();
+	}
+
+	// Bake every live block as an add record, grouped by chunk so the
+	// client applies (and meshes) chunk by chunk. Destroyed blocks are
+	// cosmetic absence and are not carried over.
+	FVoxelEditDelta Baseline;
+	Baseline.Sequence = EditSequence;
+	for (const TPair<FIntVector, FVoxelChunk>& ChunkPair : Chunks)
+	{
+		int32 NumLive = 0;
+		for (int32 BlockIndex : ChunkPair.Value.BlockIndices)
+		{
+			if (!PackedDestroyed[BlockIndex])
+			{
+				++NumLive;
+			}
+		}
+		if (NumLive == 0)
+		{
+			continue;
+		}
+
+		VoxelEditFormat::WriteInt32(Baseline.Payload, ChunkPair.Key.X);
+		VoxelEditFormat::WriteInt32(Baseline.Payload, ChunkPair.Key.Y);
+		VoxelEditFormat::WriteInt32(Baseline.Payload, ChunkPair.Key.Z);
+		VoxelEditFormat::WriteInt32(Baseline.Payload, NumLive);
+		for (int32 BlockIndex : ChunkPair.Value.BlockIndices)
+		{
+			if (!PackedDestroyed[BlockIndex])
+			{
+				VoxelEditFormat::WriteAddRecord(Baseline.Payload, ChunkPair.Key, ChunkSize,
+					PackedCoords[BlockIndex], PackedMaterials[BlockIndex],
+					static_cast<uint8>(Blocks[BlockIndex].BlockType),
+					PackedShapes[BlockIndex], PackedOrientations[BlockIndex], PackedColors[BlockIndex]);
+			}
+		}
+		Baseline.NumRecords += NumLive;
+	}
+
+	return Baseline;
+}
+
+void UVoxelComponent::ApplyBaseline(const FVoxelEditDelta& Baseline)
+{
+	if (GetOwnerRole() == ROLE_Authority)
+	{
+		return;
+	}
+
+	// Replace whatever we had; the stream resumes at the baseline sequence
+	ClearBlocks();
+
+	const uint8* Cursor = Baseline.Payload.GetData();
+	const uint8* End = Cursor + Baseline.Payload.Num();
+	while (Cursor + 4 * sizeof(int32) <= End)
+	{
+		FIntVector GroupChunk;
+		GroupChunk.X = VoxelEditFormat::ReadInt32(Cursor);
+		GroupChunk.Y = VoxelEditFormat::ReadInt32(Cursor);
+		GroupChunk.Z = VoxelEditFormat::ReadInt32(Cursor);
+		const int32 GroupRecords = VoxelEditFormat::ReadInt32(Cursor);
+		ApplyEditRecords(GroupChunk, Cursor, End, GroupRecords);
+	}
+
+	LastAppliedSequence = Baseline.Sequence;
+	bAwaitingBaseline = false;
+	MarkForRebuild();
+}
+
+void UVoxelComponent::ProcessPendingSplitChecks()
+{
+	static const FIntVector Neighbors[6] = {
+		FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+		FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+		FIntVector(0, 0, 1), FIntVector(0, 0, -1)
+	};
+
+	// Seed one search per live block adjacent to a removed cell. If the
+	// removals left at most one neighbor, nothing can have split.
+	TArray<int32> SeedBlocks;
+	for (const FIntVector& Cell : PendingSplitChecks)
+	{
+		for (const FIntVector& Offset : Neighbors)
+		{
+			const int32 NeighborIndex = GridCache.Get(Cell + Offset);
+			if (NeighborIndex != INDEX_NONE)
+			{
+				SeedBlocks.AddUnique(NeighborIndex);
+			}
+		}
+	}
+	PendingSplitChecks.Reset();
+	if (SeedBlocks.Num() < 2)
+	{
+		return;
+	}
+
+	// Union-find over the searches; searches merge when they reach a cell
+	// another search already claimed
+	TArray<int32> Parent;
+	Parent.SetNum(SeedBlocks.Num());
+	for (int32 Search = 0; Search < Parent.Num(); ++Search)
+	{
+		Parent[Search] = Search;
+	}
+	auto FindRoot = [&Parent](int32 Search)
+	{
+		while (Parent[Search] != Search)
+		{
+			Parent[Search] = Parent[Parent[Search]];
+			Search = Parent[Search];
+		}
+		return Search;
+	};
+
+	struct FSplitSearch
+	{
+		TArray<int32> Frontier;
+		TArray<int32> Visited;
+		bool bExhausted = false;
+	};
+
+	TArray<FSplitSearch> Searches;
+	Searches.SetNum(SeedBlocks.Num());
+	TMap<int32, int32> ClaimedBy; // block index -> search that reached it first
+	for (int32 Search = 0; Search < SeedBlocks.Num(); ++Search)
+	{
+		Searches[Search].Frontier.Add(SeedBlocks[Search]);
+		Searches[Search].Visited.Add(SeedBlocks[Search]);
+		ClaimedBy.Add(SeedBlocks[Search], Search);
+	}
+
+	// Expand all searches in lockstep, one cell each per round. Searches
+	// confined to a small fragment exhaust quickly; the search covering
+	// the main body stops as soon as it is the only root left expanding.
+	int32 ActiveRoot = INDEX_NONE;
+	for (;;)
+	{
+		TArray<int32> ActiveRoots;
+		for (int32 Search = 0; Search < Searches.Num(); ++Search)
+		{
+			if (!Searches[Search].bExhausted)
+			{
+				ActiveRoots.AddUnique(FindRoot(Search));
+			}
+		}
+
+		TArray<int32> AllRoots;
+		for (int32 Search = 0; Search < Searches.Num(); ++Search)
+		{
+			AllRoots.AddUnique(FindRoot(Search));
+		}
+		if (AllRoots.Num() == 1)
+		{
+			// Everything reconnected - no split
+			return;
+		}
+		if (ActiveRoots.Num() <= 1)
+		{
+			ActiveRoot = ActiveRoots.Num() == 1 ? ActiveRoots[0] : INDEX_NONE;
+			break;
+		}
+
+		for (int32 Search = 0; Search < Searches.Num(); ++Search)
+		{
+			FSplitSearch& State = Searches[Search];
+			if (State.bExhausted)
+			{
+				continue;
+			}
+			if (State.Frontier.Num() == 0)
+			{
+				State.bExhausted = true;
+				continue;
+			}
+
+			const int32 BlockIndex = State.Frontier.Pop();
+			for (const FIntVector& Offset : Neighbors)
+			{
+				const int32 NeighborIndex = GridCache.Get(PackedCoords[BlockIndex] + Offset);
+				if (NeighborIndex == INDEX_NONE)
+				{
+					continue;
+				}
+				if (const int32* Claimant = ClaimedBy.Find(NeighborIndex))
+				{
+					const int32 OtherRoot = FindRoot(*Claimant);
+					const int32 MyRoot = FindRoot(Search);
+					if (OtherRoot != MyRoot)
+					{
+						Parent[OtherRoot] = MyRoot;
+					}
+				}
+				else
+				{
+					ClaimedBy.Add(NeighborIndex, Search);
+					State.Frontier.Add(NeighborIndex);
+					State.Visited.Add(NeighborIndex);
+				}
+			}
+		}
+	}
+
+	// Gather the blocks each root reached. The main body is the root still
+	// expanding when we stopped; if everything exhausted (the structure was
+	// fully enumerated), keep the largest component.
+	TMap<int32, TArray<int32>> RootBlocks;
+	for (int32 Search = 0; Search < Searches.Num(); ++Search)
+	{
+		RootBlocks.FindOrAdd(FindRoot(Search)).Append(Searches[Search].Visited);
+	}
+	if (ActiveRoot == INDEX_NONE)
+	{
+		int32 LargestCount = -1;
+		for (const TPair<int32, TArray<int32>>& RootPair : RootBlocks)
+		{
+			if (RootPair.Value.Num() > LargestCount)
+			{
+				LargestCount = RootPair.Value.Num();
+				ActiveRoot = RootPair.Key;
+			}
+		}
+	}
+
+	for (const TPair<int32, TArray<int32>>& RootPair : RootBlocks)
+	{
+		if (RootPair.Key == ActiveRoot)
+		{
+			continue;
+		}
+		TArray<FGuid> FragmentIds;
+		FragmentIds.Reserve(RootPair.Value.Num());
+		for (int32 BlockIndex : RootPair.Value)
+		{
+			FragmentIds.Add(Blocks[BlockIndex].Id);
+		}
+		UE_LOG(LogTemp, Log, TEXT("VoxelComponent: Structure split - fragment of %d blocks disconnected"), FragmentIds.Num());
+		OnStructureSplit.Broadcast(FragmentIds);
+	}
+}
+
+bool UVoxelComponent::RaycastBlock(const FVector& Start, const FVector& End, FVoxelBlock& OutBlock) const
+{
+	const FVector Delta = End - Start;
+	const float Length = Delta.Size();
+
+	// Cells are centered on integer coordinates, so the cell containing a
+	// point is its rounded position and cell boundaries sit at +/- 0.5
+	FIntVector Cell(
+		FMath::RoundToInt(Start.X),
+		FMath::RoundToInt(Start.Y),
+		FMath::RoundToInt(Start.Z)
+	);
+
+	if (Length < KINDA_SMALL_NUMBER)
+	{
+		const int32 Index = GridCache.Get(Cell);
+		if (Index != INDEX_NONE)
+		{
+			OutBlock = Blocks[Index];
+			return true;
+		}
+		return false;
+	}
+
+	// Amanatides-Woo traversal: step one cell at a time along the axis
+	// whose boundary the ray crosses next
+	const FVector Dir = Delta / Length;
+	FIntVector Step = FIntVector::ZeroValue;
+	FVector TMax(FLT_MAX, FLT_MAX, FLT_MAX);
+	FVector TDelta(FLT_MAX, FLT_MAX, FLT_MAX);
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (FMath::Abs(Dir[Axis]) > KINDA_SMALL_NUMBER)
+		{
+			Step[Axis] = Dir[Axis] > 0.0f ? 1 : -1;
+			const float NextBoundary = Cell[Axis] + 0.5f * Step[Axis];
+			TMax[Axis] = (NextBoundary - Start[Axis]) / Dir[Axis];
+			TDelta[Axis] = 1.0f / FMath::Abs(Dir[Axis]);
+		}
+	}
+
+	float Travelled = 0.0f;
+	while (Travelled <= Length)
+	{
+		const int32 Index = GridCache.Get(Cell);
+		if (Index != INDEX_NONE)
+		{
+			OutBlock = Blocks[Index];
+			return true;
+		}
+
+		int32 NextAxis = 0;
+		if (TMax.Y < TMax[NextAxis])
+		{
+			NextAxis = 1;
+		}
+		if (TMax.Z < TMax[NextAxis])
+		{
+			NextAxis = 2;
+		}
+		Travelled = TMax[NextAxis];
+		Cell[NextAxis] += Step[NextAxis];
+		TMax[NextAxis] += TDelta[NextAxis];
+	}
+	return false;
+}
+
+TArray<FGuid> UVoxelComponent::QueryBlocksInSphere(const FVector& Center, float Radius) const
+{
+	TArray<FGuid> Result;
+	if (Radius <= 0.0f)
+	{
+		return Result;
+	}
+
+	// Walk the cells inside the sphere's bounding box; the grid lookup
+	// keeps this independent of the total block count
+	const FIntVector Min(
+		FMath::RoundToInt(Center.X - Radius),
+		FMath::RoundToInt(Center.Y - Radius),
+		FMath::RoundToInt(Center.Z - Radius)
+	);
+	const FIntVector Max(
+		FMath::RoundToInt(Center.X + Radius),
+		FMath::RoundToInt(Center.Y + Radius),
+		FMath::RoundToInt(Center.Z + Radius)
+	);
+	const float RadiusSquared = Radius * Radius;
+
+	for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+	{
+		for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+		{
+			for (int32 X = Min.X; X <= Max.X; ++X)
+			{
+				if (FVector::DistSquared(Center, FVector(X, Y, Z)) > RadiusSquared)
+				{
+					continue;
+				}
+				const int32 Index = GridCache.Get(FIntVector(X, Y, Z));
+				if (Index != INDEX_NONE)
+				{
+					Result.Add(Blocks[Index].Id);
+				}
+			}
+		}
+	}
+	return Result;
+}
+
+float UVoxelComponent::CalculateTotalMass() const
+{
+	// Maintained incrementally by AddBlock/RemoveBlock/DamageBlock
+	return CachedTotalMass;
+}
+
+FVector UVoxelComponent::GetCenterOfMass() const
+{
+	if (CachedTotalMass <= KINDA_SMALL_NUMBER)
+	{
+		return FVector::ZeroVector;
+	}
+	return MassWeightedSum / CachedTotalMass;
+}
+
+float UVoxelComponent::GetMomentOfInertia() const
+{
+	if (CachedTotalMass <= KINDA_SMALL_NUMBER)
+	{
+		return 0.0f;
+	}
+	const FVector CenterOfMass = MassWeightedSum / CachedTotalMass;
+	return FMath::Max(0.0f, MassWeightedSquaredSum - CachedTotalMass * CenterOfMass.SizeSquared());
+}
+
+void UVoxelComponent::AccumulateBlockMass(const FVoxelBlock& Block, float Sign)
+{
+	const float SignedMass = Block.Mass * Sign;
+	CachedTotalMass += SignedMass;
+	MassWeightedSum += SignedMass * Block.Position;
+	MassWeightedSquaredSum += SignedMass * Block.Position.SizeSquared();
+
+	// Guard against float drift taking the totals slightly negative
+	if (CachedTotalMass < 0.0f)
+	{
+		CachedTotalMass = 0.0f;
+	}
+}
+
+void UVoxelComponent::RecomputeMassAggregates()
+{
+	CachedTotalMass = 0.0f;
+	MassWeightedSum = FVector::ZeroVector;
+	MassWeightedSquaredSum = 0.0f;
+	for (const FVoxelBlock& Block : Blocks)
+	{
+		if (!Block.bIsDestroyed)
+		{
+			AccumulateBlockMass(Block, 1.0f);
+		}
+	}
+}
+
+void UVoxelComponent::RebuildMesh()
+{
+	SCOPE_CYCLE_COUNTER(STAT_SubspaceVoxelRebuild);
+	CSV_SCOPED_TIMING_STAT(Subspace, VoxelRebuild);
+
+	if (!ProceduralMesh)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("VoxelComponent: ProceduralMesh is null, cannot rebuild"));
+		return;
+	}
+
+	// Full rebuild: repartition all blocks and remesh every chunk
+	RebuildChunkMap();
+
+	if (Blocks.Num() == 0)
+	{
+		ProceduralMesh->ClearAllMeshSections();
+		return;
+	}
+
+	for (TPair<FIntVector, FVoxelChunk>& Pair : Chunks)
+	{
+		Pair.Value.bDirty = true;
+		++Pair.Value.Generation;
+	}
+	RebuildDirtyChunks();
+}
+
+FIntVector UVoxelComponent::GetChunkCoord(const FVector& Position) const
+{
+	const FVector Rounded = RoundPosition(Position);
+	return FIntVector(
+		FMath::FloorToInt(Rounded.X / ChunkSize),
+		FMath::FloorToInt(Rounded.Y / ChunkSize),
+		FMath::FloorToInt(Rounded.Z / ChunkSize)
+	);
+}
+
+void UVoxelComponent::RebuildChunkMap()
+{
+	Chunks.Empty();
+	BlockIdIndex.Empty();
+	NextSectionIndex = 0;
+	if (ProceduralMesh)
+	{
+		ProceduralMesh->ClearAllMeshSections();
+	}
+
+	BlockIdIndex.Reserve(Blocks.Num());
+	PackedCoords.Empty(Blocks.Num());
+	PackedMaterials.Empty(Blocks.Num());
+	PackedShapes.Empty(Blocks.Num());
+	PackedOrientations.Empty(Blocks.Num());
+	PackedColors.Empty(Blocks.Num());
+	PackedMasses.Empty(Blocks.Num());
+	PackedDestroyed.Empty(Blocks.Num());
+
+	for (int32 i = 0; i < Blocks.Num(); ++i)
+	{
+		Chunks.FindOrAdd(GetChunkCoord(Blocks[i].Position)).BlockIndices.Add(i);
+		BlockIdIndex.Add(Blocks[i].Id, i);
+		AppendPackedBlock(Blocks[i]);
+	}
+
+	GridCache.Reset();
+	for (int32 i = 0; i < Blocks.Num(); ++i)
+	{
+		if (!PackedDestroyed[i])
+		{
+			GridCache.EnsureContains(PackedCoords[i]);
+			GridCache.Set(PackedCoords[i], i);
+		}
+	}
+
+	// Every chunk's box compound is stale after a full rebuild
+	ChunkCollisionBoxes.Empty();
+	for (const TPair<FIntVector, FVoxelChunk>& ChunkPair : Chunks)
+	{
+		CollisionDirtyChunks.Add(ChunkPair.Key);
+	}
+
+	RecomputeMassAggregates();
+}
+
+void UVoxelComponent::MarkBlockChunksDirty(const FVoxelBlock& Block)
+{
+	const FIntVector ChunkCoord = GetChunkCoord(Block.Position);
+
+	auto MarkDirty = [this](const FIntVector& Coord)
+	{
+		if (FVoxelChunk* Chunk = Chunks.Find(Coord))
+		{
+			Chunk->bDirty = true;
+			++Chunk->Generation;
+		}
+	};
+
+	MarkDirty(ChunkCoord);
+
+	// Collision only depends on this chunk's own occupancy; neighbors
+	// keep their box compounds
+	CollisionDirtyChunks.Add(ChunkCoord);
+
+	// A block on a chunk boundary also changes which faces of the
+	// neighboring chunk are exposed, so that chunk must remesh too
+	const FVector Rounded = RoundPosition(Block.Position);
+	const FIntVector Local(
+		FMath::RoundToInt(Rounded.X) - ChunkCoord.X * ChunkSize,
+		FMath::RoundToInt(Rounded.Y) - ChunkCoord.Y * ChunkSize,
+		FMath::RoundToInt(Rounded.Z) - ChunkCoord.Z * ChunkSize
+	);
+
+	for (int32 Axis = 0; Axis < 3; ++Axis)
+	{
+		if (Local[Axis] == 0)
+		{
+			FIntVector Neighbor = ChunkCoord;
+			Neighbor[Axis] -= 1;
+			MarkDirty(Neighbor);
+		}
+		else if (Local[Axis] == ChunkSize - 1)
+		{
+			FIntVector Neighbor = ChunkCoord;
+			Neighbor[Axis] += 1;
+			MarkDirty(Neighbor);
+		}
+	}
+}
+
+void UVoxelComponent::RebuildDirtyCollision()
+{
+	// Re-merge only the chunks that changed
+	for (const FIntVector& ChunkCoord : CollisionDirtyChunks)
+	{
+		if (const FVoxelChunk* Chunk = Chunks.Find(ChunkCoord))
+		{
+			TArray<FBox>& Boxes = ChunkCollisionBoxes.FindOrAdd(ChunkCoord);
+			Boxes.Reset();
+			BuildChunkCollisionBoxes(*Chunk, ChunkCoord, Boxes);
+			if (Boxes.Num() == 0)
+			{
+				ChunkCollisionBoxes.Remove(ChunkCoord);
+			}
+		}
+		else
+		{
+			ChunkCollisionBoxes.Remove(ChunkCoord);
+		}
+	}
+	CollisionDirtyChunks.Empty();
+
+	if (!ProceduralMesh)
+	{
+		return;
+	}
+
+	// Push the whole compound: the convex-set API replaces, not patches,
+	// but a box is the cheapest hull there is and the count is tiny next
+	// to the render triangle counts we used to cook. Async cooking still
+	// applies, so the cook itself stays off the game thread.
+	TArray<TArray<FVector>> ConvexMeshes;
+	for (const TPair<FIntVector, TArray<FBox>>& ChunkBoxes : ChunkCollisionBoxes)
+	{
+		for (const FBox& Box : ChunkBoxes.Value)
+		{
+			TArray<FVector>& Corners = ConvexMeshes.AddDefaulted_GetRef();
+			Corners.Reserve(8);
+			for (int32 Corner = 0; Corner < 8; ++Corner)
+			{
+				Corners.Add(FVector(
+					(Corner & 1) ? Box.Max.X : Box.Min.X,
+					(Corner & 2) ? Box.Max.Y : Box.Min.Y,
+					(Corner & 4) ? Box.Max.Z : Box.Min.Z));
+			}
+		}
+	}
+	ProceduralMesh->SetCollisionConvexMeshes(ConvexMeshes);
+}
+
+void UVoxelComponent::BuildChunkCollisionBoxes(const FVoxelChunk& Chunk, const FIntVector& ChunkCoord, TArray<FBox>& OutBoxes) const
+{
+	// Local occupancy of live blocks; destroyed blocks are holes
+	const int32 CellCount = ChunkSize * ChunkSize * ChunkSize;
+	TArray<bool> Solid;
+	Solid.Init(false, CellCount);
+	const FIntVector ChunkBase = ChunkCoord * ChunkSize;
+	auto CellIndex = [this](int32 X, int32 Y, int32 Z)
+	{
+		return X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
+	};
+
+	int32 NumSolid = 0;
+	for (int32 BlockIndex : Chunk.BlockIndices)
+	{
+		if (!PackedDestroyed[BlockIndex])
+		{
+			const FIntVector Local = PackedCoords[BlockIndex] - ChunkBase;
+			Solid[CellIndex(Local.X, Local.Y, Local.Z)] = true;
+			++NumSolid;
+		}
+	}
+	if (NumSolid == 0)
+	{
+		return;
+	}
+
+	// Greedy box merge: grow a run along X, widen it along Y, deepen it
+	// along Z. Solid interiors collapse into a handful of boxes; surface
+	// detail that only matters visually never reaches physics.
+	TArray<bool> Visited;
+	Visited.Init(false, CellCount);
+	for (int32 Z = 0; Z < ChunkSize; ++Z)
+	{
+		for (int32 Y = 0; Y < ChunkSize; ++Y)
+		{
+			for (int32 X = 0; X < ChunkSize; ++X)
+			{
+				if (!Solid[CellIndex(X, Y, Z)] || Visited[CellIndex(X, Y, Z)])
+				{
+					continue;
+				}
+
+				int32 SizeX = 1;
+				while (X + SizeX < ChunkSize &&
+				       Solid[CellIndex(X + SizeX, Y, Z)] && !Visited[CellIndex(X + SizeX, Y, Z)])
+				{
+					++SizeX;
+				}
 
-UVoxelComponent::UVoxelComponent()
-{
-	PrimaryComponentTick.bCanEverTick = true;
-	bUseGreedyMeshing = false;
-	bNeedsRebuild = false;
+				int32 SizeY = 1;
+				for (bool bGrow = true; bGrow && Y + SizeY < ChunkSize; )
+				{
+					for (int32 DX = 0; DX < SizeX; ++DX)
+					{
+						if (!Solid[CellIndex(X + DX, Y + SizeY, Z)] || Visited[CellIndex(X + DX, Y + SizeY, Z)])
+						{
+							bGrow = false;
+							break;
+						}
+					}
+					if (bGrow)
+					{
+						++SizeY;
+					}
+				}
+
+				int32 SizeZ = 1;
+				for (bool bGrow = true; bGrow && Z + SizeZ < ChunkSize; )
+				{
+					for (int32 DY = 0; DY < SizeY && bGrow; ++DY)
+					{
+						for (int32 DX = 0; DX < SizeX; ++DX)
+						{
+							if (!Solid[CellIndex(X + DX, Y + DY, Z + SizeZ)] || Visited[CellIndex(X + DX, Y + DY, Z + SizeZ)])
+							{
+								bGrow = false;
+								break;
+							}
+						}
+					}
+					if (bGrow)
+					{
+						++SizeZ;
+					}
+				}
+
+				for (int32 DZ = 0; DZ < SizeZ; ++DZ)
+				{
+					for (int32 DY = 0; DY < SizeY; ++DY)
+					{
+						for (int32 DX = 0; DX < SizeX; ++DX)
+						{
+							Visited[CellIndex(X + DX, Y + DY, Z + DZ)] = true;
+						}
+					}
+				}
+
+				// Cells are unit cubes centered on their integer coords
+				const FVector Min = FVector(ChunkBase + FIntVector(X, Y, Z)) - FVector(0.5f);
+				OutBoxes.Emplace(Min, Min + FVector(SizeX, SizeY, SizeZ));
+			}
+		}
+	}
 }
 
-void UVoxelComponent::BeginPlay()
+void UVoxelComponent::RebuildDirtyChunks()
 {
-	Super::BeginPlay();
+	for (TPair<FIntVector, FVoxelChunk>& Pair : Chunks)
+	{
+		if (Pair.Value.bDirty)
+		{
+			RebuildChunk(Pair.Key, Pair.Value);
+			Pair.Value.bDirty = false;
+		}
+	}
+}
 
-	// Create procedural mesh component if not already created
+void UVoxelComponent::RebuildChunk(const FIntVector& ChunkCoord, FVoxelChunk& Chunk)
+{
 	if (!ProceduralMesh)
 	{
-		ProceduralMesh = NewObject<UProceduralMeshComponent>(GetOwner(), TEXT("VoxelProceduralMesh"));
-		ProceduralMesh->RegisterComponent();
-		ProceduralMesh->AttachToComponent(GetOwner()->GetRootComponent(), FAttachmentTransformRules::KeepRelativeTransform);
-		ProceduralMesh->bUseAsyncCooking = true; // Enable async collision cooking for performance
+		return;
 	}
 
-	// Initial mesh generation if we have blocks
-	if (Blocks.Num() > 0)
+	if (Chunk.SectionIndex == INDEX_NONE)
 	{
-		RebuildMesh();
+		// Each chunk owns one section per LOD level
+		Chunk.SectionIndex = NextSectionIndex;
+		NextSectionIndex += NumLODLevels;
 	}
-}
 
-void UVoxelComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
-{
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	TArray<FPackedVoxel> OwnedBlocks;
+	TArray<FPackedVoxel> BorderBlocks;
+	GatherChunkSnapshot(ChunkCoord, Chunk, OwnedBlocks, BorderBlocks);
 
-	// Rebuild mesh if needed
-	if (bNeedsRebuild)
+	if (OwnedBlocks.Num() == 0)
 	{
-		RebuildMesh();
-		bNeedsRebuild = false;
+		for (int32 LOD = 0; LOD < NumLODLevels; ++LOD)
+		{
+			ProceduralMesh->ClearMeshSection(Chunk.SectionIndex + LOD);
+		}
+		return;
 	}
-}
 
-void UVoxelComponent::AddBlock(const FVoxelBlock& Block)
-{
-	Blocks.Add(Block);
-	MarkForRebuild();
-}
+	const int32 Generation = Chunk.Generation;
+	const bool bGreedy = bUseGreedyMeshing;
+	const int32 NumLODs = bEnableLOD ? NumLODLevels : 1;
 
-bool UVoxelComponent::RemoveBlock(const FGuid& BlockId)
-{
-	for (int32 i = 0; i < Blocks.Num(); ++i)
+	// Builds LOD0 at full detail plus progressively merged distance LODs;
+	// runs on the worker task (or inline for the synchronous path)
+	auto BuildAllLODs = [bGreedy, NumLODs, ChunkCoord, Generation](
+		const TArray<FPackedVoxel>& Owned, const TArray<FPackedVoxel>& Border, TArray<FVoxelMeshBuildResult>& OutResults)
 	{
-		if (Blocks[i].Id == BlockId)
+		for (int32 LOD = 0; LOD < NumLODs; ++LOD)
 		{
-			Blocks.RemoveAt(i);
-			MarkForRebuild();
-			return true;
+			FVoxelMeshBuildResult& Result = OutResults.AddDefaulted_GetRef();
+			Result.ChunkCoord = ChunkCoord;
+			Result.Generation = Generation;
+			Result.LODLevel = LOD;
+
+			if (LOD == 0)
+			{
+				if (bGreedy)
+				{
+					BuildGreedyMesh(Owned, Border, Result);
+				}
+				else
+				{
+					BuildSimpleMesh(Owned, Border, Result);
+				}
+			}
+			else
+			{
+				// Coarse LODs merge 2^LOD voxels per axis and always use
+				// the greedy mesher; vertices are scaled back up to keep
+				// the silhouette at world size
+				const int32 Factor = 1 << LOD;
+				const TArray<FPackedVoxel> LODOwned = DownsampleVoxels(Owned, Factor);
+				const TArray<FPackedVoxel> LODBorder = DownsampleVoxels(Border, Factor);
+				BuildGreedyMesh(LODOwned, LODBorder, Result);
+				for (FVector& Vertex : Result.Vertices)
+				{
+					Vertex *= Factor;
+				}
+			}
+		}
+	};
+
+	if (bAsyncMeshing && FApp::ShouldUseThreadingForPerformance())
+	{
+		// The task only touches its own snapshot; the game thread is free
+		// to keep editing blocks while meshing runs.
+		TWeakObjectPtr<UVoxelComponent> WeakThis(this);
+		Async(EAsyncExecution::ThreadPool,
+			[WeakThis, BuildAllLODs,
+			 OwnedBlocks = MoveTemp(OwnedBlocks), BorderBlocks = MoveTemp(BorderBlocks)]()
+		{
+			TSharedRef<TArray<FVoxelMeshBuildResult>> Results = MakeShared<TArray<FVoxelMeshBuildResult>>();
+			BuildAllLODs(OwnedBlocks, BorderBlocks, *Results);
+
+			// Hand the finished buffers back to the game thread for the section swap
+			AsyncTask(ENamedThreads::GameThread, [WeakThis, Results]()
+			{
+				if (UVoxelComponent* Component = WeakThis.Get())
+				{
+					for (const FVoxelMeshBuildResult& Result : *Results)
+					{
+						Component->ApplyMeshBuildResult(Result);
+					}
+				}
+			});
+		});
+	}
+	else
+	{
+		TArray<FVoxelMeshBuildResult> Results;
+		BuildAllLODs(OwnedBlocks, BorderBlocks, Results);
+		for (const FVoxelMeshBuildResult& Result : Results)
+		{
+			ApplyMeshBuildResult(Result);
 		}
 	}
-	return false;
 }
 
-bool UVoxelComponent::GetBlock(const FGuid& BlockId, FVoxelBlock& OutBlock) const
+void UVoxelComponent::GatherChunkSnapshot(const FIntVector& ChunkCoord, const FVoxelChunk& Chunk,
+                                          TArray<FPackedVoxel>& OutOwnedVoxels, TArray<FPackedVoxel>& OutBorderVoxels) const
 {
-	for (const FVoxelBlock& Block : Blocks)
+	auto MakePacked = [this](int32 Index)
+	{
+		FPackedVoxel Packed;
+		Packed.Coord = PackedCoords[Index];
+		Packed.Material = PackedMaterials[Index];
+		Packed.Shape = PackedShapes[Index];
+		Packed.Orientation = PackedOrientations[Index];
+		Packed.Color = PackedColors[Index];
+		return Packed;
+	};
+
+	OutOwnedVoxels.Reserve(Chunk.BlockIndices.Num());
+	for (int32 Index : Chunk.BlockIndices)
 	{
-		if (Block.Id == BlockId)
+		if (!PackedDestroyed[Index])
 		{
-			OutBlock = Block;
-			return true;
+			OutOwnedVoxels.Add(MakePacked(Index));
 		}
 	}
-	return false;
-}
 
-void UVoxelComponent::ClearBlocks()
-{
-	Blocks.Empty();
-	if (ProceduralMesh)
+	// Voxels in the one-voxel border of face-adjacent chunks are needed
+	// so boundary faces against them are culled correctly. The persistent
+	// grid cache answers border occupancy directly instead of scanning
+	// the neighboring chunks' block lists.
+	const FIntVector ChunkMin = ChunkCoord * ChunkSize;
+
+	auto AddBorderCell = [this, &MakePacked, &OutBorderVoxels](const FIntVector& Coord)
 	{
-		ProceduralMesh->ClearAllMeshSections();
+		const int32 Index = GridCache.Get(Coord);
+		if (Index != INDEX_NONE)
+		{
+			OutBorderVoxels.Add(MakePacked(Index));
+		}
+	};
+
+	for (int32 U = 0; U < ChunkSize; ++U)
+	{
+		for (int32 V = 0; V < ChunkSize; ++V)
+		{
+			AddBorderCell(ChunkMin + FIntVector(-1, U, V));
+			AddBorderCell(ChunkMin + FIntVector(ChunkSize, U, V));
+			AddBorderCell(ChunkMin + FIntVector(U, -1, V));
+			AddBorderCell(ChunkMin + FIntVector(U, ChunkSize, V));
+			AddBorderCell(ChunkMin + FIntVector(U, V, -1));
+			AddBorderCell(ChunkMin + FIntVector(U, V, ChunkSize));
+		}
 	}
-	MarkForRebuild();
 }
 
-float UVoxelComponent::CalculateTotalMass() const
+void UVoxelComponent::ApplyMeshBuildResult(const FVoxelMeshBuildResult& Result)
 {
-	float TotalMass = 0.0f;
-	for (const FVoxelBlock& Block : Blocks)
+	// Discard results from chunk rebuilds that were superseded by newer edits
+	const FVoxelChunk* Chunk = Chunks.Find(Result.ChunkCoord);
+	if (!Chunk || Chunk->Generation != Result.Generation)
 	{
-		if (!Block.bIsDestroyed)
-		{
-			TotalMass += Block.Mass;
-		}
+		UE_LOG(LogTemp, Verbose, TEXT("VoxelComponent: Discarding stale mesh build for chunk (%d, %d, %d)"),
+			Result.ChunkCoord.X, Result.ChunkCoord.Y, Result.ChunkCoord.Z);
+		return;
+	}
+
+	if (!ProceduralMesh || Chunk->SectionIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	const int32 Section = Chunk->SectionIndex + Result.LODLevel;
+
+	if (Result.Vertices.Num() > 0)
+	{
+		TArray<FVector2D> UV0; // Empty UV for now
+		TArray<FProcMeshTangent> Tangents; // Empty tangents for now
+
+		// Render sections never cook collision; physics uses the box
+		// compound maintained by RebuildDirtyCollision
+		ProceduralMesh->CreateMeshSection(Section, Result.Vertices, Result.Triangles, Result.Normals, UV0, Result.VertexColors, Tangents, /*bCreateCollision*/ false);
+		ProceduralMesh->SetMeshSectionVisible(Section, !bEnableLOD ? Result.LODLevel == 0 : Result.LODLevel == CurrentLOD);
+	}
+	else
+	{
+		ProceduralMesh->ClearMeshSection(Section);
 	}
-	return TotalMass;
 }
 
-void UVoxelComponent::RebuildMesh()
+void UVoxelComponent::UpdateLODSelection()
 {
 	if (!ProceduralMesh)
 	{
-		UE_LOG(LogTemp, Warning, TEXT("VoxelComponent: ProceduralMesh is null, cannot rebuild"));
 		return;
 	}
 
-	if (Blocks.Num() == 0)
+	const AActor* Owner = GetOwner();
+	UWorld* World = GetWorld();
+	APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+	if (!Owner || !PlayerController || !PlayerController->PlayerCameraManager)
 	{
-		ProceduralMesh->ClearAllMeshSections();
 		return;
 	}
 
-	if (bUseGreedyMeshing)
+	const float Distance = FVector::Dist(
+		PlayerController->PlayerCameraManager->GetCameraLocation(), Owner->GetActorLocation());
+
+	int32 DesiredLOD = 0;
+	for (int32 i = 0; i < LODDistances.Num() && i < NumLODLevels - 1; ++i)
 	{
-		GenerateGreedyMesh();
+		if (Distance > LODDistances[i])
+		{
+			DesiredLOD = i + 1;
+		}
 	}
-	else
+
+	if (DesiredLOD == CurrentLOD)
+	{
+		return;
+	}
+	CurrentLOD = DesiredLOD;
+
+	// Swap section visibility only - no geometry is regenerated
+	for (const TPair<FIntVector, FVoxelChunk>& Pair : Chunks)
 	{
-		GenerateSimpleMesh();
+		if (Pair.Value.SectionIndex == INDEX_NONE)
+		{
+			continue;
+		}
+		for (int32 LOD = 0; LOD < NumLODLevels; ++LOD)
+		{
+			ProceduralMesh->SetMeshSectionVisible(Pair.Value.SectionIndex + LOD, LOD == CurrentLOD);
+		}
 	}
 }
 
-void UVoxelComponent::GenerateSimpleMesh()
+TArray<FPackedVoxel> UVoxelComponent::DownsampleVoxels(const TArray<FPackedVoxel>& InVoxels, int32 Factor)
 {
-	TArray<FVector> Vertices;
-	TArray<int32> Triangles;
-	TArray<FVector> Normals;
-	TArray<FColor> VertexColors;
+	// Count material/color occurrences per coarse cell and keep the dominant one
+	struct FCellVote
+	{
+		FPackedVoxel Voxel;
+		int32 Count = 0;
+	};
+	TMap<FIntVector, TMap<uint64, FCellVote>> Cells;
 
-	// Build spatial lookup for neighbor checking
-	TMap<FVector, int32> BlockLookup = BuildBlockLookup();
+	for (const FPackedVoxel& Voxel : InVoxels)
+	{
+		const FIntVector Cell(
+			FMath::FloorToInt(static_cast<float>(Voxel.Coord.X) / Factor),
+			FMath::FloorToInt(static_cast<float>(Voxel.Coord.Y) / Factor),
+			FMath::FloorToInt(static_cast<float>(Voxel.Coord.Z) / Factor)
+		);
+		const uint64 VoteKey = (static_cast<uint64>(Voxel.Material) << 32) | Voxel.Color.DWColor();
 
-	// Generate faces for each block
-	for (const FVoxelBlock& Block : Blocks)
+		FCellVote& Vote = Cells.FindOrAdd(Cell).FindOrAdd(VoteKey);
+		Vote.Voxel.Coord = Cell;
+		Vote.Voxel.Material = Voxel.Material;
+		Vote.Voxel.Color = Voxel.Color;
+		++Vote.Count;
+	}
+
+	TArray<FPackedVoxel> OutVoxels;
+	OutVoxels.Reserve(Cells.Num());
+	for (const TPair<FIntVector, TMap<uint64, FCellVote>>& CellPair : Cells)
 	{
-		if (!Block.bIsDestroyed)
+		const FCellVote* Best = nullptr;
+		for (const TPair<uint64, FCellVote>& VotePair : CellPair.Value)
+		{
+			if (!Best || VotePair.Value.Count > Best->Count)
+			{
+				Best = &VotePair.Value;
+			}
+		}
+		if (Best)
 		{
-			GenerateBlockFaces(Block, BlockLookup, Vertices, Triangles, Normals, VertexColors);
+			OutVoxels.Add(Best->Voxel);
 		}
 	}
+	return OutVoxels;
+}
 
-	// Create mesh section
-	if (Vertices.Num() > 0)
+void UVoxelComponent::BuildSimpleMesh(const TArray<FPackedVoxel>& InVoxels, const TArray<FPackedVoxel>& InBorderVoxels, FVoxelMeshBuildResult& OutResult)
+{
+	// Build occupancy lookup for neighbor checking; border voxels take
+	// part in culling but are never meshed themselves. Only full cubes
+	// occlude - a neighbor behind a wedge is still partially visible.
+	FScopedMeshBuildScratch ScratchScope;
+	TSet<FIntVector>& OccupiedCells = ScratchScope.Get().OccupiedCells;
+	OccupiedCells.Reserve(InVoxels.Num() + InBorderVoxels.Num());
+	for (const FPackedVoxel& Voxel : InVoxels)
 	{
-		TArray<FVector2D> UV0; // Empty UV for now
-		TArray<FProcMeshTangent> Tangents; // Empty tangents for now
-		
-		ProceduralMesh->ClearAllMeshSections();
-		ProceduralMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UV0, VertexColors, Tangents, true);
+		if (VoxelShape::IsFullCube(Voxel.Shape))
+		{
+			OccupiedCells.Add(Voxel.Coord);
+		}
+	}
+	for (const FPackedVoxel& Voxel : InBorderVoxels)
+	{
+		if (VoxelShape::IsFullCube(Voxel.Shape))
+		{
+			OccupiedCells.Add(Voxel.Coord);
+		}
+	}
+
+	// Generate faces for each voxel; shaped blocks emit their baked
+	// geometry from the shape tables instead of cube faces
+	for (const FPackedVoxel& Voxel : InVoxels)
+	{
+		if (VoxelShape::IsFullCube(Voxel.Shape))
+		{
+			GenerateVoxelFaces(Voxel, OccupiedCells, OutResult.Vertices, OutResult.Triangles, OutResult.Normals, OutResult.VertexColors);
+		}
+		else
+		{
+			AppendShapedVoxel(Voxel, OutResult.Vertices, OutResult.Triangles, OutResult.Normals, OutResult.VertexColors);
+		}
 	}
 }
 
-void UVoxelComponent::GenerateGreedyMesh()
+void UVoxelComponent::BuildGreedyMesh(const TArray<FPackedVoxel>& InVoxels, const TArray<FPackedVoxel>& InBorderVoxels, FVoxelMeshBuildResult& OutResult)
 {
-	if (Blocks.Num() == 0)
+	if (InVoxels.Num() == 0)
 	{
-		ProceduralMesh->ClearAllMeshSections();
 		return;
 	}
 
-	TArray<FVector> Vertices;
-	TArray<int32> Triangles;
-	TArray<FVector> Normals;
-	TArray<FColor> VertexColors;
+	// Shaped blocks never quad-merge and never occlude their neighbors;
+	// route them through the shape tables and rerun the greedy passes on
+	// the full cubes only. The all-cube case (the common one) pays just
+	// this scan.
+	auto HasShaped = [](const TArray<FPackedVoxel>& VoxelArray)
+	{
+		for (const FPackedVoxel& Voxel : VoxelArray)
+		{
+			if (!VoxelShape::IsFullCube(Voxel.Shape))
+			{
+				return true;
+			}
+		}
+		return false;
+	};
+
+	// Working buffers come from the scratch pool; the recursive calls
+	// below check out their own scratch
+	FScopedMeshBuildScratch ScratchScope;
+	FMeshBuildScratch& Scratch = ScratchScope.Get();
 
-	// Build a 3D voxel grid for greedy meshing
-	// Find bounds
-	FVector Min(MAX_flt);
-	FVector Max(-MAX_flt);
-	
-	for (const FVoxelBlock& Block : Blocks)
+	if (HasShaped(InVoxels) || HasShaped(InBorderVoxels))
 	{
-		if (!Block.bIsDestroyed)
+		TArray<FPackedVoxel>& CubeVoxels = Scratch.CubeVoxels;
+		TArray<FPackedVoxel>& CubeBorder = Scratch.CubeBorder;
+		CubeVoxels.Reserve(InVoxels.Num());
+		CubeBorder.Reserve(InBorderVoxels.Num());
+
+		for (const FPackedVoxel& Voxel : InVoxels)
+		{
+			if (VoxelShape::IsFullCube(Voxel.Shape))
+			{
+				CubeVoxels.Add(Voxel);
+			}
+			else
+			{
+				AppendShapedVoxel(Voxel, OutResult.Vertices, OutResult.Triangles, OutResult.Normals, OutResult.VertexColors);
+			}
+		}
+		for (const FPackedVoxel& Voxel : InBorderVoxels)
 		{
-			FVector HalfSize = Block.Size * 0.5f;
-			Min = FVector::Min(Min, Block.Position - HalfSize);
-			Max = FVector::Max(Max, Block.Position + HalfSize);
+			if (VoxelShape::IsFullCube(Voxel.Shape))
+			{
+				CubeBorder.Add(Voxel);
+			}
 		}
+
+		BuildGreedyMesh(CubeVoxels, CubeBorder, OutResult);
+		return;
 	}
 
-	// Convert to integer grid coordinates
-	FIntVector GridMin(
-		FMath::FloorToInt(Min.X),
-		FMath::FloorToInt(Min.Y),
-		FMath::FloorToInt(Min.Z)
-	);
-	FIntVector GridMax(
-		FMath::CeilToInt(Max.X),
-		FMath::CeilToInt(Max.Y),
-		FMath::CeilToInt(Max.Z)
-	);
+	// Build a 3D voxel grid for greedy meshing
+	// Find bounds (border voxels included so neighbor checks can see them)
+	FIntVector GridMin(MAX_int32);
+	FIntVector GridMax(MIN_int32);
+
+	auto ExtendBounds = [&GridMin, &GridMax](const TArray<FPackedVoxel>& VoxelArray)
+	{
+		for (const FPackedVoxel& Voxel : VoxelArray)
+		{
+			GridMin.X = FMath::Min(GridMin.X, Voxel.Coord.X);
+			GridMin.Y = FMath::Min(GridMin.Y, Voxel.Coord.Y);
+			GridMin.Z = FMath::Min(GridMin.Z, Voxel.Coord.Z);
+			GridMax.X = FMath::Max(GridMax.X, Voxel.Coord.X);
+			GridMax.Y = FMath::Max(GridMax.Y, Voxel.Coord.Y);
+			GridMax.Z = FMath::Max(GridMax.Z, Voxel.Coord.Z);
+		}
+	};
+	ExtendBounds(InVoxels);
+	ExtendBounds(InBorderVoxels);
 
 	FIntVector GridSize = GridMax - GridMin + FIntVector(1);
 
@@ -198,63 +1884,81 @@ void UVoxelComponent::GenerateGreedyMesh()
 	if (GridSize.X > 1000 || GridSize.Y > 1000 || GridSize.Z > 1000)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("VoxelComponent: Grid too large for greedy meshing, using simple mesh"));
-		GenerateSimpleMesh();
+		BuildSimpleMesh(InVoxels, InBorderVoxels, OutResult);
 		return;
 	}
 
-	// Create 3D array for voxel grid
-	TArray<const FVoxelBlock*> VoxelGrid;
+	// Create 3D array for voxel grid (pooled; SetNumZeroed keeps the
+	// allocation from the previous build)
+	TArray<const FPackedVoxel*>& VoxelGrid = Scratch.VoxelGrid;
 	int32 TotalSize = GridSize.X * GridSize.Y * GridSize.Z;
-	VoxelGrid.Init(nullptr, TotalSize);
+	VoxelGrid.SetNumZeroed(TotalSize, EAllowShrinking::No);
 
-	// Fill grid with block pointers
-	for (const FVoxelBlock& Block : Blocks)
+	// Fill grid with voxel pointers; track which ones this build owns
+	// (border voxels only cull faces, they are meshed by their own chunk)
+	TSet<const FPackedVoxel*>& OwnedVoxels = Scratch.OwnedVoxels;
+
+	auto FillGrid = [&VoxelGrid, &GridMin, &GridSize](const TArray<FPackedVoxel>& VoxelArray)
 	{
-		if (!Block.bIsDestroyed)
+		for (const FPackedVoxel& Voxel : VoxelArray)
 		{
-			FIntVector GridPos(
-				FMath::RoundToInt(Block.Position.X) - GridMin.X,
-				FMath::RoundToInt(Block.Position.Y) - GridMin.Y,
-				FMath::RoundToInt(Block.Position.Z) - GridMin.Z
-			);
+			FIntVector GridPos = Voxel.Coord - GridMin;
 
 			if (GridPos.X >= 0 && GridPos.X < GridSize.X &&
 				GridPos.Y >= 0 && GridPos.Y < GridSize.Y &&
 				GridPos.Z >= 0 && GridPos.Z < GridSize.Z)
 			{
 				int32 Index = GridPos.X + GridPos.Y * GridSize.X + GridPos.Z * GridSize.X * GridSize.Y;
-				VoxelGrid[Index] = &Block;
+				VoxelGrid[Index] = &Voxel;
 			}
 		}
+	};
+	// Border first so owned voxels win when a downsampled cell collides
+	FillGrid(InBorderVoxels);
+	FillGrid(InVoxels);
+
+	OwnedVoxels.Reserve(InVoxels.Num());
+	for (const FPackedVoxel& Voxel : InVoxels)
+	{
+		OwnedVoxels.Add(&Voxel);
 	}
 
-	// Process each axis (X=0, Y=1, Z=2) and both directions
-	for (int32 Axis = 0; Axis < 3; ++Axis)
+	// Process each axis (X=0, Y=1, Z=2) and both directions. The six
+	// passes only read the shared grid and append to their own pooled
+	// buffers, so they run in parallel and are concatenated with index
+	// rebasing.
+	ParallelFor(6, [&VoxelGrid, &GridSize, &GridMin, &OwnedVoxels, &Scratch](int32 PassIndex)
+	{
+		const int32 Axis = PassIndex / 2;
+		const int32 Direction = (PassIndex % 2 == 0) ? -1 : 1;
+		FMeshBuildScratch::FAxisPassBuffers& Pass = Scratch.PassOutputs[PassIndex];
+		GreedyMeshAxis(VoxelGrid, GridSize, GridMin, OwnedVoxels, Axis, Direction,
+			Pass.Vertices, Pass.Triangles, Pass.Normals, Pass.VertexColors);
+	});
+
+	for (int32 PassIndex = 0; PassIndex < 6; ++PassIndex)
 	{
-		for (int32 Direction = -1; Direction <= 1; Direction += 2)
+		const FMeshBuildScratch::FAxisPassBuffers& Pass = Scratch.PassOutputs[PassIndex];
+		const int32 BaseIndex = OutResult.Vertices.Num();
+		OutResult.Vertices.Append(Pass.Vertices);
+		OutResult.Normals.Append(Pass.Normals);
+		OutResult.VertexColors.Append(Pass.VertexColors);
+		OutResult.Triangles.Reserve(OutResult.Triangles.Num() + Pass.Triangles.Num());
+		for (int32 TriangleIndex : Pass.Triangles)
 		{
-			GreedyMeshAxis(VoxelGrid, GridSize, GridMin, Axis, Direction, Vertices, Triangles, Normals, VertexColors);
+			OutResult.Triangles.Add(TriangleIndex + BaseIndex);
 		}
 	}
 
-	// Create mesh section
-	if (Vertices.Num() > 0)
-	{
-		TArray<FVector2D> UV0;
-		TArray<FProcMeshTangent> Tangents;
-		
-		ProceduralMesh->ClearAllMeshSections();
-		ProceduralMesh->CreateMeshSection(0, Vertices, Triangles, Normals, UV0, VertexColors, Tangents, true);
-		
-		UE_LOG(LogTemp, Log, TEXT("VoxelComponent: Greedy mesh generated with %d vertices, %d triangles"), 
-			Vertices.Num(), Triangles.Num() / 3);
-	}
+	UE_LOG(LogTemp, Log, TEXT("VoxelComponent: Greedy mesh generated with %d vertices, %d triangles"),
+		OutResult.Vertices.Num(), OutResult.Triangles.Num() / 3);
 }
 
 void UVoxelComponent::GreedyMeshAxis(
-	const TArray<const FVoxelBlock*>& VoxelGrid,
+	const TArray<const FPackedVoxel*>& VoxelGrid,
 	const FIntVector& GridSize,
 	const FIntVector& GridMin,
+	const TSet<const FPackedVoxel*>& OwnedVoxels,
 	int32 Axis,
 	int32 Direction,
 	TArray<FVector>& Vertices,
@@ -264,7 +1968,7 @@ void UVoxelComponent::GreedyMeshAxis(
 {
 	// Determine dimensions based on axis
 	int32 USize, VSize, WSize;
-	
+
 	switch (Axis)
 	{
 	case 0: // X axis
@@ -284,31 +1988,33 @@ void UVoxelComponent::GreedyMeshAxis(
 		break;
 	}
 
+	// One mask allocation for all slices: the quad-generation loop below
+	// consumes every set cell and clears it, so the mask is empty again
+	// when the next slice starts
+	TArray<const FPackedVoxel*> Mask;
+	Mask.Init(nullptr, USize * VSize);
+
 	// Process each slice along the axis
 	for (int32 D = 0; D < WSize; ++D)
 	{
-		// Create mask for this slice
-		TArray<const FVoxelBlock*> Mask;
-		Mask.Init(nullptr, USize * VSize);
-
 		// Fill mask by checking which faces are exposed
 		for (int32 I = 0; I < USize; ++I)
 		{
 			for (int32 J = 0; J < VSize; ++J)
 			{
 				FIntVector Coords = GetAxisCoords(Axis, I, J, D);
-				const FVoxelBlock* Block = GetVoxelFromGrid(VoxelGrid, GridSize, Coords);
+				const FPackedVoxel* Voxel = GetVoxelFromGrid(VoxelGrid, GridSize, Coords);
 
-				if (Block != nullptr)
+				if (Voxel != nullptr && OwnedVoxels.Contains(Voxel))
 				{
 					// Check neighbor in direction
 					FIntVector NeighborCoords = GetAxisCoords(Axis, I, J, D + Direction);
-					const FVoxelBlock* Neighbor = GetVoxelFromGrid(VoxelGrid, GridSize, NeighborCoords);
+					const FPackedVoxel* Neighbor = GetVoxelFromGrid(VoxelGrid, GridSize, NeighborCoords);
 
 					// Face is exposed if no neighbor
 					if (Neighbor == nullptr)
 					{
-						Mask[I + J * USize] = Block;
+						Mask[I + J * USize] = Voxel;
 					}
 				}
 			}
@@ -320,20 +2026,20 @@ void UVoxelComponent::GreedyMeshAxis(
 			for (int32 J = 0; J < VSize; ++J)
 			{
 				int32 MaskIndex = I + J * USize;
-				const FVoxelBlock* Face = Mask[MaskIndex];
-				
+				const FPackedVoxel* Face = Mask[MaskIndex];
+
 				if (Face == nullptr)
 					continue;
 
-				// Find width of this quad
+				// Find width of this quad (material compare is an integer compare)
 				int32 QuadWidth = 1;
 				while (I + QuadWidth < USize)
 				{
 					int32 NextMaskIndex = (I + QuadWidth) + J * USize;
-					const FVoxelBlock* NextFace = Mask[NextMaskIndex];
-					
-					if (NextFace == nullptr || NextFace->Color != Face->Color || 
-						NextFace->MaterialType != Face->MaterialType)
+					const FPackedVoxel* NextFace = Mask[NextMaskIndex];
+
+					if (NextFace == nullptr || NextFace->Color != Face->Color ||
+						NextFace->Material != Face->Material)
 					{
 						break;
 					}
@@ -343,23 +2049,23 @@ void UVoxelComponent::GreedyMeshAxis(
 				// Find height of this quad
 				int32 QuadHeight = 1;
 				bool bCanExtend = true;
-				
+
 				while (J + QuadHeight < VSize && bCanExtend)
 				{
 					// Check entire row
 					for (int32 K = I; K < I + QuadWidth; ++K)
 					{
 						int32 CheckMaskIndex = K + (J + QuadHeight) * USize;
-						const FVoxelBlock* CheckFace = Mask[CheckMaskIndex];
-						
+						const FPackedVoxel* CheckFace = Mask[CheckMaskIndex];
+
 						if (CheckFace == nullptr || CheckFace->Color != Face->Color ||
-							CheckFace->MaterialType != Face->MaterialType)
+							CheckFace->Material != Face->Material)
 						{
 							bCanExtend = false;
 							break;
 						}
 					}
-					
+
 					if (bCanExtend)
 						QuadHeight++;
 				}
@@ -394,8 +2100,8 @@ FIntVector UVoxelComponent::GetAxisCoords(int32 Axis, int32 U, int32 V, int32 W)
 	}
 }
 
-const FVoxelBlock* UVoxelComponent::GetVoxelFromGrid(
-	const TArray<const FVoxelBlock*>& VoxelGrid,
+const FPackedVoxel* UVoxelComponent::GetVoxelFromGrid(
+	const TArray<const FPackedVoxel*>& VoxelGrid,
 	const FIntVector& GridSize,
 	const FIntVector& Coords)
 {
@@ -424,7 +2130,7 @@ void UVoxelComponent::AddGreedyQuad(
 	int32 V,
 	int32 Width,
 	int32 Height,
-	const FVoxelBlock& Block,
+	const FPackedVoxel& Voxel,
 	TArray<FVector>& Vertices,
 	TArray<int32>& Triangles,
 	TArray<FVector>& Normals,
@@ -432,7 +2138,7 @@ void UVoxelComponent::AddGreedyQuad(
 {
 	// Convert grid coordinates back to world space
 	FVector WorldOffset(GridMin);
-	
+
 	// Calculate quad corners based on axis and direction
 	FVector QuadVertices[4];
 	FVector Normal;
@@ -512,7 +2218,7 @@ void UVoxelComponent::AddGreedyQuad(
 	{
 		Vertices.Add(QuadVertices[i]);
 		Normals.Add(Normal);
-		VertexColors.Add(Block.Color);
+		VertexColors.Add(Voxel.Color);
 	}
 
 	// Add triangles (two triangles per quad)
@@ -525,38 +2231,26 @@ void UVoxelComponent::AddGreedyQuad(
 	Triangles.Add(BaseIndex + 3);
 }
 
-void UVoxelComponent::GenerateBlockFaces(const FVoxelBlock& Block, const TMap<FVector, int32>& BlockLookup,
+void UVoxelComponent::GenerateVoxelFaces(const FPackedVoxel& Voxel, const TSet<FIntVector>& OccupiedCells,
                                           TArray<FVector>& Vertices, TArray<int32>& Triangles,
                                           TArray<FVector>& Normals, TArray<FColor>& VertexColors)
 {
 	// Face directions: Right, Left, Top, Bottom, Front, Back
-	static const FVector Directions[] = {
-		FVector(1, 0, 0),   // Right (+X)
-		FVector(-1, 0, 0),  // Left (-X)
-		FVector(0, 0, 1),   // Top (+Z in UE5)
-		FVector(0, 0, -1),  // Bottom (-Z in UE5)
-		FVector(0, 1, 0),   // Front (+Y)
-		FVector(0, -1, 0)   // Back (-Y)
+	static const FIntVector Directions[] = {
+		FIntVector(1, 0, 0),   // Right (+X)
+		FIntVector(-1, 0, 0),  // Left (-X)
+		FIntVector(0, 0, 1),   // Top (+Z in UE5)
+		FIntVector(0, 0, -1),  // Bottom (-Z in UE5)
+		FIntVector(0, 1, 0),   // Front (+Y)
+		FIntVector(0, -1, 0)   // Back (-Y)
 	};
 
 	for (int32 i = 0; i < 6; ++i)
 	{
-		const FVector& Dir = Directions[i];
-		
-		// Calculate neighbor position
-		FVector Offset = FVector(
-			Dir.X != 0 ? Block.Size.X : 0,
-			Dir.Y != 0 ? Block.Size.Y : 0,
-			Dir.Z != 0 ? Block.Size.Z : 0
-		);
-		
-		FVector NeighborPos = Block.Position + Dir * Offset;
-		FVector NeighborKey = RoundPosition(NeighborPos);
-
 		// Only generate face if no neighbor exists
-		if (!BlockLookup.Contains(NeighborKey))
+		if (!OccupiedCells.Contains(Voxel.Coord + Directions[i]))
 		{
-			AddFace(Block.Position, Block.Size, i, Block.Color, Vertices, Triangles, Normals, VertexColors);
+			AddFace(FVector(Voxel.Coord), FVector::OneVector, i, Voxel.Color, Vertices, Triangles, Normals, VertexColors);
 		}
 	}
 }
@@ -584,7 +2278,7 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 		};
 		Normal = FVector(1, 0, 0);
 		break;
-		
+
 	case 1: // Left (-X)
 		FaceVertices = {
 			Position + FVector(-HalfSize.X, HalfSize.Y, -HalfSize.Z),
@@ -594,7 +2288,7 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 		};
 		Normal = FVector(-1, 0, 0);
 		break;
-		
+
 	case 2: // Top (+Z)
 		FaceVertices = {
 			Position + FVector(-HalfSize.X, -HalfSize.Y, HalfSize.Z),
@@ -604,7 +2298,7 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 		};
 		Normal = FVector(0, 0, 1);
 		break;
-		
+
 	case 3: // Bottom (-Z)
 		FaceVertices = {
 			Position + FVector(-HalfSize.X, HalfSize.Y, -HalfSize.Z),
@@ -614,7 +2308,7 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 		};
 		Normal = FVector(0, 0, -1);
 		break;
-		
+
 	case 4: // Front (+Y)
 		FaceVertices = {
 			Position + FVector(-HalfSize.X, HalfSize.Y, -HalfSize.Z),
@@ -624,7 +2318,7 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 		};
 		Normal = FVector(0, 1, 0);
 		break;
-		
+
 	case 5: // Back (-Y)
 		FaceVertices = {
 			Position + FVector(HalfSize.X, -HalfSize.Y, -HalfSize.Z),
@@ -634,7 +2328,7 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 		};
 		Normal = FVector(0, -1, 0);
 		break;
-		
+
 	default:
 		return;
 	}
@@ -657,20 +2351,6 @@ void UVoxelComponent::AddFace(const FVector& Position, const FVector& Size, int3
 	Triangles.Add(BaseIndex + 3);
 }
 
-TMap<FVector, int32> UVoxelComponent::BuildBlockLookup() const
-{
-	TMap<FVector, int32> Lookup;
-	for (int32 i = 0; i < Blocks.Num(); ++i)
-	{
-		if (!Blocks[i].bIsDestroyed)
-		{
-			FVector Key = RoundPosition(Blocks[i].Position);
-			Lookup.Add(Key, i);
-		}
-	}
-	return Lookup;
-}
-
 FVector UVoxelComponent::RoundPosition(const FVector& Position)
 {
 	// Round to nearest integer for lookup
@@ -0,0 +1,178 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "CoreMinimal.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "SpaceActor.h"
+#include "VoxelComponent.h"
+#include "VoxelMaterial.h"
+#include "VoxelShapeTables.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Misc/AutomationTest.h"
+
+namespace
+{
+	/** The current game world, or null when run without -game */
+	UWorld* GetVoxelTestWorld()
+	{
+		if (!GEngine)
+		{
+			return nullptr;
+		}
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			if ((Context.WorldType == EWorldType::Game || Context.WorldType == EWorldType::PIE) && Context.World())
+			{
+				return Context.World();
+			}
+		}
+		return nullptr;
+	}
+
+	/** A voxel block at a grid coordinate, default cube unless reshaped */
+	FVoxelBlock MakeTestBlock(const FVector& Position, EBlockShape Shape)
+	{
+		FVoxelBlock Block;
+		Block.Position = Position;
+		Block.Size = FVector::OneVector;
+		Block.MaterialType = UVoxelMaterialLibrary::GetMaterialDisplayName(EMaterialTier::Iron);
+		Block.Shape = Shape;
+		Block.CalculateProperties();
+		return Block;
+	}
+
+	/** LOD0 vertex count of the first chunk's section, or INDEX_NONE */
+	int32 GetFirstSectionVertexCount(const UVoxelComponent* Voxels)
+	{
+		if (!Voxels || !Voxels->ProceduralMesh)
+		{
+			return INDEX_NONE;
+		}
+		const FProcMeshSection* Section = Voxels->ProceduralMesh->GetProcMeshSection(0);
+		return Section ? Section->ProcVertexBuffer.Num() : INDEX_NONE;
+	}
+}
+
+/**
+ * Waits for the component's dirty-chunk remesh tick, then asserts the
+ * shaped block added after the full rebuild was meshed from its shape
+ * table rather than as a cube. Regression test for the packed mirror
+ * reset in RebuildChunkMap dropping PackedShapes/PackedOrientations:
+ * stale entries shifted every later block's shape lookup, so a wedge
+ * added after a rebuild came out as another block's cube.
+ */
+DEFINE_LATENT_AUTOMATION_COMMAND_FOUR_PARAMETER(FVoxelShapedBlockAssertCommand, FAutomationTestBase*, Test, TWeakObjectPtr<UVoxelComponent>, Voxels, int32, CubeOnlyVertexCount, int32, FramesRemaining);
+bool FVoxelShapedBlockAssertCommand::Update()
+{
+	UVoxelComponent* Component = Voxels.Get();
+	if (!Component)
+	{
+		Test->AddError(TEXT("Voxel component died before the remesh was checked"));
+		return true;
+	}
+	if (--FramesRemaining > 0)
+	{
+		return false;
+	}
+
+	const VoxelShape::FShapeGeometry& WedgeGeo = VoxelShape::GetShapeGeometry(
+		static_cast<uint8>(EBlockShape::Wedge), static_cast<uint8>(EBlockOrientation::PosY));
+
+	// Count: cube quads plus the wedge's full canonical soup
+	const int32 ExpectedVertexCount = CubeOnlyVertexCount + WedgeGeo.Vertices.Num();
+	const int32 ActualVertexCount = GetFirstSectionVertexCount(Component);
+	if (ActualVertexCount != ExpectedVertexCount)
+	{
+		Test->AddError(FString::Printf(
+			TEXT("Shaped block meshed with %d section vertices, expected %d (%d cube + %d wedge table) - shape/orientation mirrors out of sync after RebuildChunkMap"),
+			ActualVertexCount, ExpectedVertexCount, CubeOnlyVertexCount, WedgeGeo.Vertices.Num()));
+	}
+	else if (const FProcMeshSection* Section = Component->ProceduralMesh->GetProcMeshSection(0))
+	{
+		// Placement: every table vertex must appear translated to the
+		// wedge's cell, so the geometry is the wedge's, not a cube's
+		const FVector WedgeCenter(2.0f, 0.0f, 0.0f);
+		for (const FVector& TableVertex : WedgeGeo.Vertices)
+		{
+			const FVector Expected = WedgeCenter + TableVertex;
+			bool bFound = false;
+			for (const FProcMeshVertex& Vertex : Section->ProcVertexBuffer)
+			{
+				if (FVector(Vertex.Position).Equals(Expected, KINDA_SMALL_NUMBER))
+				{
+					bFound = true;
+					break;
+				}
+			}
+			if (!bFound)
+			{
+				Test->AddError(FString::Printf(
+					TEXT("Wedge table vertex %s missing from the rebuilt section"), *Expected.ToString()));
+				break;
+			}
+		}
+	}
+
+	if (AActor* Owner = Component->GetOwner())
+	{
+		Owner->Destroy();
+	}
+	return true;
+}
+
+/**
+ * A shaped block added after a full rebuild must mesh from its shape
+ * table. RebuildChunkMap re-appends every block into the packed SoA
+ * mirrors, so each mirror has to be reset first - this pins the two
+ * shape-table mirrors to that contract.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelShapedBlockAfterRebuildTest, "Subspace.Voxel.ShapedBlockAfterFullRebuild",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+bool FVoxelShapedBlockAfterRebuildTest::RunTest(const FString& Parameters)
+{
+	UWorld* World = GetVoxelTestWorld();
+	if (!World)
+	{
+		AddError(TEXT("No game world; run with -game (headless: -nullrhi) and Automation RunTests Subspace.Voxel"));
+		return false;
+	}
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+	ASpaceActor* Ship = World->SpawnActor<ASpaceActor>(ASpaceActor::StaticClass(),
+		FVector(0.0f, 0.0f, 100000.0f), FRotator::ZeroRotator, SpawnParams);
+	if (!Ship)
+	{
+		AddError(TEXT("Failed to spawn the test actor"));
+		return false;
+	}
+	Ship->RotationSpeed = FVector::ZeroVector;
+
+	UVoxelComponent* Voxels = NewObject<UVoxelComponent>(Ship, TEXT("TestVoxels"));
+	Voxels->bAsyncMeshing = false;  // Assertions read the section right after the remesh tick
+	Voxels->bEnableLOD = false;
+	Voxels->RegisterComponent();
+
+	// Seed one cube, force the full-rebuild path, and record its
+	// cube-only geometry as the baseline
+	Voxels->AddBlock(MakeTestBlock(FVector::ZeroVector, EBlockShape::Cube));
+	Voxels->RebuildMesh();
+	const int32 CubeOnlyVertexCount = GetFirstSectionVertexCount(Voxels);
+	if (CubeOnlyVertexCount <= 0)
+	{
+		AddError(TEXT("Full rebuild produced no cube geometry"));
+		Ship->Destroy();
+		return false;
+	}
+
+	// A shaped block added after the rebuild lands in the same chunk and
+	// remeshes on the component's next tick
+	Voxels->AddBlock(MakeTestBlock(FVector(2.0f, 0.0f, 0.0f), EBlockShape::Wedge));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FVoxelShapedBlockAssertCommand(this, Voxels, CubeOnlyVertexCount, 2));
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -2,14 +2,16 @@
 
 #include "VoxelMaterial.h"
 
-// Static member initialization
-TMap<EMaterialTier, FVoxelMaterialProperties> UVoxelMaterialLibrary::MaterialTable;
-bool UVoxelMaterialLibrary::bMaterialTableInitialized = false;
-
-void UVoxelMaterialLibrary::InitializeMaterialTable()
+const FVoxelMaterialProperties* UVoxelMaterialLibrary::GetMaterialTable()
 {
-	if (bMaterialTableInitialized)
-		return;
+	// Fixed array indexed by EMaterialTier; FString members keep this
+	// from being constexpr, so it is built once on first use instead
+	static FVoxelMaterialProperties Table[NumMaterialTiers];
+	static bool bInitialized = false;
+	if (bInitialized)
+	{
+		return Table;
+	}
 
 	// Iron - Starting material
 	FVoxelMaterialProperties Iron;
@@ -24,7 +26,7 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Iron.UnlockDistance = MAX_int32;
 	Iron.StatMultiplier = 1.0f;
 	Iron.TechPointsMultiplier = 1.0f;
-	MaterialTable.Add(EMaterialTier::Iron, Iron);
+	Table[static_cast<uint8>(EMaterialTier::Iron)] = Iron;
 
 	// Titanium - Tier 1
 	FVoxelMaterialProperties Titanium;
@@ -39,7 +41,7 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Titanium.UnlockDistance = 350;
 	Titanium.StatMultiplier = 1.3f;
 	Titanium.TechPointsMultiplier = 1.5f;
-	MaterialTable.Add(EMaterialTier::Titanium, Titanium);
+	Table[static_cast<uint8>(EMaterialTier::Titanium)] = Titanium;
 
 	// Naonite - Tier 2
 	FVoxelMaterialProperties Naonite;
@@ -54,7 +56,7 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Naonite.UnlockDistance = 250;
 	Naonite.StatMultiplier = 1.6f;
 	Naonite.TechPointsMultiplier = 2.5f;
-	MaterialTable.Add(EMaterialTier::Naonite, Naonite);
+	Table[static_cast<uint8>(EMaterialTier::Naonite)] = Naonite;
 
 	// Trinium - Tier 3
 	FVoxelMaterialProperties Trinium;
@@ -69,7 +71,7 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Trinium.UnlockDistance = 150;
 	Trinium.StatMultiplier = 2.0f;
 	Trinium.TechPointsMultiplier = 4.0f;
-	MaterialTable.Add(EMaterialTier::Trinium, Trinium);
+	Table[static_cast<uint8>(EMaterialTier::Trinium)] = Trinium;
 
 	// Xanion - Tier 4
 	FVoxelMaterialProperties Xanion;
@@ -84,7 +86,7 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Xanion.UnlockDistance = 75;
 	Xanion.StatMultiplier = 2.5f;
 	Xanion.TechPointsMultiplier = 6.0f;
-	MaterialTable.Add(EMaterialTier::Xanion, Xanion);
+	Table[static_cast<uint8>(EMaterialTier::Xanion)] = Xanion;
 
 	// Ogonite - Tier 5
 	FVoxelMaterialProperties Ogonite;
@@ -99,7 +101,7 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Ogonite.UnlockDistance = 50;
 	Ogonite.StatMultiplier = 3.0f;
 	Ogonite.TechPointsMultiplier = 9.0f;
-	MaterialTable.Add(EMaterialTier::Ogonite, Ogonite);
+	Table[static_cast<uint8>(EMaterialTier::Ogonite)] = Ogonite;
 
 	// Avorion - Tier 6 (Ultimate)
 	FVoxelMaterialProperties Avorion;
@@ -114,28 +116,30 @@ void UVoxelMaterialLibrary::InitializeMaterialTable()
 	Avorion.UnlockDistance = 25;
 	Avorion.StatMultiplier = 4.0f;
 	Avorion.TechPointsMultiplier = 15.0f;
-	MaterialTable.Add(EMaterialTier::Avorion, Avorion);
+	Table[static_cast<uint8>(EMaterialTier::Avorion)] = Avorion;
 
-	bMaterialTableInitialized = true;
+	bInitialized = true;
+	return Table;
 }
 
-FVoxelMaterialProperties UVoxelMaterialLibrary::GetMaterialProperties(EMaterialTier Tier)
+const FVoxelMaterialProperties& UVoxelMaterialLibrary::GetMaterialPropertiesByIndex(uint8 MaterialIndex)
 {
-	InitializeMaterialTable();
-	
-	if (MaterialTable.Contains(Tier))
+	const FVoxelMaterialProperties* Table = GetMaterialTable();
+	if (MaterialIndex >= NumMaterialTiers)
 	{
-		return MaterialTable[Tier];
+		// Return Iron as default
+		MaterialIndex = static_cast<uint8>(EMaterialTier::Iron);
 	}
-	
-	// Return Iron as default
-	return MaterialTable[EMaterialTier::Iron];
+	return Table[MaterialIndex];
+}
+
+FVoxelMaterialProperties UVoxelMaterialLibrary::GetMaterialProperties(EMaterialTier Tier)
+{
+	return GetMaterialPropertiesByIndex(static_cast<uint8>(Tier));
 }
 
 FVoxelMaterialProperties UVoxelMaterialLibrary::GetMaterialPropertiesByName(const FString& MaterialName)
 {
-	InitializeMaterialTable();
-	
 	EMaterialTier Tier = MaterialNameToTier(MaterialName);
 	return GetMaterialProperties(Tier);
 }
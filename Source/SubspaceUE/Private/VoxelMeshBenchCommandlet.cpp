@@ -0,0 +1,169 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "VoxelMeshBenchCommandlet.h"
+#include "VoxelComponent.h"
+#include "VoxelBlock.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogVoxelMeshBench, Log, All);
+
+namespace
+{
+	/** Random asteroid fill ratio */
+	constexpr float AsteroidFillRatio = 0.3f;
+
+	/** Fixed seed so runs are comparable across machines and sessions */
+	constexpr int32 BenchSeed = 24601;
+
+	FPackedVoxel MakeVoxel(const FIntVector& Coord)
+	{
+		FPackedVoxel Voxel;
+		Voxel.Coord = Coord;
+		Voxel.Material = 1;
+		Voxel.Color = FColor::Silver;
+		return Voxel;
+	}
+
+	/** Fully filled cube of ~BlockCount voxels */
+	TArray<FPackedVoxel> BuildSolidCube(int32 BlockCount)
+	{
+		const int32 Side = FMath::Max(1, FMath::RoundToInt(FMath::Pow((float)BlockCount, 1.0f / 3.0f)));
+		TArray<FPackedVoxel> Voxels;
+		Voxels.Reserve(Side * Side * Side);
+		for (int32 Z = 0; Z < Side; ++Z)
+			for (int32 Y = 0; Y < Side; ++Y)
+				for (int32 X = 0; X < Side; ++X)
+				{
+					Voxels.Add(MakeVoxel(FIntVector(X, Y, Z)));
+				}
+		return Voxels;
+	}
+
+	/** One-voxel-thick cube shell of ~BlockCount voxels */
+	TArray<FPackedVoxel> BuildHollowHull(int32 BlockCount)
+	{
+		// Surface of a cube shell is ~6*s^2 voxels
+		const int32 Side = FMath::Max(3, FMath::RoundToInt(FMath::Sqrt(BlockCount / 6.0f)));
+		TArray<FPackedVoxel> Voxels;
+		Voxels.Reserve(6 * Side * Side);
+		for (int32 Z = 0; Z < Side; ++Z)
+			for (int32 Y = 0; Y < Side; ++Y)
+				for (int32 X = 0; X < Side; ++X)
+				{
+					const bool bShell = X == 0 || X == Side - 1 ||
+						Y == 0 || Y == Side - 1 ||
+						Z == 0 || Z == Side - 1;
+					if (bShell)
+					{
+						Voxels.Add(MakeVoxel(FIntVector(X, Y, Z)));
+					}
+				}
+		return Voxels;
+	}
+
+	/** Random 30%-filled cube of ~BlockCount voxels */
+	TArray<FPackedVoxel> BuildRandomAsteroid(int32 BlockCount)
+	{
+		const int32 Side = FMath::Max(1, FMath::RoundToInt(FMath::Pow(BlockCount / AsteroidFillRatio, 1.0f / 3.0f)));
+		FRandomStream Stream(BenchSeed);
+		TArray<FPackedVoxel> Voxels;
+		Voxels.Reserve(BlockCount + BlockCount / 8);
+		for (int32 Z = 0; Z < Side; ++Z)
+			for (int32 Y = 0; Y < Side; ++Y)
+				for (int32 X = 0; X < Side; ++X)
+				{
+					if (Stream.FRand() < AsteroidFillRatio)
+					{
+						Voxels.Add(MakeVoxel(FIntVector(X, Y, Z)));
+					}
+				}
+		return Voxels;
+	}
+
+	/** Bytes held by the finished mesh buffers */
+	SIZE_T ResultBytes(const FVoxelMeshBuildResult& Result)
+	{
+		return Result.Vertices.GetAllocatedSize() +
+			Result.Triangles.GetAllocatedSize() +
+			Result.Normals.GetAllocatedSize() +
+			Result.VertexColors.GetAllocatedSize();
+	}
+}
+
+int32 UVoxelMeshBenchCommandlet::Main(const FString& Params)
+{
+	int32 Runs = 3;
+	FParse::Value(*Params, TEXT("runs="), Runs);
+	Runs = FMath::Clamp(Runs, 1, 100);
+
+	TArray<int32> Sizes = { 10000, 100000, 500000 };
+	FString SizesArg;
+	if (FParse::Value(*Params, TEXT("sizes="), SizesArg))
+	{
+		Sizes.Reset();
+		TArray<FString> Parts;
+		SizesArg.ParseIntoArray(Parts, TEXT(","));
+		for (const FString& Part : Parts)
+		{
+			const int32 Size = FCString::Atoi(*Part);
+			if (Size > 0)
+			{
+				Sizes.Add(Size);
+			}
+		}
+	}
+
+	FString Csv = TEXT("scenario,blocks,mesher,run,vertices,triangles,wall_ms,result_bytes\n");
+
+	for (int32 Size : Sizes)
+	{
+		BenchScenario(TEXT("solid_cube"), BuildSolidCube(Size), Runs, Csv);
+		BenchScenario(TEXT("hollow_hull"), BuildHollowHull(Size), Runs, Csv);
+		BenchScenario(TEXT("random_asteroid"), BuildRandomAsteroid(Size), Runs, Csv);
+	}
+
+	const FString OutputPath = FPaths::ProfilingDir() / TEXT("VoxelMeshBench.csv");
+	FFileHelper::SaveStringToFile(Csv, *OutputPath);
+	UE_LOG(LogVoxelMeshBench, Display, TEXT("VoxelMeshBench: Results written to %s"), *OutputPath);
+
+	return 0;
+}
+
+void UVoxelMeshBenchCommandlet::BenchScenario(const FString& ScenarioName,
+	const TArray<FPackedVoxel>& Voxels, int32 Runs, FString& OutCsv) const
+{
+	// Border voxels only matter for cross-chunk culling; benchmark
+	// scenarios are single self-contained block sets
+	const TArray<FPackedVoxel> NoBorder;
+
+	struct FMesher
+	{
+		const TCHAR* Name;
+		void (*Build)(const TArray<FPackedVoxel>&, const TArray<FPackedVoxel>&, FVoxelMeshBuildResult&);
+	};
+	const FMesher Meshers[] = {
+		{ TEXT("simple"), &UVoxelComponent::BuildSimpleMesh },
+		{ TEXT("greedy"), &UVoxelComponent::BuildGreedyMesh },
+	};
+
+	for (const FMesher& Mesher : Meshers)
+	{
+		for (int32 Run = 0; Run < Runs; ++Run)
+		{
+			FVoxelMeshBuildResult Result;
+			const double StartTime = FPlatformTime::Seconds();
+			Mesher.Build(Voxels, NoBorder, Result);
+			const double WallMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+			const FString Row = FString::Printf(TEXT("%s,%d,%s,%d,%d,%d,%.3f,%llu"),
+				*ScenarioName, Voxels.Num(), Mesher.Name, Run,
+				Result.Vertices.Num(), Result.Triangles.Num() / 3,
+				WallMs, static_cast<uint64>(ResultBytes(Result)));
+
+			UE_LOG(LogVoxelMeshBench, Display, TEXT("%s"), *Row);
+			OutCsv += Row + TEXT("\n");
+		}
+	}
+}
@@ -0,0 +1,196 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#include "VoxelShapeTables.h"
+
+namespace
+{
+	// Canonical triangle soups, nine floats per triangle, in the unit
+	// voxel centered on the origin (corners at +-H). Canonical facing is
+	// +Y (EBlockOrientation::PosY); winding is chosen so the outward
+	// flat normal is Cross(B-A, C-A).
+	constexpr float H = 0.5f;
+
+	// Wedge: full bottom and -Y wall, slope from the top-back edge down
+	// to the front-bottom edge (8 triangles)
+	constexpr float WedgeTris[] = {
+		// Bottom (-Z)
+		-H,-H,-H,  -H, H,-H,   H, H,-H,
+		-H,-H,-H,   H, H,-H,   H,-H,-H,
+		// Back wall (-Y)
+		-H,-H,-H,   H,-H,-H,   H,-H, H,
+		-H,-H,-H,   H,-H, H,  -H,-H, H,
+		// Slope (+Y/+Z)
+		-H,-H, H,   H,-H, H,   H, H,-H,
+		-H,-H, H,   H, H,-H,  -H, H,-H,
+		// Left side (-X)
+		-H,-H,-H,  -H,-H, H,  -H, H,-H,
+		// Right side (+X)
+		 H,-H,-H,   H, H,-H,   H,-H, H,
+	};
+
+	// Half block: box filling the lower half of the voxel (12 triangles)
+	constexpr float HalfBlockTris[] = {
+		// Bottom (-Z)
+		-H,-H,-H,  -H, H,-H,   H, H,-H,
+		-H,-H,-H,   H, H,-H,   H,-H,-H,
+		// Top (+Z at mid-height)
+		-H,-H, 0,   H,-H, 0,   H, H, 0,
+		-H,-H, 0,   H, H, 0,  -H, H, 0,
+		// Front (+Y)
+		-H, H,-H,  -H, H, 0,   H, H, 0,
+		-H, H,-H,   H, H, 0,   H, H,-H,
+		// Back (-Y)
+		-H,-H,-H,   H,-H,-H,   H,-H, 0,
+		-H,-H,-H,   H,-H, 0,  -H,-H, 0,
+		// Left (-X)
+		-H,-H,-H,  -H,-H, 0,  -H, H, 0,
+		-H,-H,-H,  -H, H, 0,  -H, H,-H,
+		// Right (+X)
+		 H,-H,-H,   H, H,-H,   H, H, 0,
+		 H,-H,-H,   H, H, 0,   H,-H, 0,
+	};
+
+	// Corner: tetrahedron in the (-X,-Y,-Z) corner with full-edge legs
+	// (4 triangles)
+	constexpr float CornerTris[] = {
+		// Bottom (-Z)
+		-H,-H,-H,  -H, H,-H,   H,-H,-H,
+		// Back (-Y)
+		-H,-H,-H,   H,-H,-H,  -H,-H, H,
+		// Left (-X)
+		-H,-H,-H,  -H,-H, H,  -H, H,-H,
+		// Slope (+X+Y+Z)
+		 H,-H,-H,  -H, H,-H,  -H,-H, H,
+	};
+
+	// Inner corner: cube minus the Corner tetrahedron (10 triangles)
+	constexpr float InnerCornerTris[] = {
+		// Front (+Y), full
+		-H, H,-H,  -H, H, H,   H, H, H,
+		-H, H,-H,   H, H, H,   H, H,-H,
+		// Right (+X), full
+		 H,-H,-H,   H, H,-H,   H, H, H,
+		 H,-H,-H,   H, H, H,   H,-H, H,
+		// Top (+Z), full
+		-H,-H, H,   H,-H, H,   H, H, H,
+		-H,-H, H,   H, H, H,  -H, H, H,
+		// Bottom (-Z), remaining half
+		 H,-H,-H,  -H, H,-H,   H, H,-H,
+		// Back (-Y), remaining half
+		 H,-H,-H,   H,-H, H,  -H,-H, H,
+		// Left (-X), remaining half
+		-H,-H, H,  -H, H, H,  -H, H,-H,
+		// Cut face (-X-Y-Z)
+		 H,-H,-H,  -H,-H, H,  -H, H,-H,
+	};
+
+	// Tetrahedron: interior tetrahedron on alternating cube corners
+	// (4 triangles)
+	constexpr float TetrahedronTris[] = {
+		// Opposite (+H,+H,+H)
+		 H,-H,-H,  -H,-H, H,  -H, H,-H,
+		// Opposite (-H,-H,+H)
+		 H,-H,-H,  -H, H,-H,   H, H, H,
+		// Opposite (-H,+H,-H)
+		 H,-H,-H,   H, H, H,  -H,-H, H,
+		// Opposite (+H,-H,-H)
+		-H, H,-H,  -H,-H, H,   H, H, H,
+	};
+
+	/** Canonical soup per shape; cubes have none (quad paths handle them) */
+	struct FCanonicalShape
+	{
+		const float* Data = nullptr;
+		int32 NumFloats = 0;
+	};
+
+	constexpr FCanonicalShape CanonicalShapes[VoxelShape::NumShapes] = {
+		{ nullptr, 0 },                                        // Cube
+		{ WedgeTris, UE_ARRAY_COUNT(WedgeTris) },              // Wedge
+		{ CornerTris, UE_ARRAY_COUNT(CornerTris) },            // Corner
+		{ InnerCornerTris, UE_ARRAY_COUNT(InnerCornerTris) },  // InnerCorner
+		{ TetrahedronTris, UE_ARRAY_COUNT(TetrahedronTris) },  // Tetrahedron
+		{ HalfBlockTris, UE_ARRAY_COUNT(HalfBlockTris) },      // HalfBlock
+	};
+
+	// Rotation matrices (row-major) taking the canonical +Y facing to
+	// each EBlockOrientation: PosX, NegX, PosY, NegY, PosZ, NegZ
+	constexpr int8 OrientationMats[VoxelShape::NumOrientations][9] = {
+		{  0, 1, 0,  -1, 0, 0,   0, 0, 1 },  // PosX
+		{  0,-1, 0,   1, 0, 0,   0, 0, 1 },  // NegX
+		{  1, 0, 0,   0, 1, 0,   0, 0, 1 },  // PosY (identity)
+		{ -1, 0, 0,   0,-1, 0,   0, 0, 1 },  // NegY
+		{  1, 0, 0,   0, 0,-1,   0, 1, 0 },  // PosZ
+		{  1, 0, 0,   0, 0, 1,   0,-1, 0 },  // NegZ
+	};
+
+	FVector RotateByMat(const int8* Mat, const FVector& V)
+	{
+		return FVector(
+			Mat[0] * V.X + Mat[1] * V.Y + Mat[2] * V.Z,
+			Mat[3] * V.X + Mat[4] * V.Y + Mat[5] * V.Z,
+			Mat[6] * V.X + Mat[7] * V.Y + Mat[8] * V.Z);
+	}
+
+	struct FBakedTables
+	{
+		VoxelShape::FShapeGeometry Geometry[VoxelShape::NumShapes][VoxelShape::NumOrientations];
+	};
+
+	FBakedTables BakeAllShapes()
+	{
+		FBakedTables Tables;
+		for (int32 Shape = 0; Shape < VoxelShape::NumShapes; ++Shape)
+		{
+			const FCanonicalShape& Canonical = CanonicalShapes[Shape];
+			const int32 NumVerts = Canonical.NumFloats / 3;
+
+			for (int32 Orient = 0; Orient < VoxelShape::NumOrientations; ++Orient)
+			{
+				VoxelShape::FShapeGeometry& Geo = Tables.Geometry[Shape][Orient];
+				Geo.Vertices.Reserve(NumVerts);
+				Geo.Normals.Reserve(NumVerts);
+
+				const int8* Mat = OrientationMats[Orient];
+				for (int32 Tri = 0; Tri < NumVerts / 3; ++Tri)
+				{
+					const float* T = Canonical.Data + Tri * 9;
+					const FVector A = RotateByMat(Mat, FVector(T[0], T[1], T[2]));
+					const FVector B = RotateByMat(Mat, FVector(T[3], T[4], T[5]));
+					const FVector C = RotateByMat(Mat, FVector(T[6], T[7], T[8]));
+
+					// Pure rotations preserve winding, so the flat normal
+					// is recomputed from the rotated triangle directly
+					const FVector Normal = FVector::CrossProduct(B - A, C - A).GetSafeNormal();
+
+					Geo.Vertices.Add(A);
+					Geo.Vertices.Add(B);
+					Geo.Vertices.Add(C);
+					Geo.Normals.Add(Normal);
+					Geo.Normals.Add(Normal);
+					Geo.Normals.Add(Normal);
+				}
+			}
+		}
+		return Tables;
+	}
+}
+
+namespace VoxelShape
+{
+	const FShapeGeometry& GetShapeGeometry(uint8 Shape, uint8 Orientation)
+	{
+		// Function-local static: baked once, thread-safe initialization
+		static const FBakedTables Tables = BakeAllShapes();
+
+		if (Shape >= NumShapes)
+		{
+			Shape = 0;
+		}
+		if (Orientation >= NumOrientations)
+		{
+			Orientation = 2; // PosY, the canonical orientation
+		}
+		return Tables.Geometry[Shape][Orientation];
+	}
+}
@@ -0,0 +1,100 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "VoxelBlock.h"
+#include "AsteroidFieldSubsystem.generated.h"
+
+class UHierarchicalInstancedStaticMeshComponent;
+class UStaticMesh;
+class UVoxelComponent;
+
+/**
+ * One voxel asteroid archetype: the source voxels (kept so a promoted
+ * instance can be rebuilt as a live voxel structure) and the static
+ * mesh they were greedy-meshed into exactly once.
+ */
+struct FAsteroidArchetype
+{
+	/** Source voxels the archetype was generated from */
+	TArray<FPackedVoxel> Voxels;
+
+	/** Greedy mesh baked from the voxels, shared by every instance */
+	UStaticMesh* Mesh = nullptr;
+
+	/** Instance renderer for this archetype */
+	UHierarchicalInstancedStaticMeshComponent* Instances = nullptr;
+
+	/** Per-instance transforms, index-parallel to the HISM instances */
+	TArray<FTransform> InstanceTransforms;
+};
+
+/**
+ * Procedural asteroid field engine. Generates a small library of voxel
+ * asteroid archetypes, meshes each once through the greedy mesher, and
+ * scatters thousands of instances across hierarchical instanced static
+ * mesh components with deterministic seeding - the same seed always
+ * produces the same field. An instance stays a cheap shared-mesh
+ * instance until something actually interacts with it; at that point it
+ * is promoted to a live actor with its own UVoxelComponent (and
+ * registered with the spatial partition) so it can be shot apart and
+ * mined block by block. Per-asteroid voxel components only ever exist
+ * for the handful of asteroids currently being worked.
+ */
+UCLASS()
+class SUBSPACEUE_API UAsteroidFieldSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Number of asteroid archetypes in the shared library */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Asteroid Field")
+	int32 NumArchetypes = 8;
+
+	/**
+	 * Scatter a field of instanced asteroids. Deterministic for a given
+	 * seed: generation, archetype choice, placement, rotation and scale
+	 * all draw from streams seeded by it. Returns the number scattered.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+	int32 GenerateField(const FVector& Center, float Radius, int32 Count, int32 Seed);
+
+	/**
+	 * Promote the instance nearest to a world location (within
+	 * SearchRadius) to a live voxel asteroid actor, removing it from the
+	 * instanced renderer. Returns the promoted actor, or null if no
+	 * instance is in range. Weapons and mining lasers call this when
+	 * they interact with the field.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+	AActor* PromoteNearestInstance(const FVector& WorldLocation, float SearchRadius);
+
+	/** Instances currently in the field renderers */
+	UFUNCTION(BlueprintCallable, Category = "Asteroid Field")
+	int32 GetInstanceCount() const;
+
+protected:
+	/** Build the archetype library and its HISM renderers on first use */
+	void EnsureArchetypes(int32 Seed);
+
+	/** Generate one archetype's voxel blob deterministically */
+	static TArray<FPackedVoxel> GenerateArchetypeVoxels(int32 Seed, int32 ArchetypeIndex);
+
+	/** Bake a packed voxel set into a shared static mesh via the greedy mesher */
+	UStaticMesh* BakeArchetypeMesh(const TArray<FPackedVoxel>& Voxels, int32 ArchetypeIndex);
+
+	/** Spawn the promoted actor and fill its voxel component from an archetype */
+	AActor* SpawnPromotedAsteroid(const FAsteroidArchetype& Archetype, const FTransform& Transform);
+
+	/** Lazily spawned holder actor owning the per-archetype HISM components */
+	UPROPERTY(Transient)
+	AActor* FieldHolder = nullptr;
+
+	/** Archetype library, built once per world on first field generation */
+	TArray<FAsteroidArchetype> Archetypes;
+
+	/** Seed the archetype library was built from */
+	int32 ArchetypeSeed = 0;
+};
@@ -145,6 +145,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crew")
 	int32 Credits = 10000;
 
+	/** Simulate crew walking the ship interior when the owner has one */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crew|Walking")
+	bool bSimulateCrewWalking = true;
+
+	/** Crew walk speed in cm/s */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Crew|Walking")
+	float CrewWalkSpeed = 150.0f;
+
+	/** Ship-local positions of every simulated walker */
+	UFUNCTION(BlueprintCallable, Category = "Crew|Walking")
+	TArray<FVector> GetCrewLocalPositions() const;
+
 	/** Get current crew count */
 	UFUNCTION(BlueprintCallable, Category = "Crew")
 	int32 GetCrewCount() const { return CrewMembers.Num(); }
@@ -157,10 +169,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Crew")
 	bool IsCrewFull() const { return CrewMembers.Num() >= MaxCrew; }
 
-	/** Get average morale */
+	/** Get average morale (cached aggregate, O(1)) */
 	UFUNCTION(BlueprintCallable, Category = "Crew")
 	float GetAverageMorale() const;
 
+	/** Total crew salary per hour (cached aggregate, O(1)) */
+	UFUNCTION(BlueprintCallable, Category = "Crew")
+	int32 GetTotalSalaryPerHour() const { return TotalSalaryPerHour; }
+
+	/**
+	 * Recompute all cached aggregates from CrewMembers. Hire/fire/train/
+	 * morale paths maintain them incrementally; call this only after
+	 * editing CrewMembers directly.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Crew")
+	void RebuildCrewAggregates();
+
 	/** Get crew by role */
 	UFUNCTION(BlueprintCallable, Category = "Crew")
 	TArray<FCrewMember> GetCrewByRole(ECrewRole Role) const;
@@ -215,7 +239,7 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Crew")
 	void AwardExperienceToAll(int32 XP);
 
-	/** Get skill bonus for role */
+	/** Get skill bonus for role (cached aggregate, O(1)) */
 	UFUNCTION(BlueprintCallable, Category = "Crew")
 	float GetSkillBonus(ECrewRole Role) const;
 
@@ -269,6 +293,72 @@ protected:
 	/** Calculate skill level from experience */
 	int32 CalculateSkillLevel(int32 Experience) const;
 
+	/** Add one member's contribution to the cached aggregates */
+	void AddCrewToAggregates(const FCrewMember& Crew);
+
+	/** Remove one member's contribution from the cached aggregates */
+	void RemoveCrewFromAggregates(const FCrewMember& Crew);
+
+	/** The skill a member contributes to their role's bonus */
+	static int32 GetRoleSkill(const FCrewMember& Crew);
+
+	/** One simulated walking crew member */
+	struct FCrewWalker
+	{
+		/** Current position in ship-local space */
+		FVector Position = FVector::ZeroVector;
+
+		/** Remaining path points from the interior's baked nav graph */
+		TArray<FVector> PathPoints;
+
+		/** Index of the path point currently walked towards */
+		int32 NextPoint = 0;
+
+		/** Seconds left idling at the destination before rerolling */
+		float IdleTimer = 0.0f;
+	};
+
+	/** Simulated walkers, one per crew member (anonymous, like instances) */
+	TArray<FCrewWalker> Walkers;
+
+	/** Interior the crew walks, found on the owner once */
+	TWeakObjectPtr<class UShipInteriorComponent> ShipInterior;
+
+	/** Instanced visual for all walkers (one box per crew member) */
+	UPROPERTY()
+	class UInstancedStaticMeshComponent* WalkerInstances = nullptr;
+
+	/** Cached cube mesh for walker visuals */
+	UPROPERTY()
+	class UStaticMesh* CachedCrewMesh = nullptr;
+
+	/** Advance every walker along its path and refresh the visuals */
+	void UpdateCrewWalking(float DeltaTime);
+
+	/** Pick a new destination and path for one walker */
+	void StartNewWalk(FCrewWalker& Walker, class UShipInteriorComponent* Interior);
+
+	/** Find or create the walker instance pool */
+	void EnsureWalkerVisuals();
+
+	/** Number of ECrewRole values, for the fixed aggregate arrays */
+	static constexpr int32 NumCrewRoles = 5;
+
+	/** Crew count per role */
+	int32 RoleCounts[NumCrewRoles] = {};
+
+	/** Summed role-relevant skill per role */
+	int32 RoleSkillTotals[NumCrewRoles] = {};
+
+	/** Summed morale of all crew */
+	float TotalMorale = 0.0f;
+
+	/** Summed salary per hour of all crew */
+	int32 TotalSalaryPerHour = 0;
+
+	/** Batched morale normalization timer */
+	float MoraleTimer = 0.0f;
+
 	/** Salary payment timer */
 	float SalaryTimer = 0.0f;
 };
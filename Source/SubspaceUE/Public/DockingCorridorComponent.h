@@ -0,0 +1,98 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "DockingCorridorComponent.generated.h"
+
+/**
+ * One precomputed approach path from an entry point outside the station
+ * to the berth. Internal to the component; ships only see control points.
+ */
+struct FDockingCorridor
+{
+	/** World-space spline control points, entry first, berth last */
+	TArray<FVector> ControlPoints;
+
+	/** Ship currently flying (or queued on) this corridor */
+	TWeakObjectPtr<AActor> ClaimedBy;
+
+	/** Corridor failed geometry validation at bake time; never handed out */
+	bool bBlocked = false;
+};
+
+/**
+ * Station-side docking corridor publisher. At BeginPlay the component
+ * bakes a small fan of approach corridors from entry points around the
+ * berth axis down to the berth, and validates each against station
+ * geometry exactly once with line traces. Docking ships acquire a free
+ * corridor and fly it as a precomputed trajectory - the most
+ * obstacle-dense volume in the game is navigated with zero per-tick
+ * avoidance queries, and queued ships hold distinct corridors instead
+ * of all steering reactively at the same berth.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SUBSPACEUE_API UDockingCorridorComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UDockingCorridorComponent();
+
+protected:
+	virtual void BeginPlay() override;
+
+public:
+	/** Berth position in station local space */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	FVector BerthLocalOffset = FVector(0.0f, 0.0f, -200.0f);
+
+	/** Approach direction into the berth, station local space */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	FVector BerthApproachLocalDirection = FVector(0.0f, 0.0f, -1.0f);
+
+	/** Number of corridors fanned around the approach axis */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	int32 NumCorridors = 4;
+
+	/** Distance from the berth to corridor entry points */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	float EntryDistance = 5000.0f;
+
+	/** Length of the straight final approach leg into the berth */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	float FinalApproachDistance = 1000.0f;
+
+	/** Half-angle of the entry fan around the approach axis (degrees) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	float FanHalfAngle = 60.0f;
+
+	/** Speed ships fly corridors at */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Docking")
+	float ApproachSpeed = 500.0f;
+
+	/**
+	 * Claim the free corridor whose entry point is nearest the ship.
+	 * Returns the corridor control points (entry first, berth last) and
+	 * the approach speed; false when every valid corridor is taken.
+	 */
+	bool AcquireCorridor(AActor* Ship, const FVector& ShipLocation, TArray<FVector>& OutControlPoints, float& OutApproachSpeed);
+
+	/** Release the corridor a ship holds (docked, cancelled, or destroyed) */
+	void ReleaseCorridor(AActor* Ship);
+
+	/** Corridors that passed validation and are not currently claimed */
+	UFUNCTION(BlueprintCallable, Category = "Docking")
+	int32 GetFreeCorridorCount() const;
+
+protected:
+	/** Bake the corridor fan and validate each against station geometry */
+	void BuildCorridors();
+
+	/** Line-trace every segment of a corridor; true if the path is clear */
+	bool ValidateCorridor(const FDockingCorridor& Corridor) const;
+
+	/** Baked corridors, fixed after BeginPlay; only claims change */
+	TArray<FDockingCorridor> Corridors;
+};
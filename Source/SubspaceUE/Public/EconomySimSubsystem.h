@@ -0,0 +1,165 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "EconomySimSubsystem.generated.h"
+
+class UTradingComponent;
+
+/** Plain mirror of one ware definition, enough to simulate production */
+struct FSimWare
+{
+	/** Cargo space per unit */
+	float Volume = 1.0f;
+
+	/** Seconds to produce one unit */
+	float ProductionTime = 60.0f;
+
+	/** Required input wares per cycle */
+	TMap<FName, int32> InputWares;
+};
+
+/** Plain mirror of one station trade order */
+struct FSimTradeOrder
+{
+	/** Interned ware ID */
+	FName WareId;
+
+	/** true = station buys, false = station sells (and produces) */
+	bool bIsBuyOrder = true;
+
+	/** Don't trade below this stock */
+	int32 MinQuantity = 0;
+
+	/** Don't trade/produce above this stock */
+	int32 MaxQuantity = 1000;
+
+	/** Order is in effect */
+	bool bIsActive = true;
+
+	/** Sim time the current production cycle completes (sell orders) */
+	double ProductionDue = 0.0;
+};
+
+/**
+ * Plain-struct mirror of one station's economy state, detached from the
+ * UTradingComponent that spawned it
+ */
+struct FSimStation
+{
+	/** Owning actor's name, used to match the component on reattach */
+	FName StationId;
+
+	/** Dense ware index -> interned ware ID (mirrors UTradingComponent::WareIds) */
+	TArray<FName> WareIds;
+
+	/** Ware definitions needed for production */
+	TMap<FName, FSimWare> Wares;
+
+	/** Stock per dense ware index */
+	TArray<int32> Stock;
+
+	/** Cargo capacity */
+	int32 MaxCapacity = 10000;
+
+	/** Cargo space in use */
+	int32 CurrentUsed = 0;
+
+	/** Buy/sell orders; sell orders drive production */
+	TArray<FSimTradeOrder> Orders;
+};
+
+/** All detached stations of one sector plus the sector's sim clock */
+struct FSimSector
+{
+	/** Detached station states */
+	TArray<FSimStation> Stations;
+
+	/** Seconds of simulation this sector has received */
+	double SimTime = 0.0;
+
+	/** Real time of the last simulation visit, to compute catch-up */
+	double LastVisitTime = 0.0;
+};
+
+/**
+ * Background economy simulation for unloaded sectors. Station stock,
+ * production and trade orders are mirrored into plain structs when a
+ * sector unloads and simulated without any actors, then written back to
+ * the trading components when the sector loads again. Sectors are
+ * visited round-robin with a per-tick budget, so fifty detached sectors
+ * cost a couple of cheap struct updates per frame rather than fifty
+ * sectors of ticking station actors.
+ */
+UCLASS()
+class SUBSPACEUE_API UEconomySimSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Sectors.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Mirror a station into the named sector's detached model. Call for
+	 * each station as its sector unloads; the component (and its actor)
+	 * can then be destroyed.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Economy")
+	void DetachStation(FName SectorId, UTradingComponent* Station);
+
+	/**
+	 * Write a detached station's simulated state back into a live
+	 * component and drop the mirror. Call after the sector has loaded
+	 * and the station's BeginPlay has run. Returns false if the sector
+	 * holds no mirror for the component's owner.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Economy")
+	bool ReattachStation(FName SectorId, UTradingComponent* Station);
+
+	/** Drop a whole sector's detached state without syncing it anywhere */
+	UFUNCTION(BlueprintCallable, Category = "Economy")
+	void DiscardSector(FName SectorId);
+
+	/** Stock of a ware at a detached station, or 0 if not mirrored */
+	UFUNCTION(BlueprintCallable, Category = "Economy")
+	int32 GetSimulatedStock(FName SectorId, FName StationId, FName WareId) const;
+
+	/** Number of sectors currently simulated in the background */
+	UFUNCTION(BlueprintCallable, Category = "Economy")
+	int32 GetDetachedSectorCount() const { return Sectors.Num(); }
+
+	/** Detached sectors advanced per tick (round-robin) */
+	UPROPERTY(EditAnywhere, Category = "Economy", meta = (ClampMin = "1"))
+	int32 SectorsPerTick = 2;
+
+protected:
+	/** Advance one sector's stations by DeltaSeconds of sim time */
+	void SimulateSector(FSimSector& Sector, double DeltaSeconds);
+
+	/** Whether the station can run one cycle of the order's ware right now */
+	bool CanProduce(const FSimStation& Station, const FSimTradeOrder& Order) const;
+
+	/** Stock of a ware at a sim station, by interned ID */
+	static int32 GetStock(const FSimStation& Station, FName WareId);
+
+	/** Add (or remove, negative) stock and keep CurrentUsed consistent */
+	static void AdjustStock(FSimStation& Station, FName WareId, int32 Delta);
+
+	/** Detached sectors by sector ID */
+	TMap<FName, FSimSector> Sectors;
+
+	/** Round-robin order of sector visits */
+	TArray<FName> SectorVisitOrder;
+
+	/** Next index into SectorVisitOrder */
+	int32 NextSectorVisit = 0;
+
+	/** Subsystem clock (seconds), shared by all sector catch-up math */
+	double CurrentTime = 0.0;
+};
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FlightDynamicsSubsystem.generated.h"
+
+/**
+ * Shared fixed-timestep flight integrator. Ships register their mass
+ * and drag once and feed thrust forces in; the subsystem integrates
+ * every registered ship in one cache-friendly structure-of-arrays loop
+ * at a fixed timestep, then writes interpolated transforms back to the
+ * actors for rendering. One tight loop replaces a virtual Tick dispatch
+ * per ship, and the fixed step makes the simulation frame-rate
+ * independent and deterministic for a given input sequence.
+ */
+UCLASS()
+class SUBSPACEUE_API UFlightDynamicsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Register a ship with its flight parameters; idempotent */
+	UFUNCTION(BlueprintCallable, Category = "Flight")
+	void RegisterShip(AActor* Ship, float Mass, float DragCoefficient);
+
+	/** Remove a ship from the integrator */
+	UFUNCTION(BlueprintCallable, Category = "Flight")
+	void UnregisterShip(AActor* Ship);
+
+	/** Accumulate a world-space force on a ship for this frame */
+	UFUNCTION(BlueprintCallable, Category = "Flight")
+	void AddForce(AActor* Ship, const FVector& WorldForce);
+
+	/** Current integrated velocity of a ship (zero if unregistered) */
+	UFUNCTION(BlueprintCallable, Category = "Flight")
+	FVector GetShipVelocity(AActor* Ship) const;
+
+	/** Hard-set a ship's velocity (emergency brake, docking, teleport) */
+	UFUNCTION(BlueprintCallable, Category = "Flight")
+	void SetShipVelocity(AActor* Ship, const FVector& NewVelocity);
+
+	/** Re-read a ship's position after an external teleport */
+	UFUNCTION(BlueprintCallable, Category = "Flight")
+	void SyncShipTransform(AActor* Ship);
+
+	/** Fixed integration timestep in seconds */
+	UPROPERTY(EditAnywhere, Category = "Flight", meta = (ClampMin = "0.004", ClampMax = "0.1"))
+	float FixedTimestep = 1.0f / 60.0f;
+
+protected:
+	/** Advance every ship by one fixed step */
+	void StepSimulation(float StepSeconds);
+
+	/** Drop entries whose actors are gone */
+	void CompactRegistry();
+
+	/** Registered ship actors; index-parallel with the SoA arrays below */
+	TArray<TWeakObjectPtr<AActor>> Ships;
+
+	/** Integrated position per ship (current step) */
+	TArray<FVector> Positions;
+
+	/** Integrated position per ship at the previous step, for interpolation */
+	TArray<FVector> PrevPositions;
+
+	/** Velocity per ship */
+	TArray<FVector> Velocities;
+
+	/** Accumulated thrust acceleration per ship, cleared each frame */
+	TArray<FVector> PendingAccelerations;
+
+	/** Mass per ship */
+	TArray<float> Masses;
+
+	/** Quadratic drag coefficient per ship */
+	TArray<float> DragCoefficients;
+
+	/** Ship actor -> array index */
+	TMap<TWeakObjectPtr<AActor>, int32> ShipIndexLookup;
+
+	/** Unconsumed simulation time */
+	float Accumulator = 0.0f;
+};
@@ -0,0 +1,113 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "InitSchedulerSubsystem.generated.h"
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnInitStageProgress, const FString&, StageName, float, Progress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnInitComplete);
+
+/** One registered initialization stage */
+struct FInitStage
+{
+	/** Unique stage name, used for dependencies and progress display */
+	FString Name;
+
+	/** Lower priorities run first (player-visible work goes early) */
+	int32 Priority = 0;
+
+	/** Names of stages that must complete before this one starts */
+	TArray<FString> Dependencies;
+
+	/** One increment of work; returns true when the stage is finished */
+	TFunction<bool()> Step;
+
+	/** Whether the stage has run to completion */
+	bool bComplete = false;
+};
+
+/**
+ * Timesliced world initialization scheduler. Setup work registers as
+ * named stages with a priority, optional dependencies, and a resumable
+ * step function; the scheduler runs steps each frame until a time
+ * budget is spent, so map load renders and responds while the world
+ * constructs instead of freezing through one monolithic BeginPlay.
+ * Progress is broadcast per completed stage for loading UI, and sector
+ * transitions (jump gates) can enqueue through the same scheduler to
+ * pace streamed-in content.
+ */
+UCLASS()
+class SUBSPACEUE_API UInitSchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/**
+	 * Per-frame setup time budget in milliseconds. At least one step
+	 * runs per frame regardless, so a single oversized step cannot
+	 * stall the schedule.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Init")
+	float FrameBudgetMs = 2.0f;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Register a stage. The step function is called repeatedly (one
+	 * increment of work per call) until it returns true; stages run in
+	 * priority order, never before their named dependencies complete.
+	 */
+	void EnqueueStage(const FString& Name, int32 Priority, TFunction<bool()> Step);
+
+	/** Register a stage that waits for the named stages to complete first */
+	void EnqueueStage(const FString& Name, int32 Priority, const TArray<FString>& Dependencies, TFunction<bool()> Step);
+
+	/** Whether any registered stage is still incomplete */
+	UFUNCTION(BlueprintCallable, Category = "Init")
+	bool IsInitializing() const { return Stages.Num() > 0; }
+
+	/** Fraction of registered stages completed (1 when idle) */
+	UFUNCTION(BlueprintCallable, Category = "Init")
+	float GetProgress() const;
+
+	/** Name of the stage that ran most recently, for loading UI */
+	UFUNCTION(BlueprintCallable, Category = "Init")
+	FString GetCurrentStageName() const { return CurrentStageName; }
+
+	/** Fired after each stage completes, with overall progress */
+	UPROPERTY(BlueprintAssignable, Category = "Init")
+	FOnInitStageProgress OnStageProgress;
+
+	/** Fired once every registered stage has completed */
+	UPROPERTY(BlueprintAssignable, Category = "Init")
+	FOnInitComplete OnInitComplete;
+
+protected:
+	/**
+	 * Lowest-priority incomplete stage whose dependencies are complete
+	 * (insertion order breaks ties). Null when everything runnable is
+	 * done; a dependency cycle falls back to plain priority order.
+	 */
+	FInitStage* PickRunnableStage();
+
+	/** All stages of the current initialization batch */
+	TArray<FInitStage> Stages;
+
+	/** Stages enqueued by a running step, merged after the tick loop */
+	TArray<FInitStage> PendingStages;
+
+	/** Whether Tick is currently running stage steps */
+	bool bTicking = false;
+
+	/** Completed stages in the current batch */
+	int32 CompletedStages = 0;
+
+	/** Most recently run stage name */
+	FString CurrentStageName;
+
+	/** Whether a dependency cycle warning was already logged this batch */
+	bool bWarnedCycle = false;
+};
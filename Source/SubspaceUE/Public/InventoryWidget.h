@@ -38,6 +38,33 @@ struct FResourceEntry
 	}
 };
 
+class UInventoryEntryItem;
+
+/** Fired when a ware entry's quantity or color changes */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnInventoryEntryChanged, UInventoryEntryItem*, Entry);
+
+/**
+ * List-view item object for one ware. Bind EntryItems to a UListView so
+ * only visible rows are instantiated and rows recycle on scroll; each
+ * row widget subscribes to its item's OnChanged, so a single stock
+ * update re-renders exactly one row. Shared by the cargo inventory and
+ * the station trade menu.
+ */
+UCLASS(BlueprintType)
+class SUBSPACEUE_API UInventoryEntryItem : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	/** Displayed ware data */
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	FResourceEntry Entry;
+
+	/** Fired when this ware changes so only its bound row re-renders */
+	UPROPERTY(BlueprintAssignable, Category = "Inventory")
+	FOnInventoryEntryChanged OnChanged;
+};
+
 /**
  * Inventory widget for displaying resources and cargo
  */
@@ -47,10 +74,22 @@ class SUBSPACEUE_API UInventoryWidget : public UUserWidget
 	GENERATED_BODY()
 
 public:
-	/** Update inventory display with resources */
+	/**
+	 * Update inventory display with resources. Diffs against the current
+	 * entries and applies per-ware deltas, so a bulk refresh only
+	 * touches rows whose stock actually changed.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void UpdateInventory(const TArray<FResourceEntry>& Resources);
 
+	/**
+	 * Apply one ware's stock change. Quantity of zero removes the ware;
+	 * an unknown name adds it. Existing wares update their item object
+	 * in place and fire its OnChanged only.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Inventory")
+	void SetResourceQuantity(const FString& ResourceName, int32 Quantity, FColor ResourceColor);
+
 	/** Update cargo capacity display */
 	UFUNCTION(BlueprintCallable, Category = "Inventory")
 	void UpdateCargoCapacity(int32 CurrentCargo, int32 MaxCargo);
@@ -63,7 +102,23 @@ protected:
 	UFUNCTION(BlueprintImplementableEvent, Category = "Inventory")
 	void OnCargoCapacityUpdated(int32 CurrentCargo, int32 MaxCargo, float CargoPercent);
 
+	/** A ware appeared; add its item to the bound list view */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Inventory")
+	void OnEntryAdded(UInventoryEntryItem* Item);
+
+	/** A ware ran out; remove its item from the bound list view */
+	UFUNCTION(BlueprintImplementableEvent, Category = "Inventory")
+	void OnEntryRemoved(UInventoryEntryItem* Item);
+
 protected:
+	/** Item objects for the virtualized list, one per ware in stock */
+	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
+	TArray<TObjectPtr<UInventoryEntryItem>> EntryItems;
+
+	/** Ware name to EntryItems index */
+	TMap<FString, int32> EntryIndexLookup;
+
+	/** Legacy full snapshot kept for Blueprints still reading it */
 	UPROPERTY(BlueprintReadOnly, Category = "Inventory")
 	TArray<FResourceEntry> CachedResources;
 
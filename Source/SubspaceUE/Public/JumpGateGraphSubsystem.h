@@ -0,0 +1,107 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "NavigationComponent.h"
+#include "JumpGateGraphSubsystem.generated.h"
+
+/**
+ * One leg of a planned cross-sector route: take the named gate in
+ * FromSector to arrive in ToSector
+ */
+USTRUCT(BlueprintType)
+struct FRouteHop
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Route")
+	FName FromSector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Route")
+	FName ToSector;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Route")
+	FString GateName;
+
+	/** Gate location within FromSector, for autopilot waypoints */
+	UPROPERTY(BlueprintReadOnly, Category = "Route")
+	FVector GateLocation = FVector::ZeroVector;
+};
+
+/** Directed gate edge in the universe graph */
+struct FGateEdge
+{
+	/** Sector the gate leads to */
+	FName ToSector;
+
+	/** Gate name, matches FJumpGateData::GateName */
+	FString GateName;
+
+	/** Gate location within the source sector */
+	FVector GateLocation = FVector::ZeroVector;
+
+	/** Edge weight: approximate seconds to reach and traverse the gate */
+	float TraversalTime = 60.0f;
+
+	/** Locked gates stay in the graph but are skipped by routing */
+	bool bLocked = false;
+};
+
+/**
+ * Universe jump gate graph. Sectors are nodes and gates are edges
+ * weighted by traversal time; shortest-path tables are computed per
+ * source sector on first use and cached, so hundreds of AI traders
+ * asking for routes share one Dijkstra per source instead of running
+ * their own. Locking or unlocking a gate invalidates the cache, which
+ * lazily rebuilds on the next PlanRoute call.
+ */
+UCLASS()
+class SUBSPACEUE_API UJumpGateGraphSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Add one sector's gates to the graph (call during universe setup) */
+	UFUNCTION(BlueprintCallable, Category = "Route")
+	void RegisterSectorGates(FName SectorId, const TArray<FJumpGateData>& Gates);
+
+	/** Lock or unlock a gate; routing tables refresh lazily */
+	UFUNCTION(BlueprintCallable, Category = "Route")
+	void SetGateLocked(FName SectorId, const FString& GateName, bool bLocked);
+
+	/**
+	 * Shortest gate chain from one sector to another. Empty if the
+	 * sectors are identical, unknown, or no unlocked path exists.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Route")
+	TArray<FRouteHop> PlanRoute(FName FromSector, FName ToSector);
+
+	/** Total traversal time of the cached route, or -1 if unreachable */
+	UFUNCTION(BlueprintCallable, Category = "Route")
+	float GetRouteTime(FName FromSector, FName ToSector);
+
+protected:
+	/** Cached Dijkstra result for one source sector */
+	struct FRouteTable
+	{
+		/** Shortest known time from the source to each sector */
+		TMap<FName, float> Time;
+
+		/** Predecessor sector on the shortest path */
+		TMap<FName, FName> PrevSector;
+	};
+
+	/** Run Dijkstra from the source sector, or return the cached table */
+	const FRouteTable& GetRouteTable(FName FromSector);
+
+	/** Unlocked edge from one sector toward a neighbour, if any */
+	const FGateEdge* FindEdge(FName FromSector, FName ToSector) const;
+
+	/** Outgoing gate edges per sector */
+	TMap<FName, TArray<FGateEdge>> Adjacency;
+
+	/** Cached per-source routing tables; cleared on any gate change */
+	TMap<FName, FRouteTable> RouteTables;
+};
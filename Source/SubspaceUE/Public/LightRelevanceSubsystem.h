@@ -0,0 +1,99 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "LightRelevanceSubsystem.generated.h"
+
+class ASpaceLightingActor;
+class ULightComponent;
+
+/**
+ * Lighting relevance manager. In space one sun dominates and local
+ * lights (station floodlights, engine glows) only matter nearby, so
+ * every ASpaceLightingActor registers here and the manager keeps just
+ * the K nearest/brightest relevant to the camera lit. Lights leaving
+ * the relevant set fade out and go invisible rather than popping off;
+ * a score bonus for lights already in the set adds hysteresis at the
+ * boundary. Sun actors mark themselves always relevant and are never
+ * touched. The actors themselves never tick - the manager owns all
+ * fading.
+ */
+UCLASS()
+class SUBSPACEUE_API ULightRelevanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Number of managed lights kept lit at once */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+	int32 MaxRelevantLights = 8;
+
+	/** Seconds between relevance re-rankings */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+	float RankInterval = 0.5f;
+
+	/** Intensity-scale change per second while fading in or out */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+	float FadeSpeed = 2.0f;
+
+	/**
+	 * Score multiplier for lights already relevant. A challenger must
+	 * beat an incumbent by this margin to evict it, which stops lights
+	 * near the cutoff from popping in and out as the camera drifts.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+	float HysteresisBonus = 1.25f;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Add a lighting actor to relevance management. Safe to call twice. */
+	void RegisterLight(ASpaceLightingActor* Light);
+
+	/** Remove a lighting actor from relevance management */
+	void UnregisterLight(ASpaceLightingActor* Light);
+
+	/** Number of managed lights currently lit or fading in */
+	UFUNCTION(BlueprintCallable, Category = "Lighting")
+	int32 GetRelevantLightCount() const;
+
+protected:
+	/** Tracking state for one managed lighting actor */
+	struct FManagedLight
+	{
+		/** The registered actor */
+		TWeakObjectPtr<ASpaceLightingActor> Actor;
+
+		/** Light components found on the actor at registration */
+		TArray<TWeakObjectPtr<ULightComponent>> LightComponents;
+
+		/** Authored intensity of each component, index-parallel */
+		TArray<float> BaseIntensities;
+
+		/** Summed authored intensity, used for brightness scoring */
+		float TotalBaseIntensity = 0.0f;
+
+		/** Current intensity scale (0 = dark, 1 = full) */
+		float CurrentScale = 1.0f;
+
+		/** Scale the fade is moving toward */
+		float TargetScale = 1.0f;
+
+		/** In the relevant set after the last ranking */
+		bool bRelevant = true;
+	};
+
+	/** Re-rank managed lights against the camera and retarget fades */
+	void RankLights();
+
+	/** Advance fades and push intensity scales into the components */
+	void UpdateFades(float DeltaTime);
+
+	/** Managed lights; stale entries are compacted during ranking */
+	TArray<FManagedLight> ManagedLights;
+
+	/** Counts down to the next ranking pass */
+	float RankTimer = 0.0f;
+};
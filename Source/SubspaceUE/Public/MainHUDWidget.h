@@ -101,4 +101,45 @@ protected:
 
 	UPROPERTY(BlueprintReadOnly, Category = "HUD")
 	FVector CachedPosition;
+
+	// Values as last displayed (rounded to display precision). Update*
+	// calls that round to the same numbers skip formatting and the
+	// Blueprint event entirely, so per-frame callers with unchanged
+	// state cost a compare and nothing else.
+
+	/** Health as last displayed */
+	int32 DisplayedHealth = MIN_int32;
+
+	/** Max health as last displayed */
+	int32 DisplayedMaxHealth = MIN_int32;
+
+	/** Shield as last displayed */
+	int32 DisplayedShield = MIN_int32;
+
+	/** Max shield as last displayed */
+	int32 DisplayedMaxShield = MIN_int32;
+
+	/** Energy as last displayed */
+	int32 DisplayedEnergy = MIN_int32;
+
+	/** Max energy as last displayed */
+	int32 DisplayedMaxEnergy = MIN_int32;
+
+	/** Speed as last displayed */
+	int32 DisplayedSpeed = MIN_int32;
+
+	/** Max speed as last displayed */
+	int32 DisplayedMaxSpeed = MIN_int32;
+
+	/** Velocity as last displayed */
+	FIntVector DisplayedVelocity = FIntVector(MIN_int32);
+
+	/** Position as last displayed */
+	FIntVector DisplayedPosition = FIntVector(MIN_int32);
+
+	/** Target name as last displayed */
+	FString DisplayedTargetName;
+
+	/** Target distance as last displayed */
+	int32 DisplayedTargetDistance = MIN_int32;
 };
@@ -76,16 +76,33 @@ struct FNavigationWaypoint
 	FString WaypointName = TEXT("Waypoint");
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waypoint")
-	AActor* TargetActor = nullptr;  // Follow this actor if set
+	TWeakObjectPtr<AActor> TargetActor;  // Follow this actor if set
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waypoint")
 	float ArrivalRadius = 100.0f;  // Consider arrived within this distance
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waypoint")
 	bool bUseTravelDrive = false;  // Use travel drive for this waypoint
-	
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Waypoint")
 	bool bDockOnArrival = false;  // Attempt to dock when arriving
+
+	// Target-tracking state maintained by UNavigationComponent. The
+	// target transform is sampled on a timer, not read every frame;
+	// between samples Location is dead-reckoned from the estimated
+	// velocity.
+
+	/** Target position at the last sample */
+	FVector SampledTargetLocation = FVector::ZeroVector;
+
+	/** Target velocity estimated from the last two samples */
+	FVector SampledTargetVelocity = FVector::ZeroVector;
+
+	/** Seconds since the target was last sampled */
+	float TimeSinceTargetSample = 0.0f;
+
+	/** At least one sample has been taken (the first seeds velocity at zero) */
+	bool bHasTargetSample = false;
 };
 
 /**
@@ -133,6 +150,52 @@ struct FHighwayData
 	int32 MaxShipSize = 2;  // 1=S, 2=M (L/XL can't use local highways)
 };
 
+/**
+ * Precomputed parametric trajectory for travel drive runs and highway
+ * rides. Built once on entry (spline sampled into an arc-length table),
+ * then each tick is a constant-time evaluation at the current distance
+ * along the path - no steering, no physics. Off-screen ships can be
+ * fast-forwarded analytically by advancing the distance.
+ */
+struct FNavTrajectory
+{
+	/** Sampled path points */
+	TArray<FVector> SamplePoints;
+
+	/** Arc length from the start to each sample point */
+	TArray<float> CumulativeLength;
+
+	/** Total path length */
+	float TotalLength = 0.0f;
+
+	/** Travel speed along the path */
+	float Speed = 0.0f;
+
+	/** Current distance along the path */
+	float DistanceAlong = 0.0f;
+
+	/** A trajectory is being flown */
+	bool bActive = false;
+
+	/** Sample a Catmull-Rom spline through the control points */
+	void BuildFromSpline(const TArray<FVector>& ControlPoints, float InSpeed);
+
+	/** Straight-line trajectory (travel drive runs) */
+	void BuildStraightLine(const FVector& Start, const FVector& End, float InSpeed);
+
+	/** Position at a distance along the path */
+	FVector Evaluate(float Distance) const;
+
+	/** Unit tangent at a distance along the path */
+	FVector TangentAt(float Distance) const;
+
+	/** Whether the end of the path has been reached */
+	bool IsComplete() const { return DistanceAlong >= TotalLength; }
+};
+
+/** Fired when a followed waypoint target is destroyed and the waypoint is dropped */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnWaypointInvalidated, const FString&, WaypointName);
+
 /**
  * Component that manages ship navigation and travel modes
  * X4-style travel system with boost, travel drive, autopilot, and highways
@@ -199,6 +262,31 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Navigation")
 	float BoostSpeedMultiplier = 2.0f;
 
+	/** Travel drive cruise speed along the precomputed run */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Navigation")
+	float TravelDriveCruiseSpeed = 7000.0f;
+
+	/**
+	 * Seconds between steering decision updates (waypoint evaluation and
+	 * avoidance queries). Between decisions the ship flies its cached
+	 * steering solution, so this can be generous for NPC ships.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Navigation")
+	float SteeringDecisionInterval = 0.25f;
+
+	/**
+	 * Seconds between target transform samples when a waypoint follows an
+	 * actor (0.25 = 4 Hz). Between samples the waypoint dead-reckons from
+	 * the estimated target velocity, so hundreds of escort orders do not
+	 * mean hundreds of cross-actor transform reads per frame.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Navigation")
+	float TargetSampleInterval = 0.25f;
+
+	/** Broadcast when a followed target dies and its waypoint is dropped */
+	UPROPERTY(BlueprintAssignable, Category = "Navigation")
+	FOnWaypointInvalidated OnWaypointInvalidated;
+
 	// ===== Travel Mode Control =====
 
 	/** Set travel mode */
@@ -251,6 +339,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Navigation")
 	float GetDistanceToWaypoint() const;
 
+	/** Cached steering direction (unit vector) for movement code to fly */
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	FVector GetSteeringDirection() const { return CachedSteeringDirection; }
+
 	// ===== Flight Assist =====
 
 	/** Toggle auto roll */
@@ -283,10 +375,22 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Navigation")
 	bool EnterHighway();
 
+	/** Enter a specific highway and ride its precomputed trajectory */
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	bool EnterHighwayRoute(const FHighwayData& Highway);
+
 	/** Exit highway */
 	UFUNCTION(BlueprintCallable, Category = "Navigation")
 	void ExitHighway();
 
+	/** Advance an active trajectory analytically (off-screen fast-forward) */
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	void FastForwardTravel(float Seconds);
+
+	/** Progress along the active trajectory (0-1), or 0 if none */
+	UFUNCTION(BlueprintCallable, Category = "Navigation")
+	float GetTrajectoryProgress() const;
+
 	/** Check if near jump gate */
 	UFUNCTION(BlueprintCallable, Category = "Navigation")
 	bool IsNearJumpGate(float MaxDistance = 500.0f) const;
@@ -317,6 +421,13 @@ protected:
 	/** Update autopilot navigation */
 	void UpdateAutopilot(float DeltaTime);
 
+	/**
+	 * Keep a target-following waypoint's Location fresh: resample the
+	 * target transform when the sample timer elapses, dead-reckon in
+	 * between, and report whether the target is still alive.
+	 */
+	bool UpdateTargetTracking(FNavigationWaypoint& Waypoint, float DeltaTime);
+
 	/** Update travel drive charging */
 	void UpdateTravelDrive(float DeltaTime);
 
@@ -326,8 +437,20 @@ protected:
 	/** Apply flight assist forces */
 	void ApplyFlightAssist(float DeltaTime);
 
-	/** Check and avoid collisions */
-	void UpdateCollisionAvoidance(float DeltaTime);
+	/**
+	 * Expensive steering decision: re-aim at the waypoint, decide travel
+	 * drive use, and query the spatial partition for obstacles. Returns
+	 * false if the sector-wide avoidance query budget was exhausted this
+	 * frame, in which case the cached solution stays and we retry next
+	 * frame.
+	 */
+	bool UpdateSteeringDecision();
+
+	/** Query obstacles ahead and refresh the cached avoidance correction */
+	void UpdateCollisionAvoidance(const FVector& DesiredDirection);
+
+	/** Advance the active trajectory and place the ship on it */
+	void UpdateTrajectory(float DeltaTime);
 
 	/** Get next waypoint */
 	FNavigationWaypoint* GetCurrentWaypoint();
@@ -338,6 +461,27 @@ protected:
 	/** Timer for travel drive charging */
 	float TravelDriveTimer = 0.0f;
 
+	/** Last steering solution; flown every frame between decisions */
+	FVector CachedSteeringDirection = FVector::ForwardVector;
+
+	/** Last avoidance correction, blended into the steering direction */
+	FVector CachedAvoidanceCorrection = FVector::ZeroVector;
+
+	/** Counts down to the next steering decision; staggered per ship */
+	float SteeringDecisionTimer = 0.0f;
+
+	/** Spatial partition used for avoidance queries, cached on BeginPlay */
+	TWeakObjectPtr<class USpatialPartitionSubsystem> SpatialPartition;
+
+	/** Trajectory being flown in TravelDrive or Highway mode, or a docking corridor */
+	FNavTrajectory ActiveTrajectory;
+
+	/**
+	 * Station corridor publisher the active docking trajectory was
+	 * acquired from; the corridor is released on completion or cancel.
+	 */
+	TWeakObjectPtr<class UDockingCorridorComponent> ActiveCorridorSource;
+
 	/** Currently docked station */
 	UPROPERTY()
 	AActor* DockedStation = nullptr;
@@ -6,6 +6,8 @@
 #include "SpaceActor.h"
 #include "PlanetActor.generated.h"
 
+class UPlanetSurfaceComponent;
+
 /**
  * Planet actor that orbits around a central point (sun) with configurable orbital parameters
  * Supports elliptical orbits with real-world astronomical data
@@ -68,6 +70,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet|Debug")
 	bool bShowOrbitPath;
 
+	/**
+	 * When true, orbit position comes from ASolarSystemManager's batched
+	 * solver and Tick skips the per-actor Kepler solve. Set by the manager
+	 * when it takes ownership of this planet's orbit.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Planet|Orbit")
+	bool bOrbitDrivenBySolver;
+
+	/** Quadtree LOD surface streamed in when the camera approaches */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Planet|Surface")
+	UPlanetSurfaceComponent* Surface;
+
 	/** Planet diameter in kilometers (for display purposes) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet|Info")
 	double DiameterKm;
@@ -108,6 +122,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Planet|Orbit")
 	void SetOrbitPosition(double NormalizedPosition);
 
+	/** Force the cached orbit path to be recomputed on the next tick */
+	UFUNCTION(BlueprintCallable, Category = "Planet|Debug")
+	void InvalidateOrbitPath() { bOrbitPathDirty = true; }
+
 private:
 	/** Current time elapsed in the simulation */
 	double ElapsedTime;
@@ -118,8 +136,32 @@ private:
 	/** Solve Kepler's equation to get eccentric anomaly from mean anomaly */
 	double SolveKeplersEquation(double MeanAnomaly) const;
 
-	/** Draw debug orbit visualization */
-	void DrawOrbitPath() const;
+	/** Persistent line batch holding the cached orbit polyline */
+	UPROPERTY(Transient)
+	class ULineBatchComponent* OrbitLineBatch;
+
+	/** Whether the cached orbit path needs recomputing */
+	bool bOrbitPathDirty;
+
+	/** Whether the orbit path is currently submitted to the line batch */
+	bool bOrbitPathSubmitted;
+
+	// Orbital element values the cached path was built from; a change in
+	// any of them invalidates the cache
+
+	double CachedSemiMajorAxis;
+	double CachedEccentricity;
+	double CachedInclination;
+	double CachedLongitudeOfAscendingNode;
+	double CachedArgumentOfPeriapsis;
+	FVector CachedOrbitCenter;
+
+	/**
+	 * Rebuild the orbit polyline and re-submit it to the line batch if
+	 * the orbital elements changed; otherwise the batch keeps rendering
+	 * the existing lines at no per-frame cost.
+	 */
+	void UpdateOrbitPath();
 
 	/** Update axial rotation */
 	void UpdateRotation(float DeltaTime);
@@ -0,0 +1,156 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/ActorComponent.h"
+#include "PlanetSurfaceComponent.generated.h"
+
+class UProceduralMeshComponent;
+
+/**
+ * Quadtree key for one cube-sphere surface patch: a face of the cube
+ * and a cell in that face's grid at a subdivision level.
+ */
+struct FPlanetPatchKey
+{
+	/** Cube face (0..5) */
+	uint8 Face = 0;
+
+	/** Quadtree depth; level L splits the face into 2^L x 2^L patches */
+	uint8 Level = 0;
+
+	/** Cell coordinates within the face at this level */
+	uint16 X = 0;
+	uint16 Y = 0;
+
+	bool operator==(const FPlanetPatchKey& Other) const
+	{
+		return Face == Other.Face && Level == Other.Level && X == Other.X && Y == Other.Y;
+	}
+
+	friend uint32 GetTypeHash(const FPlanetPatchKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.Face), GetTypeHash(Key.Level)),
+			HashCombine(GetTypeHash(Key.X), GetTypeHash(Key.Y)));
+	}
+};
+
+/** Generated geometry for one surface patch, built off the game thread */
+struct FPlanetPatchMesh
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+};
+
+/**
+ * Cube-sphere quadtree LOD surface for planets. Six root faces split
+ * into patches by camera distance, so an approach streams in detail
+ * where the camera looks while the far side stays coarse. Patch
+ * geometry is generated on thread-pool tasks and applied to pooled
+ * procedural mesh sections; each patch carries a skirt ring pulled
+ * toward the planet center so cracks between neighboring LOD levels
+ * never show. The surface activates within ActivationDistance radii of
+ * the planet and releases everything (restoring the base sphere mesh)
+ * beyond it.
+ *
+ * Geometry is built in local space at FixedLocalRadius, matching the
+ * engine sphere the solar system manager scales planets with - actor
+ * scale turns it into planet size, and LOD decisions transform the
+ * camera into local space so they account for that scale.
+ */
+UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
+class SUBSPACEUE_API UPlanetSurfaceComponent : public UActorComponent
+{
+	GENERATED_BODY()
+
+public:
+	UPlanetSurfaceComponent();
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+
+	/** Verts per patch edge (plus one row of skirt verts per side) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Surface")
+	int32 PatchResolution = 16;
+
+	/** Deepest subdivision level */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Surface")
+	int32 MaxDepth = 6;
+
+	/** A patch splits while the camera is within this many patch sizes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Surface")
+	float SplitFactor = 3.0f;
+
+	/** Surface LOD engages within this many planet radii of the camera */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Surface")
+	float ActivationDistance = 20.0f;
+
+	/** Seconds between LOD selection passes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Surface")
+	float SelectionInterval = 0.25f;
+
+	/** Patch builds allowed in flight at once (streaming throttle) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Planet Surface")
+	int32 MaxPendingPatches = 8;
+
+	/** Number of patches currently meshed */
+	UFUNCTION(BlueprintCallable, Category = "Planet Surface")
+	int32 GetActivePatchCount() const { return ActivePatches.Num(); }
+
+	/** Local-space sphere radius patches are built at (engine sphere radius) */
+	static constexpr float FixedLocalRadius = 50.0f;
+
+protected:
+	/** Walk the quadtree against the camera and rebuild the desired set */
+	void UpdatePatchSelection(const FVector& LocalCameraPosition);
+
+	/** Recursive quadtree descent for one node */
+	void SelectPatches(const FPlanetPatchKey& Node, const FVector& LocalCameraPosition, TSet<FPlanetPatchKey>& OutDesired) const;
+
+	/** Center of a patch on the sphere, local space */
+	static FVector PatchCenter(const FPlanetPatchKey& Key);
+
+	/** Kick an async build for a patch */
+	void RequestPatch(const FPlanetPatchKey& Key);
+
+	/** Apply a finished patch mesh on the game thread */
+	void ApplyPatch(const FPlanetPatchKey& Key, FPlanetPatchMesh&& Mesh);
+
+	/** Return a patch's mesh section to the pool */
+	void ReleasePatch(const FPlanetPatchKey& Key);
+
+	/** Drop every patch and pending build, restoring the base mesh */
+	void ReleaseAllPatches();
+
+	/** Build a patch's geometry; pure function, safe off the game thread */
+	static void BuildPatchMesh(const FPlanetPatchKey& Key, int32 Resolution, FPlanetPatchMesh& OutMesh);
+
+	/** Lazily create the procedural mesh that holds patch sections */
+	UProceduralMeshComponent* GetOrCreateSurfaceMesh();
+
+	/** Procedural mesh carrying one section per active patch */
+	UPROPERTY(Transient)
+	UProceduralMeshComponent* SurfaceMesh = nullptr;
+
+	/** Section index per active patch */
+	TMap<FPlanetPatchKey, int32> ActivePatches;
+
+	/** Patches with a build in flight */
+	TSet<FPlanetPatchKey> PendingPatches;
+
+	/** Desired set from the last selection pass */
+	TSet<FPlanetPatchKey> DesiredPatches;
+
+	/** Recycled mesh section indices */
+	TArray<int32> FreeSections;
+
+	/** Next never-used section index */
+	int32 NextSectionIndex = 0;
+
+	/** Counts down to the next selection pass */
+	float SelectionTimer = 0.0f;
+
+	/** Surface LOD currently engaged (base sphere hidden) */
+	bool bSurfaceActive = false;
+};
@@ -0,0 +1,70 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "ProductionSchedulerSubsystem.generated.h"
+
+class UTradingComponent;
+
+/** A scheduled "production cycle completes" event for one station/ware pair */
+struct FProductionEvent
+{
+	/** Scheduler time (seconds) at which the cycle completes */
+	double DueTime = 0.0;
+
+	/** Producing station */
+	TWeakObjectPtr<UTradingComponent> Station;
+
+	/** Ware being produced */
+	FName WareId;
+};
+
+/**
+ * Event-driven production scheduler. Stations do not tick production;
+ * instead each producible station/ware pair has one completion event in
+ * a time-ordered heap. A station with a 60-second production time costs
+ * one heap pop per minute instead of sixty timer ticks, and a station
+ * that cannot produce (missing inputs, full storage) costs nothing at
+ * all until its storage changes and it re-schedules.
+ */
+UCLASS()
+class SUBSPACEUE_API UProductionSchedulerSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return EventQueue.Num() > 0; }
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Schedule completion events for every active sell order of the
+	 * station that can currently produce and is not already scheduled.
+	 * Call whenever the station's storage or orders change; already-
+	 * scheduled wares are skipped, so repeated calls are cheap.
+	 */
+	void ScheduleStationProduction(UTradingComponent* Station);
+
+	/** Drop all scheduled events for a station (lazily, on pop) */
+	void CancelStationProduction(UTradingComponent* Station);
+
+protected:
+	/** Whether the station can currently run a production cycle of the ware */
+	bool CanProduce(const UTradingComponent* Station, FName WareId) const;
+
+	/** Complete one production cycle and re-schedule if still producible */
+	void CompleteProduction(const FProductionEvent& Event);
+
+	/** Min-heap of pending completion events, ordered by DueTime */
+	TArray<FProductionEvent> EventQueue;
+
+	/** Wares with a pending event per station, to keep events unique */
+	TMap<TWeakObjectPtr<UTradingComponent>, TSet<FName>> ScheduledWares;
+
+	/** Scheduler clock (seconds since subsystem creation) */
+	double CurrentTime = 0.0;
+};
@@ -0,0 +1,97 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ProjectileSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UStaticMesh;
+
+/**
+ * Pooled projectile simulation for weapon fire. Actor spawns cost
+ * 0.1-1 ms each and fleet battles generate hundreds of shots per
+ * second, so projectiles are not actors: they live in preallocated
+ * structure-of-arrays buffers, advance in one batched update per frame,
+ * resolve hits against the sector spatial partition (refined by the
+ * target's voxel raycast when it has one), and render as instances of
+ * a single instanced static mesh rather than per-shot actor meshes.
+ */
+UCLASS()
+class SUBSPACEUE_API UProjectileSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Slots reserved up front; firing past capacity recycles the oldest shot */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Projectiles")
+	int32 PoolCapacity = 2048;
+
+	/** Distance at which a projectile registers a hit on a candidate actor */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles")
+	float HitRadius = 400.0f;
+
+	/** Mesh for the shared instanced visuals; unset means simulate only */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Projectiles")
+	TObjectPtr<UStaticMesh> ProjectileMesh;
+
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/**
+	 * Launch a pooled projectile. Direction is normalized internally;
+	 * the shot expires after travelling Range and never hits its own
+	 * instigator.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Projectiles")
+	void FireProjectile(AActor* InInstigator, const FVector& Location, const FVector& Direction,
+		float Speed, float Damage, float Range);
+
+	/** Number of live projectiles */
+	UFUNCTION(BlueprintCallable, Category = "Projectiles")
+	int32 GetActiveProjectileCount() const { return Positions.Num(); }
+
+protected:
+	/** Resolve one projectile step against the partition; true on hit */
+	bool ResolveHit(int32 Index, const FVector& StepStart, const FVector& StepEnd);
+
+	/** Swap-remove a projectile from every packed array */
+	void RemoveProjectileAtIndex(int32 Index);
+
+	/** Lazily spawn the holder actor and instanced mesh for visuals */
+	void EnsureVisuals();
+
+	/** Push live projectile transforms into the instanced mesh */
+	void UpdateVisuals();
+
+	// Packed structure-of-arrays projectile state. Index-parallel; the
+	// batched update walks them front to back and swap-removes expired
+	// or hitting shots, so live entries stay contiguous.
+
+	/** World position per projectile */
+	TArray<FVector> Positions;
+
+	/** World velocity per projectile */
+	TArray<FVector> Velocities;
+
+	/** Damage applied on hit per projectile */
+	TArray<float> Damages;
+
+	/** Travel distance left before the shot expires */
+	TArray<float> RemainingRanges;
+
+	/** Firing actor per projectile; never hit by its own shots */
+	TArray<TWeakObjectPtr<AActor>> Instigators;
+
+	/** Fire order per projectile; the lowest value is the oldest live shot */
+	TArray<int32> FireSequences;
+
+	/** Sequence stamped on the next shot fired */
+	int32 NextFireSequence = 0;
+
+	/** Instanced mesh shared by every live projectile */
+	UPROPERTY(Transient)
+	TObjectPtr<UInstancedStaticMeshComponent> ProjectileInstances;
+};
@@ -0,0 +1,123 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataTable.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "X4ShipClass.h"
+#include "ShipClassRegistry.generated.h"
+
+/**
+ * Designer-authored ship class definition, one DataTable row per class.
+ * Raw tunables only - derived values are baked by UShipClassRegistry at
+ * startup, so tuning a ship is a table edit, not a C++ rebuild.
+ */
+USTRUCT(BlueprintType)
+struct FShipClassRow : public FTableRowBase
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ship Class")
+	EX4ShipClass ShipClass = EX4ShipClass::Corvette;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ship Class")
+	EX4DesignStyle DesignStyle = EX4DesignStyle::Balanced;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ship Class")
+	EX4ShipVariant Variant = EX4ShipVariant::Standard;
+
+	/** Raw stat block; Hull/Shield fields are the authored maxima */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ship Class")
+	FX4ShipStats Stats;
+};
+
+/**
+ * Fully-baked, immutable stat block for one ship class. Built once at
+ * startup; spawned ships reference it by registry index and copy only
+ * their mutable pools out of it.
+ */
+USTRUCT(BlueprintType)
+struct FBakedShipStats
+{
+	GENERATED_BODY()
+
+	/** Class identity from the source row */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	EX4ShipClass ShipClass = EX4ShipClass::Corvette;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	EX4DesignStyle DesignStyle = EX4DesignStyle::Balanced;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	EX4ShipVariant Variant = EX4ShipVariant::Standard;
+
+	/** Authored stats, maxima normalized (Hull = MaxHull, Shield = MaxShield) */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	FX4ShipStats Stats;
+
+	// Equipment-independent derived values, precomputed so per-ship code
+	// never divides or sums these again
+
+	/** Thrust over mass (m/s^2 at empty loadout) */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	float BaseAcceleration = 0.0f;
+
+	/** Thrust-to-weight ratio against standard gravity */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	float ThrustToWeight = 0.0f;
+
+	/** Combined hull plus shield effective health pool */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	float TotalDefensePool = 0.0f;
+
+	/** Net power margin (generation minus baseline consumption) */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	float PowerMargin = 0.0f;
+
+	/** Total weapon hardpoints (primary plus turret slots) */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship Class")
+	int32 TotalWeaponSlots = 0;
+};
+
+/**
+ * Immutable registry of baked ship classes, compiled once at startup
+ * from the ship class DataTable (falling back to built-in defaults when
+ * the table is absent). Ships hold a registry index and read the shared
+ * baked block instead of assembling stats per instance, so spawning a
+ * fleet is handle assignment, not stat computation.
+ */
+UCLASS()
+class SUBSPACEUE_API UShipClassRegistry : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Registry index for a class row name, or INDEX_NONE if unknown */
+	UFUNCTION(BlueprintCallable, Category = "Ship Class")
+	int32 FindShipClassIndex(FName ClassName) const;
+
+	/** Baked stats by registry index; out-of-range falls back to index 0 */
+	UFUNCTION(BlueprintCallable, Category = "Ship Class")
+	const FBakedShipStats& GetShipClass(int32 Index) const;
+
+	/** Number of registered ship classes */
+	UFUNCTION(BlueprintCallable, Category = "Ship Class")
+	int32 GetShipClassCount() const { return BakedClasses.Num(); }
+
+	/** Asset path the class table is loaded from */
+	static const TCHAR* ShipClassTablePath;
+
+protected:
+	/** Derive and append the baked block for one authored row */
+	void BakeClass(FName ClassName, const FShipClassRow& Row);
+
+	/** Baked stat blocks, ordered by registration */
+	UPROPERTY()
+	TArray<FBakedShipStats> BakedClasses;
+
+	/** Row name to registry index */
+	TMap<FName, int32> ClassIndexLookup;
+};
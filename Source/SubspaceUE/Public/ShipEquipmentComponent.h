@@ -190,6 +190,60 @@ struct FEquipmentSlot
 	FRotator MountRotation = FRotator::ZeroRotator;
 };
 
+/**
+ * Derived ship stats aggregated from installed equipment. Rebuilt only
+ * when the loadout changes, never per tick.
+ */
+USTRUCT(BlueprintType)
+struct FEquipmentStatModifiers
+{
+	GENERATED_BODY()
+
+	/** Summed damage x fire rate of all installed weapons */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalWeaponDPS = 0.0f;
+
+	/** Summed shield capacity of installed generators */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalShieldCapacity = 0.0f;
+
+	/** Summed shield regeneration per second */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalShieldRegenRate = 0.0f;
+
+	/** Best installed engine's travel-mode speed */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float MaxTravelSpeed = 0.0f;
+
+	/** Best installed engine's combat speed */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float MaxCombatSpeed = 0.0f;
+
+	/** Summed thrust multiplier of installed engines */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalAcceleration = 0.0f;
+
+	/** Summed power draw of all installed equipment */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalPowerConsumption = 0.0f;
+
+	/** Summed equipment mass */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalMass = 0.0f;
+
+	/** Summed cargo capacity bonus */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	int32 TotalCargoBonus = 0;
+
+	/** Summed mining power of installed tools */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float TotalMiningPower = 0.0f;
+
+	/** Longest installed scanner range */
+	UPROPERTY(BlueprintReadOnly, Category = "Equipment Stats")
+	float BestScanRange = 0.0f;
+};
+
 /**
  * Component that manages ship equipment (weapons, utilities, engines)
  * X4-style modular equipment system
@@ -232,10 +286,30 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	TArray<FEquipmentSlot> GetWeaponSlots() const;
 
-	/** Get total power consumption */
+	/** Get total power consumption (cached, O(1)) */
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	float GetTotalPowerConsumption() const;
 
+	/**
+	 * Aggregated stat modifiers of the installed loadout. Served from a
+	 * cache that is only rebuilt after Install/Remove/AddEquipmentSlot,
+	 * so the flight model and UI can query it every frame for free.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	const FEquipmentStatModifiers& GetStatModifiers() const;
+
+	/**
+	 * Fire the weapon in a slot through the pooled projectile subsystem.
+	 * Respects the weapon's fire rate and ammo; returns false while on
+	 * cooldown, out of ammo, or when the slot holds no weapon.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	bool FireWeapon(int32 SlotIndex, const FVector& Direction);
+
+	/** Fire every occupied weapon slot that is off cooldown */
+	UFUNCTION(BlueprintCallable, Category = "Equipment")
+	void FireAllWeapons(const FVector& Direction);
+
 	/** Setup default Ulysses equipment */
 	UFUNCTION(BlueprintCallable, Category = "Equipment")
 	void SetupUlyssesEquipment();
@@ -274,4 +348,26 @@ protected:
 	FEquipmentItem CreateCargoExtension(int32 Level = 1);
 	FEquipmentItem CreateDockingComputer(int32 Level = 1);
 	FEquipmentItem CreateScanner(int32 Level = 1);
+
+	/** Flag the stat cache stale and re-evaluate whether ticking is needed */
+	void MarkStatsDirty();
+
+	/** Walk the slots once and refill the stat cache */
+	void RebuildStatModifiers() const;
+
+	/** Enable ticking only while time-dependent equipment is installed */
+	void RefreshTickRequirement();
+
+	/**
+	 * World time each slot may fire again, keyed by slot index. World
+	 * time rather than a ticked countdown, so cooldowns cost nothing
+	 * while no one is shooting.
+	 */
+	TMap<int32, float> NextFireTimes;
+
+	/** Cached loadout aggregates; rebuilt lazily when dirty */
+	mutable FEquipmentStatModifiers CachedStatModifiers;
+
+	/** Cache is stale (loadout changed since last rebuild) */
+	mutable bool bStatsDirty = true;
 };
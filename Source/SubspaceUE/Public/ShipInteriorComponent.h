@@ -161,6 +161,52 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Interior")
 	void ClearInteriorMeshes();
 
+	/**
+	 * Tell the interior which cell the player occupies (INDEX_NONE for
+	 * none). Interactive objects in that cell are promoted to real
+	 * components for interaction; everything else stays instanced.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	void SetOccupiedCell(int32 CellIndex);
+
+	/** Index of the cell containing an owner-relative position, or INDEX_NONE */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	int32 FindCellContaining(const FVector& LocalPosition) const;
+
+	/**
+	 * Whether a cell is active (occupied or door-adjacent to the
+	 * occupied cell). Inactive cells are hidden and their logic should
+	 * be skipped.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	bool IsCellActive(int32 CellIndex) const { return VisibleCells.Contains(CellIndex); }
+
+	/** Rebuild door-based cell adjacency after editing Cells directly */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	void RebuildCellAdjacency();
+
+	/**
+	 * Bake the walkable navigation graph for the current layout: one node
+	 * per room center and per door, edges between nodes sharing a cell,
+	 * and all-pairs walk distances with a next-hop table. Rebuilt with
+	 * adjacency whenever the layout changes; path queries never search.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	void BakeNavigationGraph();
+
+	/**
+	 * Build a walk path between two owner-relative positions from the
+	 * baked graph: straight line within a room, otherwise door-to-door
+	 * via the cached next-hop table. Returns false when either endpoint
+	 * is outside every cell or no route exists.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	bool BuildCrewPath(const FVector& FromLocal, const FVector& ToLocal, TArray<FVector>& OutPathPoints) const;
+
+	/** Number of baked navigation nodes (0 until a layout is baked) */
+	UFUNCTION(BlueprintCallable, Category = "Interior")
+	int32 GetNavNodeCount() const { return NavNodes.Num(); }
+
 protected:
 	/** Generate cockpit/bridge room */
 	FInteriorCell GenerateCockpit();
@@ -174,10 +220,14 @@ protected:
 	/** Generate engine room */
 	FInteriorCell GenerateEngineRoom();
 
-	/** Array of spawned interior mesh components */
+	/** Array of spawned interior mesh components (room geometry) */
 	UPROPERTY()
 	TArray<class UStaticMeshComponent*> SpawnedMeshes;
 
+	/** One instanced mesh pool per object type (all crates share one) */
+	UPROPERTY()
+	TMap<EInteriorObjectType, class UInstancedStaticMeshComponent*> ObjectInstancePools;
+
 	/** Cached cube mesh for spawning */
 	UPROPERTY()
 	class UStaticMesh* CachedCubeMesh;
@@ -185,6 +235,74 @@ protected:
 	/** Spawn a room mesh (walls, floor, ceiling) */
 	void SpawnRoomMesh(const FInteriorCell& Cell);
 
-	/** Spawn an object mesh */
-	void SpawnObjectMesh(const FInteriorObject& Object, const FVector& CellOffset);
+	/** Add an object to its type's instance pool */
+	void AddObjectInstance(const FInteriorObject& Object, int32 CellIndex, int32 ObjectIndex);
+
+	/** Find or create the instance pool for an object type */
+	class UInstancedStaticMeshComponent* GetOrCreateInstancePool(EInteriorObjectType Type);
+
+	/** Bookkeeping for one placed object's instance */
+	struct FInteriorInstanceRef
+	{
+		/** Object type, selects the instance pool */
+		EInteriorObjectType Type = EInteriorObjectType::Chair;
+
+		/** Instance index within the pool */
+		int32 InstanceIndex = INDEX_NONE;
+
+		/** Owning cell index in Cells */
+		int32 CellIndex = INDEX_NONE;
+
+		/** Object index within the cell's PlacedObjects */
+		int32 ObjectIndex = INDEX_NONE;
+
+		/** Real component while promoted (player in the same cell) */
+		class UStaticMeshComponent* PromotedMesh = nullptr;
+	};
+
+	/** Promote one interactive object to a real component */
+	void PromoteInstance(FInteriorInstanceRef& Ref);
+
+	/** Collapse a promoted object back into its instance pool */
+	void DemoteInstance(FInteriorInstanceRef& Ref);
+
+	/** All placed object instances */
+	TArray<FInteriorInstanceRef> ObjectInstances;
+
+	/** Cell the player currently occupies, INDEX_NONE if outside */
+	int32 OccupiedCellIndex = INDEX_NONE;
+
+	/** Show only the occupied cell and its door-adjacent neighbours */
+	void UpdateInteriorVisibility();
+
+	/** Hide or restore one object's pool instance (no-op while promoted) */
+	void SetInstanceHidden(FInteriorInstanceRef& Ref, bool bHidden);
+
+	/** Cell index for each entry in SpawnedMeshes */
+	TArray<int32> SpawnedMeshCellIndex;
+
+	/** Door-adjacent neighbour cells per cell */
+	TArray<TArray<int32>> CellAdjacency;
+
+	/** One baked navigation node: a room center or a door */
+	struct FInteriorNavNode
+	{
+		/** Position in owner-local space */
+		FVector Position = FVector::ZeroVector;
+
+		/** Cells the node is reachable from (one for centers, every side for doors) */
+		TArray<int32> Cells;
+	};
+
+	/** All baked navigation nodes for the current layout */
+	TArray<FInteriorNavNode> NavNodes;
+
+	/** Flattened NxN all-pairs walk distances (MAX_flt = unreachable) */
+	TArray<float> NavDistances;
+
+	/** Flattened NxN next-node indices for path reconstruction */
+	TArray<int32> NavNextHop;
+
+	/** Cells currently rendered and running logic */
+	TSet<int32> VisibleCells;
 };
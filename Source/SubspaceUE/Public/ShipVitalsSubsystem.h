@@ -0,0 +1,88 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "ShipVitalsSubsystem.generated.h"
+
+/**
+ * Batched shield and energy regeneration for every ship in the sector.
+ * Ships register their capacities and regen rates once; the subsystem
+ * advances contiguous arrays of {shield, energy} in a single pass at a
+ * fixed cadence instead of each ship paying a virtual Tick for a
+ * four-instruction clamp-and-add. The subsystem is authoritative:
+ * damage and consumption route through DrainShield/ConsumeEnergy, and
+ * actors mirror the values back for Blueprint/HUD on their own tick.
+ */
+UCLASS()
+class SUBSPACEUE_API UShipVitalsSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Register a ship's vitals; idempotent */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	void RegisterShip(AActor* Ship, float MaxShield, float ShieldRegenRate,
+		float MaxEnergy, float EnergyRegenRate, float InitialShield, float InitialEnergy);
+
+	/** Remove a ship from the batch */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	void UnregisterShip(AActor* Ship);
+
+	/** Current shield strength (zero if unregistered) */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	float GetShield(AActor* Ship) const;
+
+	/** Current energy (zero if unregistered) */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	float GetEnergy(AActor* Ship) const;
+
+	/** Apply damage to shields; returns the amount that punched through */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	float DrainShield(AActor* Ship, float Amount);
+
+	/** Spend energy; returns false (and spends nothing) if insufficient */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	bool ConsumeEnergy(AActor* Ship, float Amount);
+
+	/** Hard-set shield strength (scripted repairs, cheats) */
+	UFUNCTION(BlueprintCallable, Category = "Vitals")
+	void SetShield(AActor* Ship, float NewShield);
+
+	/** Seconds between regeneration passes (10 Hz default) */
+	UPROPERTY(EditAnywhere, Category = "Vitals", meta = (ClampMin = "0.02", ClampMax = "1.0"))
+	float UpdateInterval = 0.1f;
+
+protected:
+	/** Registered ship actors; index-parallel with the arrays below */
+	TArray<TWeakObjectPtr<AActor>> Ships;
+
+	/** Current shield strength per ship */
+	TArray<float> Shields;
+
+	/** Shield capacity per ship */
+	TArray<float> MaxShields;
+
+	/** Shield regeneration rate per ship (points/second) */
+	TArray<float> ShieldRegenRates;
+
+	/** Current energy per ship */
+	TArray<float> Energies;
+
+	/** Energy capacity per ship */
+	TArray<float> MaxEnergies;
+
+	/** Energy regeneration rate per ship (units/second) */
+	TArray<float> EnergyRegenRates;
+
+	/** Ship actor -> array index */
+	TMap<TWeakObjectPtr<AActor>, int32> ShipIndexLookup;
+
+	/** Time since the last regeneration pass */
+	float UpdateTimer = 0.0f;
+};
@@ -37,6 +37,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Time")
 	double GlobalTimeMultiplier;
 
+	/**
+	 * Fixed timestep (real seconds) between batched orbit solver passes.
+	 * Planet transforms are interpolated between passes, so this can be
+	 * much coarser than the frame rate without visible stepping.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Time", meta = (ClampMin = "0.01", ClampMax = "5.0"))
+	double OrbitSolverTimestep;
+
 	/** Whether to automatically spawn all planets on BeginPlay */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Setup")
 	bool bAutoSpawnPlanets;
@@ -45,6 +53,19 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Setup")
 	bool bSpawnSun;
 
+	/**
+	 * Whether to hibernate planets the player is nowhere near. Hibernated
+	 * planets keep their orbital state in the batched solver but have no
+	 * actor or mesh; the actor is respawned when the player comes back
+	 * within PlanetStreamingRadius of the planet's orbital position.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Streaming")
+	bool bEnablePlanetStreaming;
+
+	/** Distance (Unreal units) from the player within which planet actors exist */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Streaming", meta = (ClampMin = "0.0"))
+	double PlanetStreamingRadius;
+
 	/** Class to use for planet actors (allows for custom planet classes) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Solar System|Setup")
 	TSubclassOf<APlanetActor> PlanetActorClass;
@@ -89,6 +110,13 @@ private:
 	/** Spawn the Sun at the center */
 	void SpawnSunActor();
 
+	/**
+	 * One timesliced slice of the auto-spawn: step 0 spawns the Sun and
+	 * caches the planet data, each following step spawns one planet, the
+	 * last hands the orbits to the batched solver. Returns true when done.
+	 */
+	bool RunWorldSpawnStep(int32 StepIndex);
+
 	/** Create planet with specific orbital parameters */
 	APlanetActor* CreatePlanet(
 		const FString& Name,
@@ -131,6 +159,58 @@ private:
 	/** Get real-world data for all planets */
 	TArray<FPlanetData> GetPlanetaryData() const;
 
+	/**
+	 * Orbital elements of all managed planets in structure-of-arrays
+	 * layout, index-parallel to Planets. The orientation rotations
+	 * (inclination, node, periapsis) are constant per orbit, so they are
+	 * baked into two basis vectors and each solver pass only has to
+	 * iterate Kepler's equation and combine the bases.
+	 */
+	struct FOrbitSolverState
+	{
+		TArray<double> SemiMajorAxis;
+		TArray<double> SemiMinorAxis;
+		TArray<double> Eccentricity;
+		TArray<double> MeanMotion;
+		TArray<double> MeanAnomalyAtEpoch;
+		TArray<FVector> BasisX;
+		TArray<FVector> BasisY;
+
+		/** Body positions at the previous and current solver step */
+		TArray<FVector> PrevPositions;
+		TArray<FVector> CurrPositions;
+
+		/** Simulation seconds advanced so far (already time-multiplied) */
+		double SimTime = 0.0;
+
+		/** Real seconds accumulated toward the next solver step */
+		double Accumulator = 0.0;
+	};
+
+	/** Batched solver state for all planets in the Planets array */
+	FOrbitSolverState Solver;
+
+	/** Rebuild the solver's element arrays from the Planets array */
+	void RebuildOrbitSolverArrays();
+
+	/** Advance the solver one fixed step and recompute all body positions */
+	void StepOrbitSolver(double SimDeltaSeconds);
+
+	/** Move planet actors to positions blended between the last two solver steps */
+	void InterpolatePlanetTransforms(float Alpha);
+
+	/**
+	 * Spawn data for every managed planet, index-parallel to Planets, so
+	 * hibernated planets (null entries in Planets) can be respawned
+	 */
+	TArray<FPlanetData> ManagedPlanetData;
+
+	/** Seconds until the next streaming distance check */
+	double StreamingCheckTimer;
+
+	/** Hibernate/restore planet actors based on distance to the player */
+	void UpdatePlanetStreaming();
+
 	/** Whether orbits are currently paused */
 	bool bOrbitsPaused;
 
@@ -19,8 +19,9 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-public:	
+public:
 	virtual void Tick(float DeltaTime) override;
 
 	/** Visual mesh for the space object */
@@ -7,20 +7,24 @@
 #include "SpaceLightingActor.generated.h"
 
 /**
- * Actor that provides basic space lighting
+ * Actor that provides basic space lighting. Instances register with
+ * ULightRelevanceSubsystem; the sun defaults to always relevant, while
+ * local-light subclasses (station floodlights, engine glows) clear
+ * bAlwaysRelevant so the manager can fade them with distance.
  */
 UCLASS()
 class SUBSPACEUE_API ASpaceLightingActor : public AActor
 {
 	GENERATED_BODY()
-	
-public:	
+
+public:
 	ASpaceLightingActor();
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
-public:	
+public:
 	/** Directional light component (acts as sun) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Lighting")
 	class UDirectionalLightComponent* DirectionalLight;
@@ -28,4 +32,20 @@ public:
 	/** Sky light component for ambient lighting */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Lighting")
 	class USkyLightComponent* SkyLight;
+
+	/**
+	 * Never faded by the relevance manager. True for the sun/ambient
+	 * setup this base class ships; clear it on local lights so only the
+	 * nearest few stay active.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+	bool bAlwaysRelevant = true;
+
+	/** Beyond this camera distance the light can never be relevant */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Lighting")
+	float RelevanceRange = 100000.0f;
+
+protected:
+	/** Relevance manager, cached on BeginPlay */
+	TWeakObjectPtr<class ULightRelevanceSubsystem> LightRelevance;
 };
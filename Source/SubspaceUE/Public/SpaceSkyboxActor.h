@@ -62,11 +62,11 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subspace|Skybox")
 	bool bFollowCamera = true;
 
-	/** Update skybox material parameters */
+	/** Push skybox material parameters if they changed since the last push */
 	UFUNCTION(BlueprintCallable, Category = "Subspace|Skybox")
 	void UpdateMaterialParameters();
 
-	/** Create procedural star material */
+	/** Apply the baked starfield texture (built once per session) */
 	UFUNCTION(BlueprintCallable, Category = "Subspace|Skybox")
 	void CreateProceduralStarfield();
 
@@ -77,4 +77,19 @@ protected:
 
 	/** Find and follow the player camera */
 	void FollowPlayerCamera();
+
+	/**
+	 * Starfield texture baked once per session and cached across level
+	 * loads; every skybox instance shares the same texture.
+	 */
+	static class UTexture2D* GetOrBakeStarfieldTexture(float Density);
+
+	/** Parameter values last pushed to the material, to skip no-op pushes */
+	float PushedStarBrightness = -1.0f;
+
+	/** See PushedStarBrightness */
+	float PushedStarDensity = -1.0f;
+
+	/** See PushedStarBrightness */
+	FLinearColor PushedNebulaColor = FLinearColor(-1.0f, -1.0f, -1.0f, -1.0f);
 };
@@ -0,0 +1,67 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SpatialPartitionSubsystem.generated.h"
+
+/**
+ * Sector-wide spatial partition over registered space actors (ships,
+ * stations, gates, asteroids). Maintains a loose uniform grid keyed by
+ * cell coordinate so "what's near me" queries touch only the cells that
+ * overlap the query, instead of GetAllActorsOfClass walking the whole
+ * world. ASpaceActor and the ship pawns register themselves on
+ * BeginPlay; moving actors are re-bucketed on a coarse timer.
+ */
+UCLASS()
+class SUBSPACEUE_API USpatialPartitionSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Edge length (world units) of one grid cell */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Spatial")
+	float CellSize = 50000.0f;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	/** Add an actor to the partition. Safe to call twice. */
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	void RegisterActor(AActor* Actor);
+
+	/** Remove an actor from the partition */
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	void UnregisterActor(AActor* Actor);
+
+	/**
+	 * All registered actors within Radius of Center, optionally filtered
+	 * by class (nullptr matches everything)
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	TArray<AActor*> QueryRadius(const FVector& Center, float Radius, TSubclassOf<AActor> ClassFilter = nullptr) const;
+
+	/**
+	 * The nearest registered actor within MaxRadius of Center, optionally
+	 * filtered by class, or nullptr if none
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Spatial")
+	AActor* QueryNearest(const FVector& Center, float MaxRadius, TSubclassOf<AActor> ClassFilter = nullptr) const;
+
+protected:
+	/** Grid cell containing a world location */
+	FIntVector LocationToCell(const FVector& Location) const;
+
+	/** Re-bucket registered actors whose location crossed a cell boundary */
+	void RefreshActorCells();
+
+	/** Registered actors per cell */
+	TMap<FIntVector, TArray<TWeakObjectPtr<AActor>>> Grid;
+
+	/** Cell each registered actor currently occupies */
+	TMap<TWeakObjectPtr<AActor>, FIntVector> ActorCells;
+
+	/** Seconds until the next re-bucketing pass */
+	float RefreshTimer = 0.0f;
+};
@@ -4,8 +4,12 @@
 
 #include "CoreMinimal.h"
 #include "Engine/GameInstance.h"
+#include "Engine/TimerHandle.h"
+#include "VoxelBlock.h"
 #include "SubspaceGameInstance.generated.h"
 
+class UVoxelComponent;
+
 /**
  * Game Instance for Codename:Subspace
  * 
@@ -38,11 +42,67 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Subspace|Faction")
 	TMap<FName, float> FactionReputation;
 
-	/** Save game data */
+	/** Seconds between autosaves; zero or negative disables the timer */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subspace|Save")
+	float AutosaveInterval = 300.0f;
+
+	/**
+	 * Save game data. Player state is snapshotted on the game thread and
+	 * serialized/written on a background task; any structures marked
+	 * dirty since the last save are flushed through SaveVoxelStructure.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Subspace|Save")
 	void SaveGame();
 
 	/** Load game data */
 	UFUNCTION(BlueprintCallable, Category = "Subspace|Save")
 	void LoadGame();
+
+	/**
+	 * Mark a voxel structure as modified since the last save. Autosave
+	 * persists only marked structures, so untouched sectors and ships
+	 * cost nothing. Call after edits that should survive an autosave.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Subspace|Save")
+	void MarkStructureDirty(UVoxelComponent* VoxelComponent, const FString& SlotName);
+
+	/** Periodic save entry point driven by the autosave timer */
+	UFUNCTION(BlueprintCallable, Category = "Subspace|Save")
+	void Autosave();
+
+	/**
+	 * Save a voxel structure to the dedicated binary format (palette-
+	 * compressed materials, RLE over empty space, grouped into 32-voxel
+	 * regions). Serialization and the file write run on a background
+	 * task, so this is safe to call from autosave without hitching.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Subspace|Save")
+	void SaveVoxelStructure(UVoxelComponent* VoxelComponent, const FString& SlotName);
+
+	/**
+	 * Load a voxel structure saved with SaveVoxelStructure into the
+	 * component. Chunks are meshed asynchronously as the component
+	 * processes them, so large ships stream in over a few frames.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Subspace|Save")
+	bool LoadVoxelStructure(UVoxelComponent* VoxelComponent, const FString& SlotName);
+
+	/** Write blocks into the region-based binary format */
+	static void SerializeVoxelStructure(FArchive& Ar, const TArray<FVoxelBlock>& Blocks);
+
+	/** Read blocks back from the region-based binary format */
+	static bool DeserializeVoxelStructure(FArchive& Ar, TArray<FVoxelBlock>& OutBlocks);
+
+protected:
+	/** File path for a voxel structure save slot */
+	static FString GetVoxelSavePath(const FString& SlotName);
+
+	/** File path for the player-state save file */
+	static FString GetPlayerSavePath();
+
+	/** Structures modified since the last save, keyed by their save slot */
+	TMap<FString, TWeakObjectPtr<UVoxelComponent>> DirtyStructures;
+
+	/** Drives Autosave at AutosaveInterval */
+	FTimerHandle AutosaveTimerHandle;
 };
@@ -32,6 +32,13 @@ protected:
 	UFUNCTION(BlueprintCallable, Category = "Subspace|Galaxy")
 	void InitializeGalaxySystem();
 
+	/** Spawn the skybox and lighting (the first frame's backdrop) */
+	void SpawnEnvironmentActors();
+
+	/** Bound to the init scheduler's completion broadcast */
+	UFUNCTION()
+	void OnWorldInitComplete();
+
 	/** Spawn AI ships in current sector */
 	UFUNCTION(BlueprintCallable, Category = "Subspace|AI")
 	void SpawnAIShips(int32 NumShips);
@@ -6,6 +6,25 @@
 #include "GameFramework/HUD.h"
 #include "SubspaceHUD.generated.h"
 
+/**
+ * One projected target marker. Built once per frame in the batched
+ * projection pass, then drawn without touching the target actor again.
+ */
+struct FTargetMarker
+{
+	/** Projected screen position */
+	FVector2D ScreenPosition = FVector2D::ZeroVector;
+
+	/** Distance from the player ship */
+	float Distance = 0.0f;
+
+	/** Draw priority: 0 = targeted, 1 = ship, 2 = other contact */
+	uint8 Priority = 2;
+
+	/** Contact name; drawn only for the top labeled markers */
+	FString Label;
+};
+
 /**
  * HUD for displaying game information
  */
@@ -13,14 +32,39 @@ UCLASS()
 class SUBSPACEUE_API ASubspaceHUD : public AHUD
 {
 	GENERATED_BODY()
-	
+
 public:
 	ASubspaceHUD();
 
 	/** Called every frame to draw the HUD */
 	virtual void DrawHUD() override;
 
+	/** Contacts beyond this range never get a marker */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HUD|Markers")
+	float SensorRange = 1000000.0f;
+
+	/** Marker budget per frame; lowest-priority contacts drop first */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HUD|Markers")
+	int32 MaxMarkers = 32;
+
+	/** How many of the top markers also get name/distance text */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "HUD|Markers")
+	int32 MaxLabeledMarkers = 8;
+
 protected:
+	/**
+	 * One pass over the spatial partition query result: project every
+	 * contact to the screen, cull off-screen hits, sort by priority then
+	 * distance, and trim to the marker budget.
+	 */
+	void BuildTargetMarkers(APlayerController* PC, APawn* PlayerPawn);
+
+	/** Draw the built marker list as one bracket batch plus capped labels */
+	void DrawTargetMarkers();
+
+	/** Markers rebuilt each frame; buffer reused to avoid churn */
+	TArray<FTargetMarker> Markers;
+
 	/** Font for rendering text */
 	UPROPERTY()
 	UFont* HUDFont;
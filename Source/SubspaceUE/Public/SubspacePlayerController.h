@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/PlayerController.h"
+#include "VoxelComponent.h"
 #include "SubspacePlayerController.generated.h"
 
 /**
@@ -44,6 +45,20 @@ public:
 	UPROPERTY(BlueprintReadWrite, Category = "Subspace|Control")
 	bool bIsShipControlMode = true;
 
+	/**
+	 * Relay a voxel baseline request for any viewed structure. Server
+	 * RPCs only travel on a connection that owns the calling actor and
+	 * clients never own other players' ships, so the component routes
+	 * its request through the controller - the one actor every client's
+	 * connection owns (see UVoxelComponent::RequestBaseline).
+	 */
+	UFUNCTION(Server, Reliable)
+	void ServerRequestVoxelBaseline(UVoxelComponent* Target);
+
+	/** Deliver a requested baseline back to the component that asked */
+	UFUNCTION(Client, Reliable)
+	void ClientReceiveVoxelBaseline(UVoxelComponent* Target, FVoxelEditDelta Baseline);
+
 	/** Main HUD widget class to spawn */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Subspace|UI")
 	TSubclassOf<class UMainHUDWidget> MainHUDClass;
@@ -21,6 +21,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	virtual void Tick(float DeltaTime) override;
@@ -151,4 +152,7 @@ protected:
 
 	/** Update Newtonian physics */
 	void UpdatePhysics(float DeltaTime);
+
+	/** Cached flight integrator; owns linear motion for this ship */
+	TWeakObjectPtr<class UFlightDynamicsSubsystem> FlightDynamics;
 };
@@ -0,0 +1,23 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+/**
+ * Project-wide performance counters. View live with `stat Subspace`,
+ * capture to CSV over a window with `Subspace.CsvCapture <seconds>`
+ * (works headless; files land in Saved/Profiling/CSV). Wrap new hot
+ * paths with SCOPE_CYCLE_COUNTER on one of these stats, or declare a
+ * new one here so it shows up in both views.
+ */
+DECLARE_STATS_GROUP(TEXT("Subspace"), STATGROUP_Subspace, STATCAT_Advanced);
+
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(SUBSPACEUE_API, Subspace);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Voxel Mesh Rebuild"), STAT_SubspaceVoxelRebuild, STATGROUP_Subspace, SUBSPACEUE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Trading Production"), STAT_SubspaceTradingProduction, STATGROUP_Subspace, SUBSPACEUE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Navigation Tick"), STAT_SubspaceNavigationTick, STATGROUP_Subspace, SUBSPACEUE_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Orbit Solver Step"), STAT_SubspaceOrbitStep, STATGROUP_Subspace, SUBSPACEUE_API);
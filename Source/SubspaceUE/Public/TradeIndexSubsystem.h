@@ -0,0 +1,82 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TradingComponent.h"
+#include "TradeIndexSubsystem.generated.h"
+
+/**
+ * One station's standing offer to buy or sell a ware, snapshotted into
+ * the sector trade index
+ */
+struct FTradeOffer
+{
+	/** Station trading component the offer belongs to */
+	TWeakObjectPtr<UTradingComponent> Station;
+
+	/** Station world location when the offer was indexed */
+	FVector Location = FVector::ZeroVector;
+
+	/** Current unit price including the order's price modifier */
+	float UnitPrice = 0.0f;
+
+	/** Units available (sell offers) or capacity remaining (buy offers) */
+	int32 Quantity = 0;
+};
+
+/** Price-sorted buy and sell offers for a single ware */
+struct FWareOfferBook
+{
+	/** Stations selling this ware, cheapest first */
+	TArray<FTradeOffer> SellOffers;
+
+	/** Stations buying this ware, best-paying first */
+	TArray<FTradeOffer> BuyOffers;
+};
+
+/**
+ * Sector-wide trade index. Stations register their trading components
+ * and mark themselves dirty when stock changes; the index lazily
+ * rebuilds just those stations' offers into per-ware price-sorted
+ * books. Finding the best buy/sell pair for a ware is then a walk down
+ * two sorted arrays instead of an all-stations x all-wares scan.
+ */
+UCLASS()
+class SUBSPACEUE_API UTradeIndexSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Add a station's offers to the index */
+	void RegisterStation(UTradingComponent* Station);
+
+	/** Remove a station's offers from the index */
+	void UnregisterStation(UTradingComponent* Station);
+
+	/** Flag a station's offers for re-indexing (stock or orders changed) */
+	void MarkStationDirty(UTradingComponent* Station);
+
+	/**
+	 * Best buy/sell station pair per ware within MaxJumpDistance of
+	 * CurrentLocation, sorted by total profit, at most MaxResults deals
+	 */
+	TArray<FTradeDeal> FindProfitableDeals(const FVector& CurrentLocation, float MaxJumpDistance, int32 MaxResults);
+
+protected:
+	/** Re-index every station flagged dirty since the last query */
+	void RefreshDirtyStations();
+
+	/** Remove and rebuild one station's offers in the affected books */
+	void RebuildStationOffers(UTradingComponent* Station);
+
+	/** Per-ware offer books */
+	TMap<FName, FWareOfferBook> OfferBooks;
+
+	/** All registered stations */
+	TSet<TWeakObjectPtr<UTradingComponent>> Stations;
+
+	/** Stations whose offers are stale */
+	TSet<TWeakObjectPtr<UTradingComponent>> DirtyStations;
+};
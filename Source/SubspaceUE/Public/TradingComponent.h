@@ -52,7 +52,7 @@ struct FWare
 	float ProductionTime = 60.0f;  // Seconds to produce one unit
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ware")
-	TMap<FString, int32> InputWares;  // Required wares to produce this
+	TMap<FName, int32> InputWares;  // Required wares (interned IDs) to produce this
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ware")
 	FString Description = TEXT("");
@@ -67,7 +67,7 @@ struct FStationStorage
 	GENERATED_BODY()
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Storage")
-	TMap<FString, int32> WareStock;  // WareId -> Quantity
+	TArray<int32> StockByIndex;  // Quantity per dense ware index (see UTradingComponent::WareIds)
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Storage")
 	int32 MaxCapacity = 10000;
@@ -85,7 +85,7 @@ struct FTradeOrder
 	GENERATED_BODY()
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trade")
-	FString WareId = TEXT("");
+	FName WareId;
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trade")
 	bool bIsBuyOrder = true;  // true = buying, false = selling
@@ -118,7 +118,7 @@ struct FTradeDeal
 	AActor* SellStation = nullptr;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Trade")
-	FString WareId = TEXT("");
+	FName WareId;
 
 	UPROPERTY(BlueprintReadOnly, Category = "Trade")
 	float ProfitPerUnit = 0.0f;
@@ -147,13 +147,18 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
-	/** Ware library */
+	/** Ware library, keyed by interned ware ID */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trading")
-	TMap<FString, FWare> WareLibrary;
+	TMap<FName, FWare> WareLibrary;
+
+	/** Dense ware index -> interned ware ID, assigned by RebuildWareIndex */
+	UPROPERTY(BlueprintReadOnly, Category = "Trading")
+	TArray<FName> WareIds;
 
 	/** Station storage (if this is a station) */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Trading")
@@ -177,15 +182,40 @@ public:
 
 	/** Calculate price based on supply/demand */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	float CalculatePrice(const FString& WareId, bool bIsBuying) const;
+	float CalculatePrice(FName WareId, bool bIsBuying) const;
+
+	/**
+	 * Published per-order prices, index-parallel to TradeOrders and
+	 * including each order's PriceModifier (inactive orders publish 0).
+	 * Recomputed only when stock actually changes, so the trade UI and
+	 * the sector trade index read prices instead of re-evaluating the
+	 * stock-ratio curve per call.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Trading")
+	TArray<float> PublishedPrices;
+
+	/** Published price of a trade order (0 if unknown or inactive) */
+	UFUNCTION(BlueprintCallable, Category = "Trading")
+	float GetPublishedPrice(int32 OrderIndex) const
+	{
+		return PublishedPrices.IsValidIndex(OrderIndex) ? PublishedPrices[OrderIndex] : 0.0f;
+	}
+
+	/**
+	 * Recompute every published order price. Storage changes republish
+	 * the affected ware automatically; call this only after editing
+	 * TradeOrders or WareLibrary directly.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Trading")
+	void RepublishPrices();
 
 	/** Buy ware from station */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	bool BuyWare(AActor* FromStation, const FString& WareId, int32 Quantity, int32& OutCost);
+	bool BuyWare(AActor* FromStation, FName WareId, int32 Quantity, int32& OutCost);
 
 	/** Sell ware to station */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	bool SellWare(AActor* ToStation, const FString& WareId, int32 Quantity, int32& OutRevenue);
+	bool SellWare(AActor* ToStation, FName WareId, int32 Quantity, int32& OutRevenue);
 
 	/** Find profitable trade routes */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
@@ -193,21 +223,35 @@ public:
 
 	/** Add ware to storage */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	bool AddWareToStorage(const FString& WareId, int32 Quantity);
+	bool AddWareToStorage(FName WareId, int32 Quantity);
 
 	/** Remove ware from storage */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	bool RemoveWareFromStorage(const FString& WareId, int32 Quantity);
+	bool RemoveWareFromStorage(FName WareId, int32 Quantity);
 
 	/** Get current stock of ware */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	int32 GetWareStock(const FString& WareId) const;
+	int32 GetWareStock(FName WareId) const;
+
+	/** Dense index of a ware ID, or INDEX_NONE if unknown */
+	UFUNCTION(BlueprintCallable, Category = "Trading")
+	int32 GetWareIndex(FName WareId) const;
+
+	/** Stock at a dense ware index (no hashing; hot-path accessor) */
+	int32 GetWareStockByIndex(int32 WareIndex) const
+	{
+		return Storage.StockByIndex.IsValidIndex(WareIndex) ? Storage.StockByIndex[WareIndex] : 0;
+	}
 
 	/** Set up default station trade orders */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
-	void SetupStationTrading(const TArray<FString>& BuyWares, const TArray<FString>& SellWares);
+	void SetupStationTrading(const TArray<FName>& BuyWares, const TArray<FName>& SellWares);
 
-	/** Update production (call periodically for stations) */
+	/**
+	 * Run one immediate production pass. Normal production is event-
+	 * driven through UProductionSchedulerSubsystem; this remains for
+	 * manual/scripted production pushes.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Trading")
 	void UpdateProduction(float DeltaTime);
 
@@ -215,6 +259,30 @@ protected:
 	/** Create ware definition */
 	FWare CreateWare(const FString& Name, EWareCategory Category, float BasePrice, float Volume, float ProductionTime = 60.0f);
 
+	/** Assign dense indices to the ware library and size the stock array */
+	void RebuildWareIndex();
+
+	/** Interned ware ID -> dense ware index */
+	TMap<FName, int32> WareIndexLookup;
+
+	/** Republish only the orders trading one ware (a stock change) */
+	void RepublishPricesForWare(FName WareId);
+
+	/** Register with the sector trade index (stations with orders only) */
+	void RegisterWithTradeIndex();
+
+	/** Tell the trade index our offers are stale */
+	void NotifyTradeIndexDirty();
+
+	/** Sector trade index, cached on registration */
+	TWeakObjectPtr<class UTradeIndexSubsystem> TradeIndex;
+
+	/** Let the production scheduler re-evaluate what we can produce */
+	void NotifyProductionStateChanged();
+
+	/** Event-driven production scheduler, cached on BeginPlay */
+	TWeakObjectPtr<class UProductionSchedulerSubsystem> ProductionScheduler;
+
 	/** Production timer for stations */
 	float ProductionTimer = 0.0f;
 };
@@ -25,6 +25,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:
 	virtual void Tick(float DeltaTime) override;
@@ -46,6 +47,14 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ship|Stats")
 	FX4ShipStats Stats;
 
+	/**
+	 * Index into UShipClassRegistry's baked class table. Resolved by
+	 * name on initialization; the registry block is the shared tuning
+	 * source, Stats mirrors it for Blueprint and instance mutation.
+	 */
+	UPROPERTY(BlueprintReadOnly, Category = "Ship|Stats")
+	int32 ShipClassIndex = INDEX_NONE;
+
 	/** Ship configuration */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Ship|Config")
 	FX4ShipConfig Config;
@@ -106,4 +115,10 @@ protected:
 
 	/** Setup Ulysses interior */
 	void SetupInterior();
+
+	/** Cached flight integrator; owns linear motion for this ship */
+	TWeakObjectPtr<class UFlightDynamicsSubsystem> FlightDynamics;
+
+	/** Cached vitals batcher; owns shield/energy values for this ship */
+	TWeakObjectPtr<class UShipVitalsSubsystem> ShipVitals;
 };
@@ -121,6 +121,13 @@ struct SUBSPACEUE_API FVoxelBlock
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Functional")
 	float ShieldCapacity;
 
+	/**
+	 * Material tier index resolved once from MaterialType by
+	 * CalculateProperties. Hot paths read this instead of re-resolving
+	 * the string; re-run CalculateProperties after changing MaterialType.
+	 */
+	uint8 MaterialIndex = 0;
+
 	FVoxelBlock()
 		: Id(FGuid::NewGuid())
 		, Position(FVector::ZeroVector)
@@ -153,3 +160,29 @@ struct SUBSPACEUE_API FVoxelBlock
 	/** Calculate properties based on material and block type */
 	void CalculateProperties();
 };
+
+/**
+ * Packed runtime view of a voxel used by the meshing hot paths.
+ * Unit-sized voxel on the integer grid, material as a tier index into
+ * UVoxelMaterialLibrary - no FGuid, no FString, no heap members.
+ * FVoxelBlock remains the Blueprint-facing edit/serialization view;
+ * UVoxelComponent keeps packed mirrors of the hot fields in
+ * structure-of-arrays layout alongside the block array.
+ */
+struct FPackedVoxel
+{
+	/** Integer grid coordinate (rounded block position) */
+	FIntVector Coord = FIntVector::ZeroValue;
+
+	/** Material tier index (EMaterialTier as uint8) */
+	uint8 Material = 0;
+
+	/** Block shape (EBlockShape as uint8); non-cubes mesh via shape tables */
+	uint8 Shape = 0;
+
+	/** Shape orientation (EBlockOrientation as uint8) */
+	uint8 Orientation = 2; // PosY
+
+	/** Resolved render color */
+	FColor Color = FColor::White;
+};
@@ -8,6 +8,145 @@
 #include "VoxelBlock.h"
 #include "VoxelComponent.generated.h"
 
+/**
+ * Mesh buffers produced by a (possibly background) mesh build.
+ * Carries the chunk coordinate and generation counter of the rebuild
+ * that produced it so stale results from rapid successive edits can
+ * be discarded.
+ */
+struct FVoxelMeshBuildResult
+{
+	TArray<FVector> Vertices;
+	TArray<int32> Triangles;
+	TArray<FVector> Normals;
+	TArray<FColor> VertexColors;
+
+	/** Chunk this result belongs to */
+	FIntVector ChunkCoord = FIntVector::ZeroValue;
+
+	/** Generation of the chunk state this result was built from */
+	int32 Generation = 0;
+
+	/** LOD level these buffers represent (0 = full detail) */
+	int32 LODLevel = 0;
+};
+
+/**
+ * Persistent occupancy grid retained between rebuilds. Maps integer
+ * grid cells to block indices (INDEX_NONE when empty) and is updated
+ * incrementally as blocks are added, removed or destroyed, so rebuilds
+ * never re-derive bounds or refill the grid from scratch. Bounds grow
+ * geometrically, so sustained edits settle into a stable allocation.
+ */
+struct FVoxelGridCache
+{
+	/** Block index per cell, INDEX_NONE when empty */
+	TArray<int32> Cells;
+
+	/** Inclusive lower corner of the allocated region */
+	FIntVector GridMin = FIntVector::ZeroValue;
+
+	/** Allocated extent per axis (zero until the first block is added) */
+	FIntVector GridSize = FIntVector::ZeroValue;
+
+	bool IsInBounds(const FIntVector& Coord) const
+	{
+		const FIntVector Local = Coord - GridMin;
+		return Local.X >= 0 && Local.X < GridSize.X &&
+		       Local.Y >= 0 && Local.Y < GridSize.Y &&
+		       Local.Z >= 0 && Local.Z < GridSize.Z;
+	}
+
+	int32 CellIndex(const FIntVector& Coord) const
+	{
+		const FIntVector Local = Coord - GridMin;
+		return Local.X + Local.Y * GridSize.X + Local.Z * GridSize.X * GridSize.Y;
+	}
+
+	/** Block index at the cell, or INDEX_NONE if empty/out of bounds */
+	int32 Get(const FIntVector& Coord) const
+	{
+		return IsInBounds(Coord) ? Cells[CellIndex(Coord)] : INDEX_NONE;
+	}
+
+	/** Write a cell; the coordinate must already be in bounds */
+	void Set(const FIntVector& Coord, int32 BlockIndex)
+	{
+		if (IsInBounds(Coord))
+		{
+			Cells[CellIndex(Coord)] = BlockIndex;
+		}
+	}
+
+	/** Grow the allocation (geometrically) until the coordinate fits */
+	void EnsureContains(const FIntVector& Coord);
+
+	/** Release the allocation */
+	void Reset()
+	{
+		Cells.Empty();
+		GridMin = FIntVector::ZeroValue;
+		GridSize = FIntVector::ZeroValue;
+	}
+};
+
+/**
+ * One fixed-size cell of the voxel structure. Each chunk owns its own
+ * procedural mesh section, so editing a block only remeshes the chunk
+ * (and boundary neighbors) it lives in rather than the whole structure.
+ */
+struct FVoxelChunk
+{
+	/** Indices into UVoxelComponent::Blocks of the blocks in this chunk */
+	TArray<int32> BlockIndices;
+
+	/**
+	 * First procedural mesh section assigned to this chunk (INDEX_NONE
+	 * until first build). Each chunk owns a run of NumLODLevels
+	 * consecutive sections, one per LOD.
+	 */
+	int32 SectionIndex = INDEX_NONE;
+
+	/** Bumped on every edit; stale mesh builds are discarded by comparing against this */
+	int32 Generation = 0;
+
+	/** Whether this chunk needs remeshing */
+	bool bDirty = false;
+};
+
+/** Fired when destroying/removing blocks disconnects a fragment from the main structure */
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnVoxelStructureSplit, const TArray<FGuid>&, FragmentBlockIds);
+
+/**
+ * One replicated batch of packed voxel edit records. Live edits carry a
+ * single chunk's records so clients remesh only that chunk; baselines
+ * carry the whole structure grouped by chunk. The payload layout is
+ * defined by the VoxelEditFormat namespace in VoxelComponent.cpp -
+ * records are a handful of bytes each (opcode plus chunk-local
+ * coordinate plus op-specific fields), never whole FVoxelBlock structs.
+ */
+USTRUCT()
+struct FVoxelEditDelta
+{
+	GENERATED_BODY()
+
+	/** Chunk the records apply to (unused for baselines) */
+	UPROPERTY()
+	FIntVector ChunkCoord = FIntVector::ZeroValue;
+
+	/** Delta sequence number (baselines carry the state's sequence) */
+	UPROPERTY()
+	int32 Sequence = 0;
+
+	/** Number of records in the payload */
+	UPROPERTY()
+	int32 NumRecords = 0;
+
+	/** Packed edit records (VoxelEditFormat) */
+	UPROPERTY()
+	TArray<uint8> Payload;
+};
+
 /**
  * Component that manages voxel blocks and generates procedural meshes
  * Used for asteroids, damage visualization, and voxel-based structures
@@ -17,13 +156,23 @@ class SUBSPACEUE_API UVoxelComponent : public UActorComponent
 {
 	GENERATED_BODY()
 
-public:	
+	// The meshing benchmark drives the static mesh builders directly
+	friend class UVoxelMeshBenchCommandlet;
+
+	// The asteroid field engine bakes archetype meshes through the same builders
+	friend class UAsteroidFieldSubsystem;
+
+	// Baseline requests relay through the client's own controller (see
+	// RequestBaseline); the relay RPCs call back into the edit stream
+	friend class ASubspacePlayerController;
+
+public:
 	UVoxelComponent();
 
 protected:
 	virtual void BeginPlay() override;
 
-public:	
+public:
 	virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 	/** Array of voxel blocks */
@@ -38,10 +187,63 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Optimization")
 	bool bUseGreedyMeshing;
 
+	/** Whether to run mesh generation on a background task instead of the game thread */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Optimization")
+	bool bAsyncMeshing;
+
+	/** Edge length (in voxels) of the fixed-size chunks blocks are partitioned into */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Voxel|Optimization", meta = (ClampMin = "8", ClampMax = "64"))
+	int32 ChunkSize;
+
+	/** Whether to build and switch between distance LOD meshes */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Optimization")
+	bool bEnableLOD;
+
+	/**
+	 * View distances (in world units) at which to switch to coarser LODs.
+	 * Element 0 is the LOD0->LOD1 distance, element 1 the LOD1->LOD2
+	 * distance. LOD N merges 2^N voxels per axis by dominant color.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Optimization")
+	TArray<float> LODDistances;
+
+	/**
+	 * Seconds between collision rebuilds. Collision is a box compound
+	 * merged from solid runs in the voxel grid, rebuilt on this cadence
+	 * independently of the render mesh - physics does not need surface
+	 * detail, and cooking a handful of boxes is far cheaper than cooking
+	 * the greedy-meshed render triangles every edit.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Optimization")
+	float CollisionRebuildInterval;
+
 	/** Whether the mesh needs to be rebuilt */
 	UPROPERTY(BlueprintReadOnly, Category = "Voxel")
 	bool bNeedsRebuild;
 
+	/** Whether to check for disconnected fragments after blocks are destroyed or removed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel")
+	bool bDetectSplits;
+
+	/**
+	 * Stream block edits to clients as compact per-chunk deltas instead
+	 * of replicating the block array. Requires the owning actor to
+	 * replicate (edits ride component RPCs); late joiners pull a packed
+	 * baseline of the current state and pick up the delta stream from
+	 * there. Leave off for purely server-local structures (asteroids).
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|Replication")
+	bool bReplicateEdits;
+
+	/**
+	 * Fired once per disconnected fragment, carrying the IDs of the blocks
+	 * in it. The fragment's blocks are still owned by this component;
+	 * listeners decide what to do with them (spawn a debris actor from
+	 * them, then RemoveBlocks them here).
+	 */
+	UPROPERTY(BlueprintAssignable, Category = "Voxel")
+	FOnVoxelStructureSplit OnStructureSplit;
+
 	/** Add a voxel block to the structure */
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	void AddBlock(const FVoxelBlock& Block);
@@ -50,6 +252,15 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	bool RemoveBlock(const FGuid& BlockId);
 
+	/**
+	 * Remove a batch of voxel blocks by ID, deferring the mesh rebuild
+	 * until the whole batch is applied. Returns the number removed.
+	 * Use this for burst damage (weapon impacts) instead of per-block
+	 * RemoveBlock calls.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	int32 RemoveBlocks(const TArray<FGuid>& BlockIds);
+
 	/** Get a voxel block by ID */
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	bool GetBlock(const FGuid& BlockId, FVoxelBlock& OutBlock) const;
@@ -62,10 +273,42 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	void ClearBlocks();
 
+	/**
+	 * Apply damage to a block. Flips the destroyed flag (and updates the
+	 * mass aggregates and mesh) when durability reaches zero. Returns
+	 * true if the block was destroyed by this damage.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	bool DamageBlock(const FGuid& BlockId, float Damage);
+
+	/**
+	 * Find the first non-destroyed block along a ray in component-local
+	 * voxel space. Walks the occupancy grid with a DDA traversal, so the
+	 * cost is proportional to the cells crossed, not the block count.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	bool RaycastBlock(const FVector& Start, const FVector& End, FVoxelBlock& OutBlock) const;
+
+	/** IDs of all non-destroyed blocks within a sphere in component-local voxel space */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	TArray<FGuid> QueryBlocksInSphere(const FVector& Center, float Radius) const;
+
 	/** Calculate total mass of all blocks */
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	float CalculateTotalMass() const;
 
+	/** Total mass of all non-destroyed blocks (O(1), maintained incrementally) */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	float GetTotalMass() const { return CachedTotalMass; }
+
+	/** Center of mass in component-local voxel space (O(1), maintained incrementally) */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	FVector GetCenterOfMass() const;
+
+	/** Point-mass moment of inertia approximation about the center of mass (O(1)) */
+	UFUNCTION(BlueprintCallable, Category = "Voxel")
+	float GetMomentOfInertia() const;
+
 	/** Rebuild the procedural mesh from voxel blocks */
 	UFUNCTION(BlueprintCallable, Category = "Voxel")
 	void RebuildMesh();
@@ -75,35 +318,256 @@ public:
 	void MarkForRebuild() { bNeedsRebuild = true; }
 
 protected:
+	// --- Edit replication ---
+	// The server is authoritative: every confirmed edit appends a packed
+	// record to its chunk's pending payload, and the payloads flush as
+	// one reliable multicast per touched chunk per frame. Clients apply
+	// records through the same AddBlock/RemoveBlock/DamageBlock paths,
+	// so only the affected chunks remesh. A gap in the sequence stream
+	// (or joining late) triggers a baseline pull of the current state.
+
+	/** Records accumulated for one chunk this frame */
+	struct FPendingChunkEdits
+	{
+		/** Number of records in the payload */
+		int32 NumRecords = 0;
+
+		/** Packed records (VoxelEditFormat) */
+		TArray<uint8> Payload;
+	};
+
+	/** Server: records accumulated this frame, flushed per chunk on tick */
+	TMap<FIntVector, FPendingChunkEdits> PendingEditDeltas;
+
+	/**
+	 * Server: sequence of the last flushed delta. Sequences number deltas,
+	 * not records - reliable RPCs arrive in order, so a client seeing a
+	 * jump knows it missed deltas (it joined mid-session) and pulls a
+	 * baseline instead of applying onto a stale state.
+	 */
+	int32 EditSequence = 0;
+
+	/** Client: sequence of the last applied delta; INDEX_NONE before the baseline */
+	int32 LastAppliedSequence = INDEX_NONE;
+
+	/** Client: a baseline request is in flight; incoming deltas are dropped */
+	bool bAwaitingBaseline = false;
+
+	/** Whether this component records and streams edits (server side, replicating) */
+	bool IsEditAuthority() const;
+
+	/** Append an add record for a block the server just accepted */
+	void RecordAddEdit(const FVoxelBlock& Block);
+
+	/** Append a remove record for the cell a block was removed from */
+	void RecordRemoveEdit(const FIntVector& Coord);
+
+	/** Append a damage record for the cell a block was damaged in */
+	void RecordDamageEdit(const FIntVector& Coord, float Damage);
+
+	/** Multicast every pending per-chunk payload (end of frame, server) */
+	void FlushPendingEditDeltas();
+
+	/** Apply packed records on a client, advancing the cursor past them */
+	void ApplyEditRecords(const FIntVector& InChunkCoord, const uint8*& Cursor, const uint8* End, int32 NumRecords);
+
+	/** Reliable per-chunk edit stream, server to everyone */
+	UFUNCTION(NetMulticast, Reliable)
+	void MulticastEditDelta(const FVoxelEditDelta& Delta);
+
+	/**
+	 * Client: flag local state stale and ask the server for a baseline.
+	 * The request relays through the local player controller - a Server
+	 * RPC only travels on a connection that owns the calling actor, and
+	 * viewers of someone else's ship never own it; the controller is the
+	 * one server-reachable object every client has. Re-sent on a timer
+	 * until the baseline lands, so a request fired before the controller
+	 * exists (or a reply lost to an unopened channel) cannot wedge the
+	 * client in the awaiting state.
+	 */
+	void RequestBaseline();
+
+	/** Server: pack the whole live structure as chunk-grouped add records */
+	FVoxelEditDelta BuildBaseline();
+
+	/** Client: replace local state with a baseline and resume the stream after it */
+	void ApplyBaseline(const FVoxelEditDelta& Baseline);
+
+	/** Client: seconds until an unanswered baseline request is re-sent */
+	float BaselineRetryTimer = 0.0f;
+
+	/** Number of LOD meshes built per chunk (LOD N merges 2^N voxels per axis) */
+	static constexpr int32 NumLODLevels = 3;
+
+	/** LOD currently shown (same for all chunks of the structure) */
+	int32 CurrentLOD;
+
+	/** Seconds until the next LOD distance check */
+	float LODCheckTimer;
+
+	/** Pick the LOD for the current view distance and swap section visibility */
+	void UpdateLODSelection();
+
+	/** Merge voxels into Factor^3 groups keyed by dominant material/color */
+	static TArray<FPackedVoxel> DownsampleVoxels(const TArray<FPackedVoxel>& InVoxels, int32 Factor);
+
+	/** Chunk map partitioning Blocks by grid coordinate. Game thread only. */
+	TMap<FIntVector, FVoxelChunk> Chunks;
+
+	/** Block ID to Blocks index lookup, kept in sync by AddBlock/RemoveBlock/ClearBlocks */
+	TMap<FGuid, int32> BlockIdIndex;
+
+	/** Persistent occupancy grid of live (non-destroyed) blocks */
+	FVoxelGridCache GridCache;
+
+	// Packed SoA mirrors of the hot block fields, index-parallel to Blocks
+	// (RemoveAtSwap keeps them in step). The meshing and mass paths read
+	// these instead of walking the fat FVoxelBlock structs.
+
+	/** Integer grid coordinates */
+	TArray<FIntVector> PackedCoords;
+
+	/** Material tier indices */
+	TArray<uint8> PackedMaterials;
+
+	/** Block shapes (EBlockShape as uint8) */
+	TArray<uint8> PackedShapes;
+
+	/** Shape orientations (EBlockOrientation as uint8) */
+	TArray<uint8> PackedOrientations;
+
+	/** Resolved render colors */
+	TArray<FColor> PackedColors;
+
+	/** Per-block masses */
+	TArray<float> PackedMasses;
+
+	/** Destroyed flags */
+	TArray<bool> PackedDestroyed;
+
+	// Mass aggregates, updated incrementally on add/remove/destroy so the
+	// flight model can read them every physics tick without an O(n) walk.
+	// Moment of inertia uses the point-mass identity
+	// I_com = sum(m*|p|^2) - M*|com|^2.
+
+	/** Total mass of all non-destroyed blocks */
+	float CachedTotalMass;
+
+	/** Mass-weighted position sum of all non-destroyed blocks */
+	FVector MassWeightedSum;
+
+	/** Mass-weighted squared-distance sum of all non-destroyed blocks */
+	float MassWeightedSquaredSum;
+
+	/** Add (+1) or remove (-1) a block's contribution to the mass aggregates */
+	void AccumulateBlockMass(const FVoxelBlock& Block, float Sign);
+
+	/** Recompute the mass aggregates from scratch (used on load/full rebuild) */
+	void RecomputeMassAggregates();
+
+	/** Build the packed mirror entry for a block */
+	static FPackedVoxel PackVoxel(const FVoxelBlock& Block);
+
+	/** Append a block's packed mirror entries */
+	void AppendPackedBlock(const FVoxelBlock& Block);
+
+	/** Remove the block at the given index, fixing up chunk and ID bookkeeping */
+	void RemoveBlockAtIndex(int32 Index);
+
+	// --- Simplified collision ---
+	// Physics never sees the render mesh. Each chunk's live voxels are
+	// greedy-merged into axis-aligned boxes (solid runs extended along
+	// X, widened along Y, deepened along Z), and the boxes of every
+	// chunk combine into the procedural mesh's convex set - boxes are
+	// the cheapest hulls to cook. Edits mark only the touched chunk's
+	// boxes stale, and the compound rebuilds on its own slower cadence.
+
+	/** Box compound per chunk, in component-local voxel space */
+	TMap<FIntVector, TArray<FBox>> ChunkCollisionBoxes;
+
+	/** Chunks whose collision boxes are stale */
+	TSet<FIntVector> CollisionDirtyChunks;
+
+	/** Counts down to the next collision rebuild */
+	float CollisionRebuildTimer;
+
+	/** Re-merge boxes for stale chunks and push the compound to physics */
+	void RebuildDirtyCollision();
+
+	/** Greedy-merge a chunk's live voxels into axis-aligned boxes */
+	void BuildChunkCollisionBoxes(const FVoxelChunk& Chunk, const FIntVector& ChunkCoord, TArray<FBox>& OutBoxes) const;
+
+	/** Cells whose block was destroyed/removed since the last connectivity check */
+	TArray<FIntVector> PendingSplitChecks;
+
+	/**
+	 * Check whether the removals queued in PendingSplitChecks disconnected
+	 * the structure, and broadcast OnStructureSplit for each fragment.
+	 * Runs simultaneous searches out from the neighbors of the removed
+	 * cells, merged with a union-find as they meet, so the cost scales
+	 * with the smallest fragment rather than the whole structure.
+	 */
+	void ProcessPendingSplitChecks();
+
+	/** Next free procedural mesh section to hand out to a chunk */
+	int32 NextSectionIndex;
+
+	/** Chunk coordinate containing the given block position */
+	FIntVector GetChunkCoord(const FVector& Position) const;
+
+	/** Rebuild the chunk map from scratch (used on load and full rebuilds) */
+	void RebuildChunkMap();
+
+	/** Mark the chunk containing the block dirty, plus boundary neighbors */
+	void MarkBlockChunksDirty(const FVoxelBlock& Block);
+
+	/** Remesh every chunk flagged dirty */
+	void RebuildDirtyChunks();
+
+	/** Kick off (or run synchronously) the mesh build for one chunk */
+	void RebuildChunk(const FIntVector& ChunkCoord, FVoxelChunk& Chunk);
+
+	/**
+	 * Copy the chunk's voxels plus the one-voxel border of neighboring
+	 * chunks into packed snapshot arrays for a mesh build. Border voxels
+	 * are only used for face culling, never meshed themselves.
+	 */
+	void GatherChunkSnapshot(const FIntVector& ChunkCoord, const FVoxelChunk& Chunk,
+	                         TArray<FPackedVoxel>& OutOwnedVoxels, TArray<FPackedVoxel>& OutBorderVoxels) const;
+
+	/** Push finished mesh buffers into the chunk's mesh section (game thread only) */
+	void ApplyMeshBuildResult(const FVoxelMeshBuildResult& Result);
+
+	// Mesh builders - static and side-effect free so they can run on worker threads
+	// against an immutable packed snapshot of the voxel data.
+
 	/** Generate mesh using simple face culling */
-	void GenerateSimpleMesh();
+	static void BuildSimpleMesh(const TArray<FPackedVoxel>& InVoxels, const TArray<FPackedVoxel>& InBorderVoxels, FVoxelMeshBuildResult& OutResult);
 
 	/** Generate mesh using greedy meshing algorithm (optimized) */
-	void GenerateGreedyMesh();
+	static void BuildGreedyMesh(const TArray<FPackedVoxel>& InVoxels, const TArray<FPackedVoxel>& InBorderVoxels, FVoxelMeshBuildResult& OutResult);
 
-	/** Generate faces for a single block with neighbor culling */
-	void GenerateBlockFaces(const FVoxelBlock& Block, const TMap<FVector, int32>& BlockLookup,
+	/** Generate faces for a single voxel with neighbor culling */
+	static void GenerateVoxelFaces(const FPackedVoxel& Voxel, const TSet<FIntVector>& OccupiedCells,
 	                        TArray<FVector>& Vertices, TArray<int32>& Triangles,
 	                        TArray<FVector>& Normals, TArray<FColor>& VertexColors);
 
 	/** Add a quad face to the mesh arrays */
-	void AddFace(const FVector& Position, const FVector& Size, int32 FaceIndex,
+	static void AddFace(const FVector& Position, const FVector& Size, int32 FaceIndex,
 	             const FColor& Color, TArray<FVector>& Vertices, TArray<int32>& Triangles,
 	             TArray<FVector>& Normals, TArray<FColor>& VertexColors);
 
-	/** Build spatial lookup for fast neighbor checking */
-	TMap<FVector, int32> BuildBlockLookup() const;
-
 	/** Round position for lookup key */
 	static FVector RoundPosition(const FVector& Position);
 
 	// Greedy meshing helper functions
-	
+
 	/** Process one axis for greedy meshing */
-	void GreedyMeshAxis(
-		const TArray<const FVoxelBlock*>& VoxelGrid,
+	static void GreedyMeshAxis(
+		const TArray<const FPackedVoxel*>& VoxelGrid,
 		const FIntVector& GridSize,
 		const FIntVector& GridMin,
+		const TSet<const FPackedVoxel*>& OwnedVoxels,
 		int32 Axis,
 		int32 Direction,
 		TArray<FVector>& Vertices,
@@ -114,14 +578,14 @@ protected:
 	/** Get grid coordinates based on axis orientation */
 	static FIntVector GetAxisCoords(int32 Axis, int32 U, int32 V, int32 W);
 
-	/** Get voxel block from grid with bounds checking */
-	static const FVoxelBlock* GetVoxelFromGrid(
-		const TArray<const FVoxelBlock*>& VoxelGrid,
+	/** Get voxel from grid with bounds checking */
+	static const FPackedVoxel* GetVoxelFromGrid(
+		const TArray<const FPackedVoxel*>& VoxelGrid,
 		const FIntVector& GridSize,
 		const FIntVector& Coords);
 
 	/** Add a greedy-meshed quad to the mesh arrays */
-	void AddGreedyQuad(
+	static void AddGreedyQuad(
 		const FIntVector& GridMin,
 		int32 Axis,
 		int32 Direction,
@@ -130,7 +594,7 @@ protected:
 		int32 V,
 		int32 Width,
 		int32 Height,
-		const FVoxelBlock& Block,
+		const FPackedVoxel& Voxel,
 		TArray<FVector>& Vertices,
 		TArray<int32>& Triangles,
 		TArray<FVector>& Normals,
@@ -102,11 +102,26 @@ class SUBSPACEUE_API UVoxelMaterialLibrary : public UBlueprintFunctionLibrary
 	GENERATED_BODY()
 
 public:
+	/** Number of material tiers in the fixed property table */
+	static constexpr int32 NumMaterialTiers = 7;
+
+	/**
+	 * Material properties by index (EMaterialTier as uint8). Const ref
+	 * into the fixed table - no copy, no string hashing; this is the
+	 * form the meshing and damage hot loops should use. Out-of-range
+	 * indices resolve to Iron.
+	 */
+	static const FVoxelMaterialProperties& GetMaterialPropertiesByIndex(uint8 MaterialIndex);
+
 	/** Get material properties by tier */
 	UFUNCTION(BlueprintCallable, Category = "Voxel|Materials")
 	static FVoxelMaterialProperties GetMaterialProperties(EMaterialTier Tier);
 
-	/** Get material properties by name */
+	/**
+	 * Get material properties by name. String resolution is for
+	 * Blueprint and content paths only - resolve to an index once and
+	 * use GetMaterialPropertiesByIndex in anything per-block.
+	 */
 	UFUNCTION(BlueprintCallable, Category = "Voxel|Materials")
 	static FVoxelMaterialProperties GetMaterialPropertiesByName(const FString& MaterialName);
 
@@ -143,10 +158,6 @@ public:
 	static EMaterialTier MaterialNameToTier(const FString& MaterialName);
 
 private:
-	/** Initialize material properties table (called once) */
-	static void InitializeMaterialTable();
-
-	/** Material properties lookup table */
-	static TMap<EMaterialTier, FVoxelMaterialProperties> MaterialTable;
-	static bool bMaterialTableInitialized;
+	/** Fixed property table indexed by material tier, built on first use */
+	static const FVoxelMaterialProperties* GetMaterialTable();
 };
@@ -0,0 +1,32 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VoxelMeshBenchCommandlet.generated.h"
+
+/**
+ * Headless micro-benchmark for the voxel meshers. Builds canonical
+ * block sets (solid cube, hollow hull, 30%-fill random asteroid) at
+ * several block counts, runs both the simple and greedy meshers N
+ * times, and reports vertices, triangles, wall time and output buffer
+ * size per configuration as CSV - logged and written to
+ * Saved/Profiling/VoxelMeshBench.csv.
+ *
+ * Run with:
+ *   -run=VoxelMeshBench [-runs=3] [-sizes=10000,100000,500000]
+ */
+UCLASS()
+class SUBSPACEUE_API UVoxelMeshBenchCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 Main(const FString& Params) override;
+
+protected:
+	/** Run both meshers over one block set and append CSV rows */
+	void BenchScenario(const FString& ScenarioName, const TArray<struct FPackedVoxel>& Voxels,
+		int32 Runs, FString& OutCsv) const;
+};
@@ -0,0 +1,45 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Precomputed geometry for non-cube block shapes. Canonical triangle
+ * soups for each EBlockShape are compile-time float tables; the bake
+ * applies the six EBlockOrientation rotations (integer matrices, no
+ * quaternions) and computes flat normals exactly once per session, so
+ * the meshers emit shaped blocks with a table lookup and a translate.
+ *
+ * Shaped blocks neither occlude their neighbours nor merge in the
+ * greedy pass - they always emit their full canonical geometry. Only
+ * full cubes take part in face culling and quad merging.
+ */
+namespace VoxelShape
+{
+	/** Number of EBlockShape values */
+	constexpr int32 NumShapes = 6;
+
+	/** Number of EBlockOrientation values */
+	constexpr int32 NumOrientations = 6;
+
+	/** Whether a shape index is a full cube (cubes use the quad paths) */
+	constexpr bool IsFullCube(uint8 Shape) { return Shape == 0; }
+
+	/** Baked triangle soup for one shape in one orientation */
+	struct FShapeGeometry
+	{
+		/** Triangle soup vertices, three per triangle, centered on the voxel */
+		TArray<FVector> Vertices;
+
+		/** Flat per-vertex normals */
+		TArray<FVector> Normals;
+	};
+
+	/**
+	 * Geometry for a shape/orientation pair. Out-of-range indices fall
+	 * back to the canonical orientation of the nearest valid shape.
+	 * Thread-safe; the meshers call this from worker threads.
+	 */
+	SUBSPACEUE_API const FShapeGeometry& GetShapeGeometry(uint8 Shape, uint8 Orientation);
+}